@@ -117,6 +117,7 @@ int32_t BRD_SM_SensorDescribe(uint32_t sensorId,
             desc->numTripPoints = 0U;
             desc->timestampSupport = false;
             desc->timestampExponent = 0;
+            desc->asyncReadSupport = true;
 
             /* PF09? */
             if (sensorId == BRD_SM_SENSOR_TEMP_PF09)
@@ -40,6 +40,7 @@
 
 #include "sm.h"
 #include "brd_sm.h"
+#include "trace.h"
 
 /* Local defines */
 
@@ -165,6 +166,9 @@ int32_t BRD_SM_VoltageModeSet(uint32_t domainId, uint8_t voltMode)
         ? PF09_SW_MODE_OFF : PF09_SW_MODE_PWM);
     bool rc;
 
+    /* Trace PMIC transaction */
+    SM_TRACE(SM_TRACE_CAT_PMIC, SM_TRACE_PMIC_START, domainId, voltMode);
+
     /* Set mode */
     switch (domainId)
     {
@@ -228,6 +232,9 @@ int32_t BRD_SM_VoltageModeSet(uint32_t domainId, uint8_t voltMode)
         status = SM_ERR_HARDWARE_ERROR;
     }
 
+    /* Trace PMIC transaction done */
+    SM_TRACE(SM_TRACE_CAT_PMIC, SM_TRACE_PMIC_DONE, domainId, status);
+
     /* Return status */
     return status;
 }
@@ -317,6 +324,9 @@ int32_t BRD_SM_VoltageLevelSet(uint32_t domainId, int32_t voltageLevel)
     bool rc;
     uint32_t level = (uint32_t) voltageLevel;
 
+    /* Trace PMIC transaction */
+    SM_TRACE(SM_TRACE_CAT_PMIC, SM_TRACE_PMIC_START, domainId, level);
+
     /* Set level */
     switch (domainId)
     {
@@ -377,6 +387,9 @@ int32_t BRD_SM_VoltageLevelSet(uint32_t domainId, int32_t voltageLevel)
         status = SM_ERR_HARDWARE_ERROR;
     }
 
+    /* Trace PMIC transaction done */
+    SM_TRACE(SM_TRACE_CAT_PMIC, SM_TRACE_PMIC_DONE, domainId, status);
+
     /* Return status */
     return status;
 }
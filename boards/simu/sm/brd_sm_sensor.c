@@ -116,6 +116,7 @@ int32_t BRD_SM_SensorDescribe(uint32_t sensorId,
             desc->numTripPoints = 2U;
             desc->timestampSupport = false;
             desc->timestampExponent = 0;
+            desc->asyncReadSupport = true;
         }
     }
     else
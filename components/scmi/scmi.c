@@ -295,15 +295,17 @@ int32_t SCMI_P2aRx(uint32_t channel, uint32_t protocolId,
     {
         *header = msg->header;
 
-        /* Check message type */
-        if (SCMI_HEADER_TYPE_EX(*header) != 3U)
+        /* Check message type (delayed response or notification) */
+        if ((SCMI_HEADER_TYPE_EX(*header) != 2U)
+            && (SCMI_HEADER_TYPE_EX(*header) != 3U))
         {
             status = SCMI_ERR_PROTOCOL_ERROR;
         }
     }
 
-    /* Check sequence */
-    if (status == SCMI_ERR_SUCCESS)
+    /* Check sequence, delayed response uses the command token */
+    if ((status == SCMI_ERR_SUCCESS)
+        && (SCMI_HEADER_TYPE_EX(*header) == 3U))
     {
         uint32_t token = SCMI_HEADER_TOKEN_EX(*header);
 
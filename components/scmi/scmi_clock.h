@@ -62,6 +62,10 @@
 #define SCMI_MSG_CLOCK_RATE_GET              0x6U
 /*! Set clock configuration */
 #define SCMI_MSG_CLOCK_CONFIG_SET            0x7U
+/*! Configure clock rate change notification */
+#define SCMI_MSG_CLOCK_RATE_NOTIFY           0x9U
+/*! Configure clock rate change requested notification */
+#define SCMI_MSG_CLOCK_RATE_CHANGE_REQUESTED_NOTIFY  0xAU
 /*! Get clock configuration */
 #define SCMI_MSG_CLOCK_CONFIG_GET            0xBU
 /*! Get all possible parents */
@@ -74,6 +78,10 @@
 #define SCMI_MSG_CLOCK_GET_PERMISSIONS       0xFU
 /*! Negotiate the protocol version */
 #define SCMI_MSG_NEGOTIATE_PROTOCOL_VERSION  0x10U
+/*! Read clock rate changed */
+#define SCMI_MSG_CLOCK_RATE_CHANGED          0x0U
+/*! Read clock rate change requested */
+#define SCMI_MSG_CLOCK_RATE_CHANGE_REQUESTED  0x1U
 /** @} */
 
 /*!
@@ -243,6 +251,14 @@
 #define SCMI_CLOCK_PERM_RATE(x)    (((x) & 0x20000000U) >> 29U)
 /** @} */
 
+/*!
+ * @name SCMI clock notification flags
+ */
+/** @{ */
+/*! Notify enable */
+#define SCMI_CLOCK_NOTIFY_ENABLE(x)  (((x) & 0x1U) << 0U)
+/** @} */
+
 /* Types */
 
 /*!
@@ -871,6 +887,105 @@ int32_t SCMI_ClockGetPermissions(uint32_t channel, uint32_t clockId,
 int32_t SCMI_ClockNegotiateProtocolVersion(uint32_t channel,
     uint32_t version);
 
+/*!
+ * Configure clock rate change notification.
+ *
+ * @param[in]     channel       A2P channel for comms
+ * @param[in]     clockId       Identifier for the clock device
+ * @param[in]     notifyEnable  Notify enable:<BR>
+ *                              Bits[31:1] Reserved, must be zero.<BR>
+ *                              Bit[0] If set to 1, CLOCK_RATE_CHANGED
+ *                              notifications are sent when the rate of the
+ *                              clock changes. If set to 0, no notifications
+ *                              are sent
+ *
+ * This function is used by the agent to request notifications when the
+ * rate of a clock changes. This includes changes caused by a parent clock
+ * or by a performance level change. See section 4.6.2.12 CLOCK_RATE_NOTIFY
+ * in the [SCMI Spec](@ref DOCS).
+ *
+ * Access macros:
+ * - ::SCMI_CLOCK_NOTIFY_ENABLE() - Notify enable
+ *
+ * @return Returns the status (::SCMI_ERR_SUCCESS = success).
+ *
+ * Return errors (see @ref SCMI_STATUS "SCMI error codes"):
+ * - ::SCMI_ERR_SUCCESS: if the notification state was successfully updated.
+ * - ::SCMI_ERR_NOT_FOUND: if the clock identified by \a clockId does not
+ *   exist.
+ * - ::SCMI_ERR_DENIED: if the calling agent is not permitted to request
+ *   this notification.
+ */
+int32_t SCMI_ClockRateNotify(uint32_t channel, uint32_t clockId,
+    uint32_t notifyEnable);
+
+/*!
+ * Configure clock rate change requested notification.
+ *
+ * @param[in]     channel       A2P channel for comms
+ * @param[in]     clockId       Identifier for the clock device
+ * @param[in]     notifyEnable  Notify enable:<BR>
+ *                              Bits[31:1] Reserved, must be zero.<BR>
+ *                              Bit[0] If set to 1,
+ *                              CLOCK_RATE_CHANGE_REQUESTED notifications are
+ *                              sent when an agent requests a rate change. If
+ *                              set to 0, no notifications are sent
+ *
+ * This function is used by the agent to request notifications when an
+ * agent requests a clock rate change. See section 4.6.2.13
+ * CLOCK_RATE_CHANGE_REQUESTED_NOTIFY in the [SCMI Spec](@ref DOCS).
+ *
+ * Access macros:
+ * - ::SCMI_CLOCK_NOTIFY_ENABLE() - Notify enable
+ *
+ * @return Returns the status (::SCMI_ERR_SUCCESS = success).
+ *
+ * Return errors (see @ref SCMI_STATUS "SCMI error codes"):
+ * - ::SCMI_ERR_SUCCESS: if the notification state was successfully updated.
+ * - ::SCMI_ERR_NOT_FOUND: if the clock identified by \a clockId does not
+ *   exist.
+ * - ::SCMI_ERR_DENIED: if the calling agent is not permitted to request
+ *   this notification.
+ */
+int32_t SCMI_ClockRateChangeRequestedNotify(uint32_t channel,
+    uint32_t clockId, uint32_t notifyEnable);
+
+/*!
+ * Read clock rate changed.
+ *
+ * @param[in]     channel     P2A channel for comms
+ * @param[out]    agentId     Identifier for the agent that caused the
+ *                            change, 0 = platform
+ * @param[out]    clockId     Identifier for the clock device
+ * @param[out]    rate        New rate of the clock
+ *
+ * This notification is issued by the platform when the rate of a clock
+ * the agent subscribed to using SCMI_ClockRateNotify() changes. See
+ * section 4.6.4.1 CLOCK_RATE_CHANGED in the [SCMI Spec](@ref DOCS).
+ *
+ * @return Returns the status (::SCMI_ERR_SUCCESS = success).
+ */
+int32_t SCMI_ClockRateChanged(uint32_t channel, uint32_t *agentId,
+    uint32_t *clockId, scmi_clock_rate_t *rate);
+
+/*!
+ * Read clock rate change requested.
+ *
+ * @param[in]     channel     P2A channel for comms
+ * @param[out]    agentId     Identifier for the agent requesting the change
+ * @param[out]    clockId     Identifier for the clock device
+ * @param[out]    rate        Requested rate of the clock
+ *
+ * This notification is issued by the platform when an agent requests a
+ * rate change of a clock the agent subscribed to using
+ * SCMI_ClockRateChangeRequestedNotify(). See section 4.6.4.2
+ * CLOCK_RATE_CHANGE_REQUESTED in the [SCMI Spec](@ref DOCS).
+ *
+ * @return Returns the status (::SCMI_ERR_SUCCESS = success).
+ */
+int32_t SCMI_ClockRateChangeRequested(uint32_t channel, uint32_t *agentId,
+    uint32_t *clockId, scmi_clock_rate_t *rate);
+
 #endif /* SCMI_CLOCK_H */
 
 /** @} */
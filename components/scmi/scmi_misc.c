@@ -1073,6 +1073,179 @@ int32_t SCMI_MiscControlExtGet(uint32_t channel, uint32_t ctrlId,
     return status;
 }
 
+/*--------------------------------------------------------------------------*/
+/* Discover resources                                                       */
+/*--------------------------------------------------------------------------*/
+int32_t SCMI_MiscDiscoverResources(uint32_t channel, uint32_t protocolId,
+    uint32_t index, uint32_t *numRecordFlags, uint32_t *nextIndex,
+    scmi_misc_record_t *records)
+{
+    int32_t status;
+    uint32_t header;
+    void *msg;
+
+    /* Response message structure */
+    typedef struct
+    {
+        uint32_t header;
+        int32_t status;
+        uint32_t numRecordFlags;
+        uint32_t nextIndex;
+        scmi_misc_record_t records[SCMI_MISC_MAX_RECORD];
+    } msg_rmiscd34_t;
+
+    /* Acquire lock */
+    SCMI_A2P_LOCK(channel);
+
+    /* Init buffer */
+    status = SCMI_BufInit(channel, &msg);
+
+    /* Send request */
+    if (status == SCMI_ERR_SUCCESS)
+    {
+        /* Request message structure */
+        typedef struct
+        {
+            uint32_t header;
+            uint32_t protocolId;
+            uint32_t index;
+        } msg_tmiscd34_t;
+        msg_tmiscd34_t *msgTx = (msg_tmiscd34_t*) msg;
+
+        /* Fill in parameters */
+        msgTx->protocolId = protocolId;
+        msgTx->index = index;
+
+        /* Send message */
+        status = SCMI_A2pTx(channel, COMMAND_PROTOCOL,
+            SCMI_MSG_MISC_DISCOVER_RESOURCES, sizeof(msg_tmiscd34_t),
+            &header);
+    }
+
+    /* Receive response */
+    if (status == SCMI_ERR_SUCCESS)
+    {
+        status = SCMI_A2pRx(channel,
+            sizeof(msg_status_t) + (2U * sizeof(uint32_t)), header);
+    }
+
+    /* Copy out if no error */
+    if (status == SCMI_ERR_SUCCESS)
+    {
+        const msg_rmiscd34_t *msgRx = (const msg_rmiscd34_t*) msg;
+
+        /* Extract numRecordFlags */
+        if (numRecordFlags != NULL)
+        {
+            *numRecordFlags = msgRx->numRecordFlags;
+        }
+
+        /* Extract nextIndex */
+        if (nextIndex != NULL)
+        {
+            *nextIndex = msgRx->nextIndex;
+        }
+
+        /* Extract records */
+        if (records != NULL)
+        {
+            SCMI_MemCpy((uint8_t*) records, (uint8_t*) &msgRx->records,
+                (SCMI_MISC_NUM_RECORD * sizeof(scmi_misc_record_t)));
+        }
+    }
+
+    /* Release lock */
+    SCMI_A2P_UNLOCK(channel);
+
+    /* Return status */
+    return status;
+}
+
+/*--------------------------------------------------------------------------*/
+/* Get event trace records                                                  */
+/*--------------------------------------------------------------------------*/
+int32_t SCMI_MiscTraceGet(uint32_t channel, uint32_t index,
+    uint32_t *numTraceFlags, uint32_t *nextIndex,
+    scmi_misc_trace_t *records)
+{
+    int32_t status;
+    uint32_t header;
+    void *msg;
+
+    /* Response message structure */
+    typedef struct
+    {
+        uint32_t header;
+        int32_t status;
+        uint32_t numTraceFlags;
+        uint32_t nextIndex;
+        scmi_misc_trace_t records[SCMI_MISC_MAX_TRACE];
+    } msg_rmiscd35_t;
+
+    /* Acquire lock */
+    SCMI_A2P_LOCK(channel);
+
+    /* Init buffer */
+    status = SCMI_BufInit(channel, &msg);
+
+    /* Send request */
+    if (status == SCMI_ERR_SUCCESS)
+    {
+        /* Request message structure */
+        typedef struct
+        {
+            uint32_t header;
+            uint32_t index;
+        } msg_tmiscd35_t;
+        msg_tmiscd35_t *msgTx = (msg_tmiscd35_t*) msg;
+
+        /* Fill in parameters */
+        msgTx->index = index;
+
+        /* Send message */
+        status = SCMI_A2pTx(channel, COMMAND_PROTOCOL,
+            SCMI_MSG_MISC_TRACE_GET, sizeof(msg_tmiscd35_t), &header);
+    }
+
+    /* Receive response */
+    if (status == SCMI_ERR_SUCCESS)
+    {
+        status = SCMI_A2pRx(channel,
+            sizeof(msg_status_t) + (2U * sizeof(uint32_t)), header);
+    }
+
+    /* Copy out if no error */
+    if (status == SCMI_ERR_SUCCESS)
+    {
+        const msg_rmiscd35_t *msgRx = (const msg_rmiscd35_t*) msg;
+
+        /* Extract numTraceFlags */
+        if (numTraceFlags != NULL)
+        {
+            *numTraceFlags = msgRx->numTraceFlags;
+        }
+
+        /* Extract nextIndex */
+        if (nextIndex != NULL)
+        {
+            *nextIndex = msgRx->nextIndex;
+        }
+
+        /* Extract records */
+        if (records != NULL)
+        {
+            SCMI_MemCpy((uint8_t*) records, (uint8_t*) &msgRx->records,
+                (SCMI_MISC_NUM_TRACE * sizeof(scmi_misc_trace_t)));
+        }
+    }
+
+    /* Release lock */
+    SCMI_A2P_UNLOCK(channel);
+
+    /* Return status */
+    return status;
+}
+
 /*--------------------------------------------------------------------------*/
 /* Read control notification event                                          */
 /*--------------------------------------------------------------------------*/
@@ -82,6 +82,10 @@
 #define SCMI_MSG_MISC_CONTROL_EXT_SET        0x20U
 /*! Get an extended control value */
 #define SCMI_MSG_MISC_CONTROL_EXT_GET        0x21U
+/*! Discover resources */
+#define SCMI_MSG_MISC_DISCOVER_RESOURCES     0x22U
+/*! Get event trace records */
+#define SCMI_MSG_MISC_TRACE_GET              0x23U
 /*! Read control notification event */
 #define SCMI_MSG_MISC_CONTROL_EVENT          0x0U
 /** @} */
@@ -120,6 +124,12 @@
 #define SCMI_MISC_MAX_EXTINFO    SCMI_ARRAY(16U, uint32_t)
 /*! Max number syslog words */
 #define SCMI_MISC_MAX_SYSLOG     SCMI_ARRAY(8U, uint32_t)
+/*! Max number of resource records */
+#define SCMI_MISC_MAX_RECORD     SCMI_ARRAY(12U, scmi_misc_record_t)
+/*! Max length of the returned resource name */
+#define SCMI_MISC_MAX_RECNAME    16U
+/*! Max number of trace records */
+#define SCMI_MISC_MAX_TRACE      SCMI_ARRAY(16U, scmi_misc_trace_t)
 /** @} */
 
 /*!
@@ -144,6 +154,10 @@
 #define SCMI_MISC_NUM_EXTINFO   SCMI_MISC_SHUTDOWN_FLAG_EXT_LEN(msgRx->shutdownFlags)
 /*! Actual number of syslog words returned */
 #define SCMI_MISC_NUM_SYSLOG    SCMI_MISC_NUM_LOG_FLAGS_NUM_LOGS(msgRx->numLogFlags)
+/*! Actual number of resource records returned */
+#define SCMI_MISC_NUM_RECORD    SCMI_MISC_NUM_REC_FLAGS_NUM_RECS(msgRx->numRecordFlags)
+/*! Actual number of trace records returned */
+#define SCMI_MISC_NUM_TRACE     SCMI_MISC_NUM_TRACE_FLAGS_NUM_RECS(msgRx->numTraceFlags)
 /** @} */
 
 /*!
@@ -224,6 +238,71 @@
 #define SCMI_MISC_NUM_LOG_FLAGS_NUM_LOGS(x)      (((x) & 0xFFFU) >> 0U)
 /** @} */
 
+/*!
+ * @name SCMI misc num record flags
+ */
+/** @{ */
+/*! Number of remaining resource IDs to scan */
+#define SCMI_MISC_NUM_REC_FLAGS_REMAINING_IDS(x)  (((x) & 0xFFF00000U) >> 20U)
+/*! Number of records that are returned by this call */
+#define SCMI_MISC_NUM_REC_FLAGS_NUM_RECS(x)       (((x) & 0xFFFU) >> 0U)
+/** @} */
+
+/*!
+ * @name SCMI misc record attributes
+ */
+/** @{ */
+/*! Resource ID */
+#define SCMI_MISC_REC_ATTR_ID(x)    (((x) & 0xFFFF0000U) >> 16U)
+/*! Caller permission */
+#define SCMI_MISC_REC_ATTR_PERM(x)  (((x) & 0xFFU) >> 0U)
+/** @} */
+
+/*!
+ * @name SCMI misc num trace flags
+ */
+/** @{ */
+/*! Number of remaining trace records */
+#define SCMI_MISC_NUM_TRACE_FLAGS_REMAINING(x)  (((x) & 0xFFF00000U) >> 20U)
+/*! Records before the index were lost */
+#define SCMI_MISC_NUM_TRACE_FLAGS_LOST(x)       (((x) & 0x80000U) >> 19U)
+/*! Number of trace records that are returned by this call */
+#define SCMI_MISC_NUM_TRACE_FLAGS_NUM_RECS(x)   (((x) & 0xFFFU) >> 0U)
+/** @} */
+
+/* Types */
+
+/*!
+ * SCMI misc resource record
+ */
+typedef struct
+{
+    /*! Resource ID and caller permission */
+    uint32_t attributes;
+    /*! Protocol resource attributes (low) */
+    uint32_t attrLow;
+    /*! Protocol resource attributes (high) */
+    uint32_t attrHigh;
+    /*! A NULL terminated ASCII string with the resource name, of up to 16
+        bytes */
+    uint8_t name[16];
+} scmi_misc_record_t;
+
+/*!
+ * SCMI misc trace record
+ */
+typedef struct
+{
+    /*! Timestamp in uS (low) */
+    uint32_t timeLow;
+    /*! Timestamp in uS (high) */
+    uint32_t timeHigh;
+    /*! Event: category [31:24], event ID [23:16], argument 0 [15:0] */
+    uint32_t event;
+    /*! Argument 1 */
+    uint32_t arg;
+} scmi_misc_trace_t;
+
 /* Functions */
 
 /*!
@@ -705,6 +784,92 @@ int32_t SCMI_MiscControlExtSet(uint32_t channel, uint32_t ctrlId,
 int32_t SCMI_MiscControlExtGet(uint32_t channel, uint32_t ctrlId,
     uint32_t addr, uint32_t len, uint32_t *numVal, uint32_t *extVal);
 
+/*!
+ * Discover resources.
+ *
+ * @param[in]     channel         A2P channel for comms
+ * @param[in]     protocolId      Protocol of the resources
+ * @param[in]     index           Index of the first resource ID to scan
+ * @param[out]    numRecordFlags  Descriptor for the records returned by this
+ *                                call.<BR>
+ *                                Bits[31:20] Number of remaining resource IDs
+ *                                to scan.<BR>
+ *                                Bits[19:12] Reserved, must be zero.<BR>
+ *                                Bits[11:0] Number of records that are
+ *                                returned by this call
+ * @param[out]    nextIndex       Index of the next resource ID to scan
+ * @param[out]    records         Array of resource records
+ *
+ * This function scans the resources of a protocol starting at \a index and
+ * returns a packed record for each resource the calling agent has access to.
+ * Each record contains the resource ID, the agent permission, the protocol
+ * attributes and the resource name. The low attributes word is the one
+ * returned by the attributes message of the protocol (e.g.
+ * SCMI_ClockAttributes()). The high word holds the sensor attributes (high)
+ * for sensors and is zero for other protocols. Resources the agent has no
+ * access to are skipped. Max number of records is ::SCMI_MISC_MAX_RECORD.
+ * Supported protocols are power, perf, clock, sensor, reset, voltage and pin
+ * control. Call again with \a nextIndex until no IDs remain.
+ *
+ * Access macros:
+ * - ::SCMI_MISC_NUM_REC_FLAGS_REMAINING_IDS() - Number of remaining resource
+ *   IDs to scan
+ * - ::SCMI_MISC_NUM_REC_FLAGS_NUM_RECS() - Number of records that are
+ *   returned by this call
+ * - ::SCMI_MISC_REC_ATTR_ID() - Resource ID
+ * - ::SCMI_MISC_REC_ATTR_PERM() - Caller permission
+ *
+ * @return Returns the status (::SCMI_ERR_SUCCESS = success).
+ *
+ * Return errors (see @ref SCMI_STATUS "SCMI error codes"):
+ * - ::SCMI_ERR_SUCCESS: if the records are returned successfully.
+ * - ::SCMI_ERR_NOT_SUPPORTED: if \a protocolId is not supported.
+ * - ::SCMI_ERR_INVALID_PARAMETERS: if \a index is out of range.
+ */
+int32_t SCMI_MiscDiscoverResources(uint32_t channel, uint32_t protocolId,
+    uint32_t index, uint32_t *numRecordFlags, uint32_t *nextIndex,
+    scmi_misc_record_t *records);
+
+/*!
+ * Get event trace records.
+ *
+ * @param[in]     channel         A2P channel for comms
+ * @param[in]     index           Index of the first trace record to return
+ * @param[out]    numTraceFlags   Descriptor for the records returned by this
+ *                                call.<BR>
+ *                                Bits[31:20] Number of remaining records.<BR>
+ *                                Bit[19] Records before \a index were lost
+ *                                (overwritten).<BR>
+ *                                Bits[18:12] Reserved, must be zero.<BR>
+ *                                Bits[11:0] Number of records that are
+ *                                returned by this call
+ * @param[out]    nextIndex       Index of the next trace record
+ * @param[out]    records         Array of trace records
+ *
+ * This function returns records from the SM event trace, oldest first. The
+ * trace is a ring of timestamped binary events (SCMI, LM state, perf,
+ * voltage, PMIC, IRQ, sleep) with categories selected when the SM is built.
+ * Max number of records is ::SCMI_MISC_MAX_TRACE. Start with \a index 0 and
+ * call again with \a nextIndex until no records remain. If \a index is older
+ * than the oldest record still in the ring then the oldest is returned first
+ * and the lost flag is set.
+ *
+ * Access macros:
+ * - ::SCMI_MISC_NUM_TRACE_FLAGS_REMAINING() - Number of remaining records
+ * - ::SCMI_MISC_NUM_TRACE_FLAGS_LOST() - Records lost
+ * - ::SCMI_MISC_NUM_TRACE_FLAGS_NUM_RECS() - Number of records that are
+ *   returned by this call
+ *
+ * @return Returns the status (::SCMI_ERR_SUCCESS = success).
+ *
+ * Return errors (see @ref SCMI_STATUS "SCMI error codes"):
+ * - ::SCMI_ERR_SUCCESS: if the records are returned successfully.
+ * - ::SCMI_ERR_INVALID_PARAMETERS: if \a index is beyond the last record.
+ */
+int32_t SCMI_MiscTraceGet(uint32_t channel, uint32_t index,
+    uint32_t *numTraceFlags, uint32_t *nextIndex,
+    scmi_misc_trace_t *records);
+
 /*!
  * Read control notification event.
  *
@@ -345,3 +345,307 @@ int32_t SCMI_PowerNegotiateProtocolVersion(uint32_t channel,
     return SCMI_NegotiateProtocolVersion(channel, COMMAND_PROTOCOL, version);
 }
 
+
+/*--------------------------------------------------------------------------*/
+/* Configure power state change notification                                */
+/*--------------------------------------------------------------------------*/
+int32_t SCMI_PowerStateNotify(uint32_t channel, uint32_t domainId,
+    uint32_t notifyEnable)
+{
+    int32_t status;
+    uint32_t header;
+    void *msg;
+
+    /* Acquire lock */
+    SCMI_A2P_LOCK(channel);
+
+    /* Init buffer */
+    status = SCMI_BufInit(channel, &msg);
+
+    /* Send request */
+    if (status == SCMI_ERR_SUCCESS)
+    {
+        /* Request message structure */
+        typedef struct
+        {
+            uint32_t header;
+            uint32_t domainId;
+            uint32_t notifyEnable;
+        } msg_tpowerd6_t;
+        msg_tpowerd6_t *msgTx = (msg_tpowerd6_t*) msg;
+
+        /* Fill in parameters */
+        msgTx->domainId = domainId;
+        msgTx->notifyEnable = notifyEnable;
+
+        /* Send message */
+        status = SCMI_A2pTx(channel, COMMAND_PROTOCOL,
+            SCMI_MSG_POWER_STATE_NOTIFY, sizeof(msg_tpowerd6_t), &header);
+    }
+
+    /* Receive response */
+    if (status == SCMI_ERR_SUCCESS)
+    {
+        status = SCMI_A2pRx(channel, sizeof(msg_status_t), header);
+    }
+
+    /* Release lock */
+    SCMI_A2P_UNLOCK(channel);
+
+    /* Return status */
+    return status;
+}
+
+/*--------------------------------------------------------------------------*/
+/* Configure power state change requested notification                      */
+/*--------------------------------------------------------------------------*/
+int32_t SCMI_PowerStateChangeRequestedNotify(uint32_t channel,
+    uint32_t domainId, uint32_t notifyEnable)
+{
+    int32_t status;
+    uint32_t header;
+    void *msg;
+
+    /* Acquire lock */
+    SCMI_A2P_LOCK(channel);
+
+    /* Init buffer */
+    status = SCMI_BufInit(channel, &msg);
+
+    /* Send request */
+    if (status == SCMI_ERR_SUCCESS)
+    {
+        /* Request message structure */
+        typedef struct
+        {
+            uint32_t header;
+            uint32_t domainId;
+            uint32_t notifyEnable;
+        } msg_tpowerd7_t;
+        msg_tpowerd7_t *msgTx = (msg_tpowerd7_t*) msg;
+
+        /* Fill in parameters */
+        msgTx->domainId = domainId;
+        msgTx->notifyEnable = notifyEnable;
+
+        /* Send message */
+        status = SCMI_A2pTx(channel, COMMAND_PROTOCOL,
+            SCMI_MSG_POWER_STATE_CHANGE_REQUESTED_NOTIFY,
+            sizeof(msg_tpowerd7_t), &header);
+    }
+
+    /* Receive response */
+    if (status == SCMI_ERR_SUCCESS)
+    {
+        status = SCMI_A2pRx(channel, sizeof(msg_status_t), header);
+    }
+
+    /* Release lock */
+    SCMI_A2P_UNLOCK(channel);
+
+    /* Return status */
+    return status;
+}
+
+/*--------------------------------------------------------------------------*/
+/* Read power state changed                                                 */
+/*--------------------------------------------------------------------------*/
+int32_t SCMI_PowerStateChanged(uint32_t channel, uint32_t *agentId,
+    uint32_t *domainId, uint32_t *powerState)
+{
+    int32_t status;
+    uint32_t header;
+    const void *msg;
+
+    /* Acquire lock */
+    SCMI_P2A_LOCK(channel);
+
+    /* Get transport buffer address */
+    msg = SCMI_HdrAddrGet(channel);
+
+    /* Read message */
+    {
+        /* Read message structure */
+        typedef struct
+        {
+            uint32_t header;
+            uint32_t agentId;
+            uint32_t domainId;
+            uint32_t powerState;
+        } msg_rpowered32_t;
+        const msg_rpowered32_t *msgRx = (const msg_rpowered32_t*) msg;
+
+        /* Receive message */
+        status = SCMI_P2aRx(channel, COMMAND_PROTOCOL,
+            SCMI_MSG_POWER_STATE_CHANGED, sizeof(msg_rpowered32_t),
+            &header);
+
+        /* Copy out if no error */
+        if (status == SCMI_ERR_SUCCESS)
+        {
+            /* Extract agentId */
+            if (agentId != NULL)
+            {
+                *agentId = msgRx->agentId;
+            }
+
+            /* Extract domainId */
+            if (domainId != NULL)
+            {
+                *domainId = msgRx->domainId;
+            }
+
+            /* Extract powerState */
+            if (powerState != NULL)
+            {
+                *powerState = msgRx->powerState;
+            }
+        }
+    }
+
+    /* Send response */
+    if (status == SCMI_ERR_SUCCESS)
+    {
+        status = SCMI_P2aTx(channel, sizeof(header), header);
+    }
+
+    /* Release lock */
+    SCMI_P2A_UNLOCK(channel);
+
+    /* Return status */
+    return status;
+}
+
+/*--------------------------------------------------------------------------*/
+/* Read power state change requested                                        */
+/*--------------------------------------------------------------------------*/
+int32_t SCMI_PowerStateChangeRequested(uint32_t channel, uint32_t *agentId,
+    uint32_t *domainId, uint32_t *powerState)
+{
+    int32_t status;
+    uint32_t header;
+    const void *msg;
+
+    /* Acquire lock */
+    SCMI_P2A_LOCK(channel);
+
+    /* Get transport buffer address */
+    msg = SCMI_HdrAddrGet(channel);
+
+    /* Read message */
+    {
+        /* Read message structure */
+        typedef struct
+        {
+            uint32_t header;
+            uint32_t agentId;
+            uint32_t domainId;
+            uint32_t powerState;
+        } msg_rpowered33_t;
+        const msg_rpowered33_t *msgRx = (const msg_rpowered33_t*) msg;
+
+        /* Receive message */
+        status = SCMI_P2aRx(channel, COMMAND_PROTOCOL,
+            SCMI_MSG_POWER_STATE_CHANGE_REQUESTED, sizeof(msg_rpowered33_t),
+            &header);
+
+        /* Copy out if no error */
+        if (status == SCMI_ERR_SUCCESS)
+        {
+            /* Extract agentId */
+            if (agentId != NULL)
+            {
+                *agentId = msgRx->agentId;
+            }
+
+            /* Extract domainId */
+            if (domainId != NULL)
+            {
+                *domainId = msgRx->domainId;
+            }
+
+            /* Extract powerState */
+            if (powerState != NULL)
+            {
+                *powerState = msgRx->powerState;
+            }
+        }
+    }
+
+    /* Send response */
+    if (status == SCMI_ERR_SUCCESS)
+    {
+        status = SCMI_P2aTx(channel, sizeof(header), header);
+    }
+
+    /* Release lock */
+    SCMI_P2A_UNLOCK(channel);
+
+    /* Return status */
+    return status;
+}
+
+/*--------------------------------------------------------------------------*/
+/* Read async power state set completion                                    */
+/*--------------------------------------------------------------------------*/
+int32_t SCMI_PowerStateSetComplete(uint32_t channel, uint32_t *domainId)
+{
+    int32_t status;
+    int32_t setStatus = SCMI_ERR_SUCCESS;
+    uint32_t header;
+    const void *msg;
+
+    /* Acquire lock */
+    SCMI_P2A_LOCK(channel);
+
+    /* Get transport buffer address */
+    msg = SCMI_HdrAddrGet(channel);
+
+    /* Read message */
+    {
+        /* Read message structure */
+        typedef struct
+        {
+            uint32_t header;
+            int32_t status;
+            uint32_t domainId;
+        } msg_rpowerd4_t;
+        const msg_rpowerd4_t *msgRx = (const msg_rpowerd4_t*) msg;
+
+        /* Receive message */
+        status = SCMI_P2aRx(channel, COMMAND_PROTOCOL,
+            SCMI_MSG_POWER_STATE_SET_COMPLETE, sizeof(msg_rpowerd4_t),
+            &header);
+
+        /* Copy out if no error */
+        if (status == SCMI_ERR_SUCCESS)
+        {
+            /* Extract status of the change */
+            setStatus = msgRx->status;
+
+            /* Extract domainId */
+            if (domainId != NULL)
+            {
+                *domainId = msgRx->domainId;
+            }
+        }
+    }
+
+    /* Send response */
+    if (status == SCMI_ERR_SUCCESS)
+    {
+        status = SCMI_P2aTx(channel, sizeof(header), header);
+    }
+
+    /* Release lock */
+    SCMI_P2A_UNLOCK(channel);
+
+    /* Return change status if received */
+    if (status == SCMI_ERR_SUCCESS)
+    {
+        status = setStatus;
+    }
+
+    /* Return status */
+    return status;
+}
@@ -58,8 +58,18 @@
 #define SCMI_MSG_POWER_STATE_SET             0x4U
 /*! Get power state */
 #define SCMI_MSG_POWER_STATE_GET             0x5U
+/*! Configure power state change notification */
+#define SCMI_MSG_POWER_STATE_NOTIFY          0x6U
+/*! Configure power state change requested notification */
+#define SCMI_MSG_POWER_STATE_CHANGE_REQUESTED_NOTIFY  0x7U
 /*! Negotiate the protocol version */
 #define SCMI_MSG_NEGOTIATE_PROTOCOL_VERSION  0x10U
+/*! Read power state changed */
+#define SCMI_MSG_POWER_STATE_CHANGED         0x0U
+/*! Read power state change requested */
+#define SCMI_MSG_POWER_STATE_CHANGE_REQUESTED  0x1U
+/*! Read async power state set (delayed response) */
+#define SCMI_MSG_POWER_STATE_SET_COMPLETE    0x4U
 /** @} */
 
 /*!
@@ -114,6 +124,14 @@
 #define SCMI_POWER_FLAGS_ASYNC(x)  (((x) & 0x1U) << 0U)
 /** @} */
 
+/*!
+ * @name SCMI power notification flags
+ */
+/** @{ */
+/*! Notify enable */
+#define SCMI_POWER_NOTIFY_ENABLE(x)  (((x) & 0x1U) << 0U)
+/** @} */
+
 /* Functions */
 
 /*!
@@ -354,6 +372,125 @@ int32_t SCMI_PowerStateGet(uint32_t channel, uint32_t domainId,
 int32_t SCMI_PowerNegotiateProtocolVersion(uint32_t channel,
     uint32_t version);
 
+/*!
+ * Configure power state change notification.
+ *
+ * @param[in]     channel       A2P channel for comms
+ * @param[in]     domainId      Identifier for the power domain
+ * @param[in]     notifyEnable  Notify enable:<BR>
+ *                              Bits[31:1] Reserved, must be zero.<BR>
+ *                              Bit[0] If set to 1, POWER_STATE_CHANGED
+ *                              notifications are sent when the domain
+ *                              changes state. If set to 0, no
+ *                              notifications are sent
+ *
+ * This function is used by the agent to request notifications when the
+ * state of a power domain changes. See section 4.3.2.8 POWER_STATE_NOTIFY
+ * in the [SCMI Spec](@ref DOCS).
+ *
+ * Access macros:
+ * - ::SCMI_POWER_NOTIFY_ENABLE() - Notify enable
+ *
+ * @return Returns the status (::SCMI_ERR_SUCCESS = success).
+ *
+ * Return errors (see @ref SCMI_STATUS "SCMI error codes"):
+ * - ::SCMI_ERR_SUCCESS: if the notification state was successfully updated.
+ * - ::SCMI_ERR_NOT_FOUND: if \a domainId does not point to a valid power
+ *   domain.
+ * - ::SCMI_ERR_DENIED: if the calling agent is not permitted to request
+ *   this notification.
+ */
+int32_t SCMI_PowerStateNotify(uint32_t channel, uint32_t domainId,
+    uint32_t notifyEnable);
+
+/*!
+ * Configure power state change requested notification.
+ *
+ * @param[in]     channel       A2P channel for comms
+ * @param[in]     domainId      Identifier for the power domain
+ * @param[in]     notifyEnable  Notify enable:<BR>
+ *                              Bits[31:1] Reserved, must be zero.<BR>
+ *                              Bit[0] If set to 1,
+ *                              POWER_STATE_CHANGE_REQUESTED notifications
+ *                              are sent when an agent requests a state
+ *                              change. If set to 0, no notifications are
+ *                              sent
+ *
+ * This function is used by the agent to request notifications when another
+ * agent requests a power domain state change. See section 4.3.2.9
+ * POWER_STATE_CHANGE_REQUESTED_NOTIFY in the [SCMI Spec](@ref DOCS).
+ *
+ * Access macros:
+ * - ::SCMI_POWER_NOTIFY_ENABLE() - Notify enable
+ *
+ * @return Returns the status (::SCMI_ERR_SUCCESS = success).
+ *
+ * Return errors (see @ref SCMI_STATUS "SCMI error codes"):
+ * - ::SCMI_ERR_SUCCESS: if the notification state was successfully updated.
+ * - ::SCMI_ERR_NOT_FOUND: if \a domainId does not point to a valid power
+ *   domain.
+ * - ::SCMI_ERR_DENIED: if the calling agent is not permitted to request
+ *   this notification.
+ */
+int32_t SCMI_PowerStateChangeRequestedNotify(uint32_t channel,
+    uint32_t domainId, uint32_t notifyEnable);
+
+/*!
+ * Read power state changed.
+ *
+ * @param[in]     channel     P2A channel for comms
+ * @param[out]    agentId     Identifier for the agent that caused the
+ *                            change, 0 = platform
+ * @param[out]    domainId    Identifier for the power domain
+ * @param[out]    powerState  New power state of the domain
+ *
+ * This notification is issued by the platform when a power domain the
+ * agent subscribed to using SCMI_PowerStateNotify() changes state. See
+ * section 4.3.4.1 POWER_STATE_CHANGED in the [SCMI Spec](@ref DOCS).
+ *
+ * @return Returns the status (::SCMI_ERR_SUCCESS = success).
+ */
+int32_t SCMI_PowerStateChanged(uint32_t channel, uint32_t *agentId,
+    uint32_t *domainId, uint32_t *powerState);
+
+/*!
+ * Read power state change requested.
+ *
+ * @param[in]     channel     P2A channel for comms
+ * @param[out]    agentId     Identifier for the agent requesting the change
+ * @param[out]    domainId    Identifier for the power domain
+ * @param[out]    powerState  Requested power state of the domain
+ *
+ * This notification is issued by the platform when an agent requests a
+ * state change of a power domain the agent subscribed to using
+ * SCMI_PowerStateChangeRequestedNotify(). See section 4.3.4.2
+ * POWER_STATE_CHANGE_REQUESTED in the [SCMI Spec](@ref DOCS).
+ *
+ * @return Returns the status (::SCMI_ERR_SUCCESS = success).
+ */
+int32_t SCMI_PowerStateChangeRequested(uint32_t channel, uint32_t *agentId,
+    uint32_t *domainId, uint32_t *powerState);
+
+/*!
+ * Read async power state set completion.
+ *
+ * @param[in]     channel     P2A channel for comms
+ * @param[out]    domainId    Identifier for the power domain
+ *
+ * This delayed response is issued by the platform when an asynchronous
+ * SCMI_PowerStateSet() completes. It is received on the P2A channel and
+ * carries the token of the originating command. See section 4.3.3.1
+ * POWER_STATE_SET_COMPLETE in the [SCMI Spec](@ref DOCS).
+ *
+ * @return Returns the status (::SCMI_ERR_SUCCESS = success).
+ *
+ * Return errors (see @ref SCMI_STATUS "SCMI error codes"):
+ * - ::SCMI_ERR_SUCCESS: if the power domain transitioned to the requested
+ *   state.
+ * - others returned by the platform power state change.
+ */
+int32_t SCMI_PowerStateSetComplete(uint32_t channel, uint32_t *domainId);
+
 #endif /* SCMI_POWER_H */
 
 /** @} */
@@ -217,3 +217,67 @@ int32_t SCMI_ResetNegotiateProtocolVersion(uint32_t channel,
     return SCMI_NegotiateProtocolVersion(channel, COMMAND_PROTOCOL, version);
 }
 
+
+/*--------------------------------------------------------------------------*/
+/* Read async reset completion                                              */
+/*--------------------------------------------------------------------------*/
+int32_t SCMI_ResetComplete(uint32_t channel, uint32_t *domainId)
+{
+    int32_t status;
+    int32_t resetStatus = SCMI_ERR_SUCCESS;
+    uint32_t header;
+    const void *msg;
+
+    /* Acquire lock */
+    SCMI_P2A_LOCK(channel);
+
+    /* Get transport buffer address */
+    msg = SCMI_HdrAddrGet(channel);
+
+    /* Read message */
+    {
+        /* Read message structure */
+        typedef struct
+        {
+            uint32_t header;
+            int32_t status;
+            uint32_t domainId;
+        } msg_rresetd4_t;
+        const msg_rresetd4_t *msgRx = (const msg_rresetd4_t*) msg;
+
+        /* Receive message */
+        status = SCMI_P2aRx(channel, COMMAND_PROTOCOL,
+            SCMI_MSG_RESET_COMPLETE, sizeof(msg_rresetd4_t), &header);
+
+        /* Copy out if no error */
+        if (status == SCMI_ERR_SUCCESS)
+        {
+            /* Extract status of the reset */
+            resetStatus = msgRx->status;
+
+            /* Extract domainId */
+            if (domainId != NULL)
+            {
+                *domainId = msgRx->domainId;
+            }
+        }
+    }
+
+    /* Send response */
+    if (status == SCMI_ERR_SUCCESS)
+    {
+        status = SCMI_P2aTx(channel, sizeof(header), header);
+    }
+
+    /* Release lock */
+    SCMI_P2A_UNLOCK(channel);
+
+    /* Return reset status if received */
+    if (status == SCMI_ERR_SUCCESS)
+    {
+        status = resetStatus;
+    }
+
+    /* Return status */
+    return status;
+}
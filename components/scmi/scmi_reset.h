@@ -58,6 +58,8 @@
 #define SCMI_MSG_RESET                       0x4U
 /*! Negotiate the protocol version */
 #define SCMI_MSG_NEGOTIATE_PROTOCOL_VERSION  0x10U
+/*! Read async reset completion (delayed response) */
+#define SCMI_MSG_RESET_COMPLETE              0x4U
 /** @} */
 
 /*!
@@ -315,6 +317,25 @@ int32_t SCMI_Reset(uint32_t channel, uint32_t domainId, uint32_t flags,
 int32_t SCMI_ResetNegotiateProtocolVersion(uint32_t channel,
     uint32_t version);
 
+/*!
+ * Read async reset completion.
+ *
+ * @param[in]     channel   P2A channel for comms
+ * @param[out]    domainId  Identifier for the reset domain
+ *
+ * This delayed response is issued by the platform when an asynchronous
+ * SCMI_Reset() completes. It is received on the P2A channel and carries
+ * the token of the originating command. See section 4.8.3.1
+ * RESET_COMPLETE in the [SCMI Spec](@ref DOCS).
+ *
+ * @return Returns the status (::SCMI_ERR_SUCCESS = success).
+ *
+ * Return errors (see @ref SCMI_STATUS "SCMI error codes"):
+ * - ::SCMI_ERR_SUCCESS: if the reset completed.
+ * - others returned by the platform reset of the domain.
+ */
+int32_t SCMI_ResetComplete(uint32_t channel, uint32_t *domainId);
+
 #endif /* SCMI_RESET_H */
 
 /** @} */
@@ -369,15 +369,22 @@ int32_t SCMI_SensorReadingGet(uint32_t channel, uint32_t sensorId,
             SCMI_MSG_SENSOR_READING_GET, sizeof(msg_tsensord6_t), &header);
     }
 
-    /* Receive response */
+    /* Receive response, async returns status only */
     if (status == SCMI_ERR_SUCCESS)
     {
-        status = SCMI_A2pRx(channel,
-            sizeof(msg_status_t) + sizeof(uint32_t), header);
+        uint32_t minLen = sizeof(msg_status_t);
+
+        if (SCMI_SENSOR_READ_FLAGS_ASYNC(flags) == 0U)
+        {
+            minLen += sizeof(uint32_t);
+        }
+
+        status = SCMI_A2pRx(channel, minLen, header);
     }
 
     /* Copy out if no error */
-    if (status == SCMI_ERR_SUCCESS)
+    if ((status == SCMI_ERR_SUCCESS)
+        && (SCMI_SENSOR_READ_FLAGS_ASYNC(flags) == 0U))
     {
         const msg_rsensord6_t *msgRx = (const msg_rsensord6_t*) msg;
 
@@ -514,6 +521,57 @@ int32_t SCMI_SensorConfigSet(uint32_t channel, uint32_t sensorId,
     return status;
 }
 
+/*--------------------------------------------------------------------------*/
+/* Configure sensor update notification                                     */
+/*--------------------------------------------------------------------------*/
+int32_t SCMI_SensorContinuousUpdateNotify(uint32_t channel,
+    uint32_t sensorId, uint32_t notifyEnable)
+{
+    int32_t status;
+    uint32_t header;
+    void *msg;
+
+    /* Acquire lock */
+    SCMI_A2P_LOCK(channel);
+
+    /* Init buffer */
+    status = SCMI_BufInit(channel, &msg);
+
+    /* Send request */
+    if (status == SCMI_ERR_SUCCESS)
+    {
+        /* Request message structure */
+        typedef struct
+        {
+            uint32_t header;
+            uint32_t sensorId;
+            uint32_t notifyEnable;
+        } msg_tsensord11_t;
+        msg_tsensord11_t *msgTx = (msg_tsensord11_t*) msg;
+
+        /* Fill in parameters */
+        msgTx->sensorId = sensorId;
+        msgTx->notifyEnable = notifyEnable;
+
+        /* Send message */
+        status = SCMI_A2pTx(channel, COMMAND_PROTOCOL,
+            SCMI_MSG_SENSOR_CONTINUOUS_UPDATE_NOTIFY,
+            sizeof(msg_tsensord11_t), &header);
+    }
+
+    /* Receive response */
+    if (status == SCMI_ERR_SUCCESS)
+    {
+        status = SCMI_A2pRx(channel, sizeof(msg_status_t), header);
+    }
+
+    /* Release lock */
+    SCMI_A2P_UNLOCK(channel);
+
+    /* Return status */
+    return status;
+}
+
 /*--------------------------------------------------------------------------*/
 /* Negotiate the protocol version                                           */
 /*--------------------------------------------------------------------------*/
@@ -524,6 +582,156 @@ int32_t SCMI_SensorNegotiateProtocolVersion(uint32_t channel,
     return SCMI_NegotiateProtocolVersion(channel, COMMAND_PROTOCOL, version);
 }
 
+/*--------------------------------------------------------------------------*/
+/* Read sensor update                                                       */
+/*--------------------------------------------------------------------------*/
+int32_t SCMI_SensorUpdate(uint32_t channel, uint32_t *agentId,
+    uint32_t *sensorId, scmi_sensor_reading_t *readings)
+{
+    int32_t status;
+    uint32_t header;
+    const void *msg;
+
+    /* Acquire lock */
+    SCMI_P2A_LOCK(channel);
+
+    /* Get transport buffer address */
+    msg = SCMI_HdrAddrGet(channel);
+
+    /* Read message */
+    {
+        /* Read message structure */
+        typedef struct
+        {
+            uint32_t header;
+            uint32_t agentId;
+            uint32_t sensorId;
+            scmi_sensor_reading_t readings[SCMI_SENSOR_NUM_READINGS];
+        } msg_rsensored33_t;
+        const msg_rsensored33_t *msgRx = (const msg_rsensored33_t*) msg;
+
+        /* Receive message */
+        status = SCMI_P2aRx(channel, COMMAND_PROTOCOL,
+            SCMI_MSG_SENSOR_UPDATE, 3U * sizeof(uint32_t), &header);
+
+        /* Copy out if no error */
+        if (status == SCMI_ERR_SUCCESS)
+        {
+            /* Extract agentId */
+            if (agentId != NULL)
+            {
+                *agentId = msgRx->agentId;
+            }
+
+            /* Extract sensorId */
+            if (sensorId != NULL)
+            {
+                *sensorId = msgRx->sensorId;
+            }
+
+            /* Extract readings */
+            if (readings != NULL)
+            {
+                SCMI_MemCpy((uint8_t*) readings,
+                    (const uint8_t*) &msgRx->readings,
+                    (SCMI_SENSOR_NUM_READINGS
+                    * sizeof(scmi_sensor_reading_t)));
+            }
+        }
+    }
+
+    /* Send response */
+    if (status == SCMI_ERR_SUCCESS)
+    {
+        status = SCMI_P2aTx(channel, sizeof(header), header);
+    }
+
+    /* Release lock */
+    SCMI_P2A_UNLOCK(channel);
+
+    /* Return status */
+    return status;
+}
+
+/*--------------------------------------------------------------------------*/
+/* Read async sensor reading                                                */
+/*--------------------------------------------------------------------------*/
+int32_t SCMI_SensorReadingComplete(uint32_t channel, uint32_t *sensorId,
+    scmi_sensor_reading_t *readings)
+{
+    int32_t status;
+    int32_t readStatus = SCMI_ERR_SUCCESS;
+    uint32_t header;
+    const void *msg;
+
+    /* Acquire lock */
+    SCMI_P2A_LOCK(channel);
+
+    /* Get transport buffer address */
+    msg = SCMI_HdrAddrGet(channel);
+
+    /* Read message */
+    {
+        /* Read message structure */
+        typedef struct
+        {
+            uint32_t header;
+            int32_t status;
+            uint32_t sensorId;
+            scmi_sensor_reading_t readings[SCMI_SENSOR_NUM_READINGS];
+        } msg_rsensord6_t;
+        const msg_rsensord6_t *msgRx = (const msg_rsensord6_t*) msg;
+
+        /* Receive message */
+        status = SCMI_P2aRx(channel, COMMAND_PROTOCOL,
+            SCMI_MSG_SENSOR_READING_COMPLETE, sizeof(msg_status_t),
+            &header);
+
+        /* Extract status of the read */
+        if (status == SCMI_ERR_SUCCESS)
+        {
+            readStatus = msgRx->status;
+        }
+
+        /* Copy out if no error */
+        if ((status == SCMI_ERR_SUCCESS) && (readStatus == SCMI_ERR_SUCCESS))
+        {
+            /* Extract sensorId */
+            if (sensorId != NULL)
+            {
+                *sensorId = msgRx->sensorId;
+            }
+
+            /* Extract readings */
+            if (readings != NULL)
+            {
+                SCMI_MemCpy((uint8_t*) readings,
+                    (const uint8_t*) &msgRx->readings,
+                    (SCMI_SENSOR_NUM_READINGS
+                    * sizeof(scmi_sensor_reading_t)));
+            }
+        }
+    }
+
+    /* Send response */
+    if (status == SCMI_ERR_SUCCESS)
+    {
+        status = SCMI_P2aTx(channel, sizeof(header), header);
+    }
+
+    /* Release lock */
+    SCMI_P2A_UNLOCK(channel);
+
+    /* Return read status if received */
+    if (status == SCMI_ERR_SUCCESS)
+    {
+        status = readStatus;
+    }
+
+    /* Return status */
+    return status;
+}
+
 /*--------------------------------------------------------------------------*/
 /* Read sensor event                                                        */
 /*--------------------------------------------------------------------------*/
@@ -64,10 +64,16 @@
 #define SCMI_MSG_SENSOR_CONFIG_GET           0x9U
 /*! Set sensor configuration */
 #define SCMI_MSG_SENSOR_CONFIG_SET           0xAU
+/*! Configure sensor update notification */
+#define SCMI_MSG_SENSOR_CONTINUOUS_UPDATE_NOTIFY  0xBU
 /*! Negotiate the protocol version */
 #define SCMI_MSG_NEGOTIATE_PROTOCOL_VERSION  0x10U
 /*! Read sensor event */
 #define SCMI_MSG_SENSOR_TRIP_POINT_EVENT     0x0U
+/*! Read sensor update */
+#define SCMI_MSG_SENSOR_UPDATE               0x1U
+/*! Read async sensor reading (delayed response) */
+#define SCMI_MSG_SENSOR_READING_COMPLETE     0x6U
 /** @} */
 
 /*!
@@ -708,6 +714,74 @@ int32_t SCMI_SensorConfigSet(uint32_t channel, uint32_t sensorId,
 int32_t SCMI_SensorNegotiateProtocolVersion(uint32_t channel,
     uint32_t version);
 
+/*!
+ * Configure sensor update notification.
+ *
+ * @param[in]     channel       A2P channel for comms
+ * @param[in]     sensorId      Identifier for the sensor
+ * @param[in]     notifyEnable  Notify enable:<BR>
+ *                              Bits[31:1] Reserved.<BR>
+ *                              Bit[0] If set to 1, SENSOR_UPDATE
+ *                              notifications are sent at the update interval
+ *                              of the sensor. If set to 0, no notifications
+ *                              are sent
+ *
+ * This function is used by the agent to request periodic notifications of
+ * the sensor value. The interval is set using SCMI_SensorConfigSet(). See
+ * section 4.7.2.13 SENSOR_CONTINUOUS_UPDATE_NOTIFY in the
+ * [SCMI Spec](@ref DOCS).
+ *
+ * @return Returns the status (::SCMI_ERR_SUCCESS = success).
+ *
+ * Return errors (see @ref SCMI_STATUS "SCMI error codes"):
+ * - ::SCMI_ERR_SUCCESS: if the notification state was successfully updated.
+ * - ::SCMI_ERR_NOT_FOUND: if \a sensorId does not point to an existing
+ *   sensor.
+ * - ::SCMI_ERR_DENIED: if the calling agent is not permitted to request
+ *   this notification.
+ */
+int32_t SCMI_SensorContinuousUpdateNotify(uint32_t channel,
+    uint32_t sensorId, uint32_t notifyEnable);
+
+/*!
+ * Read sensor update.
+ *
+ * @param[in]     channel   P2A channel for comms
+ * @param[out]    agentId   Identifier for the agent that caused the event
+ * @param[out]    sensorId  Identifier for the sensor
+ * @param[out]    readings  Array of sensor readings
+ *
+ * This notification is issued by the platform at the update interval of a
+ * sensor the agent requested updates for using
+ * SCMI_SensorContinuousUpdateNotify(). See section 4.7.4.2 SENSOR_UPDATE
+ * in the [SCMI Spec](@ref DOCS).
+ *
+ * @return Returns the status (::SCMI_ERR_SUCCESS = success).
+ */
+int32_t SCMI_SensorUpdate(uint32_t channel, uint32_t *agentId,
+    uint32_t *sensorId, scmi_sensor_reading_t *readings);
+
+/*!
+ * Read async sensor reading.
+ *
+ * @param[in]     channel   P2A channel for comms
+ * @param[out]    sensorId  Identifier for the sensor
+ * @param[out]    readings  Array of sensor readings
+ *
+ * This delayed response is issued by the platform when an asynchronous
+ * SCMI_SensorReadingGet() completes. It is received on the P2A channel and
+ * carries the token of the originating command. See section 4.7.3.1
+ * SENSOR_READING_COMPLETE in the [SCMI Spec](@ref DOCS).
+ *
+ * @return Returns the status (::SCMI_ERR_SUCCESS = success).
+ *
+ * Return errors (see @ref SCMI_STATUS "SCMI error codes"):
+ * - ::SCMI_ERR_SUCCESS: if the reading was successfully returned.
+ * - others returned by the platform read of the sensor.
+ */
+int32_t SCMI_SensorReadingComplete(uint32_t channel, uint32_t *sensorId,
+    scmi_sensor_reading_t *readings);
+
 /*!
  * Read sensor event.
  *
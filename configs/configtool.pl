@@ -76,7 +76,7 @@ my @protocols = ('base', 'pd', 'sys', 'perf', 'clk', 'sensor',
     'rst', 'volt', 'lmm', 'gpr', 'rtc', 'button', 'cpu', 'perlpi',
     'pin', 'daisy', 'ctrl', 'fault', 'fusa');
 my @mbTypes = ('MU', 'LOOPBACK');
-my @xportTypes = ('SMT');
+my @xportTypes = ('SMT', 'MRT');
 	my @permTypes = ('none', 'get', 'notify', 'set', 'priv',
 	    'exclusive', 'all');
 my %makeInclude;
@@ -561,6 +561,7 @@ sub generate_mb
             my $x;
             my $xportType = '<invalid>';
             my %xportChannel;
+            my $mrt = 0;
             
             # Open file
             open my $out, '>', $outDir . '/' . $fileName
@@ -611,6 +612,12 @@ sub generate_mb
 	                    $xportType = 'XPORT_' . uc $parm;
 	                    $xportChannel{$xportType}++;
 					}					
+
+	                # MRT uses all data registers of the mailbox
+	                if (($xportType eq 'XPORT_MRT') && (++$mrt > 1))
+	                {
+                    	error_line('multiple mrt channels', $mb);
+	                }
 	                if ((my $parm = &param($mb, 'db')) ne '!')
 	                {
 		                print $out '        .xportType[' . $parm
@@ -637,6 +644,7 @@ sub generate_mb
 		                $x = 0;
 	                }
 	                $i++;
+	                $mrt = 0;
 
 					my $mu = $i;
 	                if ((my $parm = &param($mb, 'mu')) ne '!')
@@ -712,9 +720,9 @@ sub generate_xport
     foreach my $xpt (@xportTypes)
     {
         my $lcXpt = lc $xpt;
-        my @list = grep((/^CHANNEL\b/ && /\bxport=$lcXpt\b/)
-            || /^MAILBOX\b/ || /^LM\d*\b/, @$cfgRef);
-        my @chnList = grep(/^CHANNEL\b/, @list);
+        my @list = grep(/^CHANNEL\b/ || /^MAILBOX\b/ || /^LM\d*\b/,
+            @$cfgRef);
+        my @chnList = grep(/^CHANNEL\b/ && /\bxport=$lcXpt\b/, @list);
         my $num = @chnList;
 
         # Log xport info
@@ -785,6 +793,12 @@ sub generate_xport
 	                    $rpcChannel{$rpcType}++;
 	                }
 
+	                # Skip channels of other transports
+	                if ($mb !~ /\bxport=$lcXpt\b/)
+	                {
+	                    next;
+	                }
+
 	                # Check for default channel
 	                if ($mbType eq '<invalid>')
 	                {
@@ -810,12 +824,19 @@ sub generate_xport
 	                    print $out '        .mbDoorbell = ' . $parm
 	                        . 'U, \\' . "\n";
 	                }
-	                if ((my $parm = &param($mb, 'check')) ne '!')
+	                if (($xpt eq 'SMT')
+	                    && ((my $parm = &param($mb, 'check')) ne '!'))
 	                {
 	                    $crc{$parm}++;
 	                    print $out '        .crc = SM_SMT_CRC_'
 	                        . uc $parm . ', \\' . "\n";
 	                }
+	                if (($xpt eq 'SMT')
+	                    && ((my $parm = &param($mb, 'poll')) ne '!'))
+	                {
+	                    print $out '        .pollTime = ' . $parm
+	                        . 'U, \\' . "\n";
+	                }
 	                print $out '    }' . "\n\n";
 
 	                $i++;
@@ -1072,6 +1093,33 @@ sub generate_scmi
             {
                 print $out '        .seenvId = ' . $seenvid . 'U, \\' . "\n";
             }
+            if ((my $parm = &param($dat, 'rate')) ne '!')
+            {
+                # Check range (uint16_t)
+                if (($parm !~ /^\d+$/) || ($parm > 65535))
+                {
+                    error_line('invalid rate, must be 0-65535', $dat);
+                }
+                print $out '        .msgRate = ' . $parm . 'U, \\' . "\n";
+            }
+            if ((my $parm = &param($dat, 'burst')) ne '!')
+            {
+                # Check range (uint16_t)
+                if (($parm !~ /^\d+$/) || ($parm > 65535))
+                {
+                    error_line('invalid burst, must be 0-65535', $dat);
+                }
+                print $out '        .msgBurst = ' . $parm . 'U, \\' . "\n";
+            }
+            if ((my $parm = &param($dat, 'quota')) ne '!')
+            {
+                # Check range (uS per second)
+                if (($parm !~ /^\d+$/) || ($parm > 1000000))
+                {
+                    error_line('invalid quota, must be 0-1000000', $dat);
+                }
+                print $out '        .cpuBudget = ' . $parm . 'U, \\' . "\n";
+            }
 
             # Loop over perms
             $i = 0;
@@ -1418,6 +1466,10 @@ sub generate_lmm
 	        {
 	            print $out '        .rtime = ' . $parm . 'U, \\' . "\n";
 	        }
+	        if ((my $parm = &param($lm, 'state')) ne '!')
+	        {
+	            print $out '        .stateAddr = ' . $parm . 'U, \\' . "\n";
+	        }
 
             # Output safety type
    	        if ((my $parm = &param($lm, 'safe')) ne '!')
@@ -1527,6 +1579,22 @@ sub generate_lmm
     print $out '/*! Number of  S-EENV */' . "\n";
     print $out '#define SM_LM_NUM_SEENV  ' . ($seenvid) . 'U' . "\n\n";
 
+	# Output max LM name length
+    my $maxName = 0;
+    foreach my $lm (@lm_list)
+    {
+        if ((my $parm = &param($lm, 'name')) ne '!')
+        {
+            $parm =~ s/\"//g;
+            if (length($parm) > $maxName)
+            {
+                $maxName = length($parm);
+            }
+        }
+    }
+    print $out '/*! Max length of LM names */' . "\n";
+    print $out '#define SM_LM_MAX_NAME_LEN  ' . $maxName . 'U' . "\n\n";
+
 	# Output config name
     my ($inName, $inPath, $inSuffix) = fileparse($inputFile, '\.[^\.]*');
     print $out '/*! Config name */' . "\n";
@@ -2342,7 +2410,8 @@ sub get_tests
         # Handle channel
         if ($line =~ /^CHANNEL\b/)
         {
-            if ($line =~ /type=a2p/)
+            # Test client only supports SMT
+            if (($line =~ /type=a2p/) && ($line !~ /xport=mrt/))
             {
                 $a2p = $chn;
             }
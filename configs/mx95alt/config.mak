@@ -35,6 +35,7 @@ BOARD ?= mcimx95evk
 include ./devices/MIMX95/sm/Makefile
 include ./boards/$(BOARD)/sm/Makefile
 include ./sm/lmm/Makefile
+include ./sm/rpc/mrt/Makefile
 include ./sm/rpc/mb_mu/Makefile
 include ./sm/rpc/scmi/Makefile
 include ./sm/rpc/smt/Makefile
@@ -98,6 +98,9 @@
 /*! Number of  S-EENV */
 #define SM_LM_NUM_SEENV  0U
 
+/*! Max length of LM names */
+#define SM_LM_MAX_NAME_LEN  4U
+
 /*! Config name */
 #define SM_LM_CFG_NAME  "mx95alt"
 
@@ -71,6 +71,8 @@
         .xportChannel[1] = 1U, \
         .xportType[2] = SM_XPORT_SMT, \
         .xportChannel[2] = 2U, \
+        .xportType[3] = SM_XPORT_MRT, \
+        .xportChannel[3] = 0U, \
     }
 
 /*! Config for MU1 MB */
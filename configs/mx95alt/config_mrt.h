@@ -0,0 +1,92 @@
+/*
+** ###################################################################
+**
+** Copyright 2023-2024 NXP
+**
+** Redistribution and use in source and binary forms, with or without modification,
+** are permitted provided that the following conditions are met:
+**
+** o Redistributions of source code must retain the above copyright notice, this list
+**   of conditions and the following disclaimer.
+**
+** o Redistributions in binary form must reproduce the above copyright notice, this
+**   list of conditions and the following disclaimer in the documentation and/or
+**   other materials provided with the distribution.
+**
+** o Neither the name of the copyright holder nor the names of its
+**   contributors may be used to endorse or promote products derived from this
+**   software without specific prior written permission.
+**
+** THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+** ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+** WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+** DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+** ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+** (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+** LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+** ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+** (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+** SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+**
+**
+** ###################################################################
+*/
+
+/*==========================================================================*/
+/*!
+ * @addtogroup CONFIG_MX95ALT
+ * @{
+ *
+ * @file
+ * @brief
+ *
+ * Header file containing coniguration info for the MRT.
+ */
+/*==========================================================================*/
+
+#ifndef CONFIG_MRT_H
+#define CONFIG_MRT_H
+
+/* Includes */
+
+#include "rpc_mrt_config.h"
+
+/* Defines */
+
+/*--------------------------------------------------------------------------*/
+/* LM0 MRT Config (SM)                                                      */
+/*--------------------------------------------------------------------------*/
+
+/*--------------------------------------------------------------------------*/
+/* LM1 MRT Config (Boot)                                                    */
+/*--------------------------------------------------------------------------*/
+
+/*! Config for MRT channel 0 */
+#define SM_MRT_CHN0_CONFIG \
+    { \
+        .rpcType = SM_RPC_SCMI, \
+        .rpcChannel = 3U, \
+        .mbType = SM_MB_MU, \
+        .mbInst = 0U, \
+        .mbDoorbell = 3U, \
+    }
+
+/*--------------------------------------------------------------------------*/
+/* MRT Config                                                               */
+/*--------------------------------------------------------------------------*/
+
+/*! Config for number of MRT channels */
+#define SM_NUM_MRT_CHN  1U
+
+/*! Config data array for MRT channels */
+#define SM_MRT_CHN_CONFIG_DATA \
+    SM_MRT_CHN0_CONFIG
+
+/* Mailbox and CRC types to support */
+/*! Config for MB_MU USE */
+#define USES_MB_MU
+
+#endif /* CONFIG_MRT_H */
+
+/** @} */
+
@@ -348,6 +348,9 @@
         .pdPerms[DEV_SM_PD_NETC] = SM_SCMI_PERM_ALL, \
         .pdPerms[DEV_SM_PD_NPU] = SM_SCMI_PERM_ALL, \
         .pdPerms[DEV_SM_PD_VPU] = SM_SCMI_PERM_ALL, \
+        .perfPerms[DEV_SM_PERF_A55C01] = SM_SCMI_PERM_ALL, \
+        .perfPerms[DEV_SM_PERF_A55C23] = SM_SCMI_PERM_ALL, \
+        .perfPerms[DEV_SM_PERF_A55C45] = SM_SCMI_PERM_ALL, \
         .perfPerms[DEV_SM_PERF_A55] = SM_SCMI_PERM_ALL, \
         .perfPerms[DEV_SM_PERF_CAM] = SM_SCMI_PERM_ALL, \
         .perfPerms[DEV_SM_PERF_DISP] = SM_SCMI_PERM_ALL, \
@@ -533,6 +536,15 @@
         .xportChannel = 2U, \
     }
 
+/*! Config for SCMI channel 3 */
+#define SM_SCMI_CHN3_CONFIG \
+    { \
+        .agentId = 0U, \
+        .type = SM_SCMI_CHN_A2P, \
+        .xportType = SM_XPORT_MRT, \
+        .xportChannel = 0U, \
+    }
+
 /*--------------------------------------------------------------------------*/
 /* SCMI AGENT1 Config (AP-S)                                                */
 /*--------------------------------------------------------------------------*/
@@ -832,6 +844,9 @@
         .pdPerms[DEV_SM_PD_NETC] = SM_SCMI_PERM_ALL, \
         .pdPerms[DEV_SM_PD_NPU] = SM_SCMI_PERM_ALL, \
         .pdPerms[DEV_SM_PD_VPU] = SM_SCMI_PERM_ALL, \
+        .perfPerms[DEV_SM_PERF_A55C01] = SM_SCMI_PERM_ALL, \
+        .perfPerms[DEV_SM_PERF_A55C23] = SM_SCMI_PERM_ALL, \
+        .perfPerms[DEV_SM_PERF_A55C45] = SM_SCMI_PERM_ALL, \
         .perfPerms[DEV_SM_PERF_A55] = SM_SCMI_PERM_ALL, \
         .perfPerms[DEV_SM_PERF_CAM] = SM_SCMI_PERM_ALL, \
         .perfPerms[DEV_SM_PERF_DISP] = SM_SCMI_PERM_ALL, \
@@ -990,8 +1005,8 @@
         .sysPerms = SM_SCMI_PERM_ALL, \
     }
 
-/*! Config for SCMI channel 3 */
-#define SM_SCMI_CHN3_CONFIG \
+/*! Config for SCMI channel 4 */
+#define SM_SCMI_CHN4_CONFIG \
     { \
         .agentId = 1U, \
         .type = SM_SCMI_CHN_A2P, \
@@ -999,8 +1014,8 @@
         .xportChannel = 3U, \
     }
 
-/*! Config for SCMI channel 4 */
-#define SM_SCMI_CHN4_CONFIG \
+/*! Config for SCMI channel 5 */
+#define SM_SCMI_CHN5_CONFIG \
     { \
         .agentId = 1U, \
         .type = SM_SCMI_CHN_P2A_NOTIFY, \
@@ -1307,6 +1322,9 @@
         .pdPerms[DEV_SM_PD_NETC] = SM_SCMI_PERM_ALL, \
         .pdPerms[DEV_SM_PD_NPU] = SM_SCMI_PERM_ALL, \
         .pdPerms[DEV_SM_PD_VPU] = SM_SCMI_PERM_ALL, \
+        .perfPerms[DEV_SM_PERF_A55C01] = SM_SCMI_PERM_ALL, \
+        .perfPerms[DEV_SM_PERF_A55C23] = SM_SCMI_PERM_ALL, \
+        .perfPerms[DEV_SM_PERF_A55C45] = SM_SCMI_PERM_ALL, \
         .perfPerms[DEV_SM_PERF_A55] = SM_SCMI_PERM_ALL, \
         .perfPerms[DEV_SM_PERF_CAM] = SM_SCMI_PERM_ALL, \
         .perfPerms[DEV_SM_PERF_DISP] = SM_SCMI_PERM_ALL, \
@@ -1465,8 +1483,8 @@
         .sysPerms = SM_SCMI_PERM_ALL, \
     }
 
-/*! Config for SCMI channel 5 */
-#define SM_SCMI_CHN5_CONFIG \
+/*! Config for SCMI channel 6 */
+#define SM_SCMI_CHN6_CONFIG \
     { \
         .agentId = 2U, \
         .type = SM_SCMI_CHN_A2P, \
@@ -1474,8 +1492,8 @@
         .xportChannel = 5U, \
     }
 
-/*! Config for SCMI channel 6 */
-#define SM_SCMI_CHN6_CONFIG \
+/*! Config for SCMI channel 7 */
+#define SM_SCMI_CHN7_CONFIG \
     { \
         .agentId = 2U, \
         .type = SM_SCMI_CHN_P2A_NOTIFY, \
@@ -1513,7 +1531,7 @@
 /*--------------------------------------------------------------------------*/
 
 /*! Config for number of SCMI channels */
-#define SM_SCMI_NUM_CHN  7U
+#define SM_SCMI_NUM_CHN  8U
 
 /*! Config data array for SCMI channels */
 #define SM_SCMI_CHN_CONFIG_DATA \
@@ -1523,7 +1541,8 @@
     SM_SCMI_CHN3_CONFIG, \
     SM_SCMI_CHN4_CONFIG, \
     SM_SCMI_CHN5_CONFIG, \
-    SM_SCMI_CHN6_CONFIG
+    SM_SCMI_CHN6_CONFIG, \
+    SM_SCMI_CHN7_CONFIG
 
 /*--------------------------------------------------------------------------*/
 /* SCMI Config                                                              */
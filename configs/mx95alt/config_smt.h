@@ -98,7 +98,7 @@
 #define SM_SMT_CHN3_CONFIG \
     { \
         .rpcType = SM_RPC_SCMI, \
-        .rpcChannel = 3U, \
+        .rpcChannel = 4U, \
         .mbType = SM_MB_MU, \
         .mbInst = 1U, \
         .mbDoorbell = 0U, \
@@ -108,7 +108,7 @@
 #define SM_SMT_CHN4_CONFIG \
     { \
         .rpcType = SM_RPC_SCMI, \
-        .rpcChannel = 4U, \
+        .rpcChannel = 5U, \
         .mbType = SM_MB_MU, \
         .mbInst = 1U, \
         .mbDoorbell = 1U, \
@@ -118,7 +118,7 @@
 #define SM_SMT_CHN5_CONFIG \
     { \
         .rpcType = SM_RPC_SCMI, \
-        .rpcChannel = 5U, \
+        .rpcChannel = 6U, \
         .mbType = SM_MB_MU, \
         .mbInst = 2U, \
         .mbDoorbell = 0U, \
@@ -128,7 +128,7 @@
 #define SM_SMT_CHN6_CONFIG \
     { \
         .rpcType = SM_RPC_SCMI, \
-        .rpcChannel = 6U, \
+        .rpcChannel = 7U, \
         .mbType = SM_MB_MU, \
         .mbInst = 2U, \
         .mbDoorbell = 1U, \
@@ -84,29 +84,37 @@
 /*! Config for test channel 3 */
 #define SM_TEST_CHN3_CONFIG \
     { \
-        .mbInst = 0U, \
-        .mbDoorbell = 0U, \
-        .agentId = 1U, \
+        .mbInst = 8U, \
+        .mbDoorbell = 3U, \
+        .agentId = 0U, \
     }
 
 /*! Config for test channel 4 */
 #define SM_TEST_CHN4_CONFIG \
     { \
         .mbInst = 0U, \
-        .mbDoorbell = 1U, \
+        .mbDoorbell = 0U, \
         .agentId = 1U, \
     }
 
 /*! Config for test channel 5 */
 #define SM_TEST_CHN5_CONFIG \
+    { \
+        .mbInst = 0U, \
+        .mbDoorbell = 1U, \
+        .agentId = 1U, \
+    }
+
+/*! Config for test channel 6 */
+#define SM_TEST_CHN6_CONFIG \
     { \
         .mbInst = 2U, \
         .mbDoorbell = 0U, \
         .agentId = 2U, \
     }
 
-/*! Config for test channel 6 */
-#define SM_TEST_CHN6_CONFIG \
+/*! Config for test channel 7 */
+#define SM_TEST_CHN7_CONFIG \
     { \
         .mbInst = 2U, \
         .mbDoorbell = 1U, \
@@ -118,7 +126,7 @@
 /*--------------------------------------------------------------------------*/
 
 /*! Config for number of test channels */
-#define SM_NUM_TEST_CHN  7U
+#define SM_NUM_TEST_CHN  8U
 
 /*! Config data array for test channels */
 #define SM_TEST_CHN_CONFIG_DATA \
@@ -128,7 +136,8 @@
     SM_TEST_CHN3_CONFIG, \
     SM_TEST_CHN4_CONFIG, \
     SM_TEST_CHN5_CONFIG, \
-    SM_TEST_CHN6_CONFIG
+    SM_TEST_CHN6_CONFIG, \
+    SM_TEST_CHN7_CONFIG
 
 /*--------------------------------------------------------------------------*/
 /* Test Config                                                              */
@@ -117,6 +117,9 @@
 /*! Number of  S-EENV */
 #define SM_LM_NUM_SEENV  1U
 
+/*! Max length of LM names */
+#define SM_LM_MAX_NAME_LEN  2U
+
 /*! Config name */
 #define SM_LM_CFG_NAME  "mx95evk"
 
@@ -188,6 +188,9 @@
         .pdPerms[DEV_SM_PD_A55C4] = SM_SCMI_PERM_ALL, \
         .pdPerms[DEV_SM_PD_A55C5] = SM_SCMI_PERM_ALL, \
         .pdPerms[DEV_SM_PD_A55P] = SM_SCMI_PERM_ALL, \
+        .perfPerms[DEV_SM_PERF_A55C01] = SM_SCMI_PERM_ALL, \
+        .perfPerms[DEV_SM_PERF_A55C23] = SM_SCMI_PERM_ALL, \
+        .perfPerms[DEV_SM_PERF_A55C45] = SM_SCMI_PERM_ALL, \
         .perfPerms[DEV_SM_PERF_A55] = SM_SCMI_PERM_ALL, \
         .perfPerms[DEV_SM_PERF_DRAM] = SM_SCMI_PERM_ALL, \
         .perlpiPerms[DEV_SM_PERLPI_CAN2] = SM_SCMI_PERM_ALL, \
@@ -463,6 +466,9 @@
         .pdPerms[DEV_SM_PD_NETC] = SM_SCMI_PERM_ALL, \
         .pdPerms[DEV_SM_PD_NPU] = SM_SCMI_PERM_ALL, \
         .pdPerms[DEV_SM_PD_VPU] = SM_SCMI_PERM_ALL, \
+        .perfPerms[DEV_SM_PERF_A55C01] = SM_SCMI_PERM_ALL, \
+        .perfPerms[DEV_SM_PERF_A55C23] = SM_SCMI_PERM_ALL, \
+        .perfPerms[DEV_SM_PERF_A55C45] = SM_SCMI_PERM_ALL, \
         .perfPerms[DEV_SM_PERF_A55] = SM_SCMI_PERM_ALL, \
         .perfPerms[DEV_SM_PERF_CAM] = SM_SCMI_PERM_ALL, \
         .perfPerms[DEV_SM_PERF_DISP] = SM_SCMI_PERM_ALL, \
@@ -73,6 +73,7 @@
         .rpcType = SM_RPC_SCMI, \
         .rpcInst = 0U, \
         .boot[0] = 2U, \
+        .stateAddr = 0x20480000U, \
         .safeType = LMM_SAFE_TYPE_SEENV, \
         .start = 1U, \
         .stop = 1U, \
@@ -89,6 +90,7 @@
         .rpcType = SM_RPC_SCMI, \
         .rpcInst = 1U, \
         .boot[0] = 3U, \
+        .stateAddr = 0x20481000U, \
         .safeType = LMM_SAFE_TYPE_SEENV, \
         .start = 5U, \
         .stop = 5U, \
@@ -126,7 +128,10 @@
 #define SM_LM_NUM_MSEL  1U
 
 /*! Number of  S-EENV */
-#define SM_LM_NUM_SEENV  4U
+#define SM_LM_NUM_SEENV  5U
+
+/*! Max length of LM names */
+#define SM_LM_MAX_NAME_LEN  4U
 
 /*! Config name */
 #define SM_LM_CFG_NAME  "simu"
@@ -107,19 +107,27 @@
         .xportChannel[1] = 8U, \
     }
 
+/*! Config for LOOPBACK4 MB */
+#define SM_MB_LOOPBACK4_CONFIG \
+    { \
+        .xportType[0] = SM_XPORT_SMT, \
+        .xportChannel[0] = 9U, \
+    }
+
 /*--------------------------------------------------------------------------*/
 /* MB LOOPBACK Config                                                       */
 /*--------------------------------------------------------------------------*/
 
 /*! Config for number of LOOPBACK MB */
-#define SM_NUM_MB_LOOPBACK  4U
+#define SM_NUM_MB_LOOPBACK  5U
 
 /*! Config data array for LOOPBACK MB */
 #define SM_MB_LOOPBACK_CONFIG_DATA \
     SM_MB_LOOPBACK0_CONFIG, \
     SM_MB_LOOPBACK1_CONFIG, \
     SM_MB_LOOPBACK2_CONFIG, \
-    SM_MB_LOOPBACK3_CONFIG
+    SM_MB_LOOPBACK3_CONFIG, \
+    SM_MB_LOOPBACK4_CONFIG
 
 #endif /* CONFIG_MB_LOOPBACK_H */
 
@@ -263,6 +263,31 @@
         .xportChannel = 8U, \
     }
 
+/*--------------------------------------------------------------------------*/
+/* SCMI AGENT4 Config (TEST-RATE)                                           */
+/*--------------------------------------------------------------------------*/
+
+/*! Config for SCMI agent 4 */
+#define SM_SCMI_AGNT4_CONFIG \
+    { \
+        .name = "TEST-RATE", \
+        .scmiInst = 2U, \
+        .domId = 16U, \
+        .secure = 0U, \
+        .seenvId = 5U, \
+        .msgRate = 20U, \
+        .msgBurst = 8U, \
+    }
+
+/*! Config for SCMI channel 9 */
+#define SM_SCMI_CHN9_CONFIG \
+    { \
+        .agentId = 4U, \
+        .type = SM_SCMI_CHN_A2P, \
+        .xportType = SM_XPORT_SMT, \
+        .xportChannel = 9U, \
+    }
+
 /*--------------------------------------------------------------------------*/
 /* SCMI Instance 2 Config (TEST)                                            */
 /*--------------------------------------------------------------------------*/
@@ -271,7 +296,7 @@
 #define SM_SCMI2_CONFIG \
     { \
         .lmId = 3U, \
-        .numAgents = 1U, \
+        .numAgents = 2U, \
         .firstAgent = 3U, \
     }
 
@@ -280,21 +305,22 @@
 /*--------------------------------------------------------------------------*/
 
 /*! Config for number of SCMI agents */
-#define SM_SCMI_NUM_AGNT  4U
+#define SM_SCMI_NUM_AGNT  5U
 
 /*! Config data array for SCMI agents */
 #define SM_SCMI_AGNT_CONFIG_DATA \
     SM_SCMI_AGNT0_CONFIG, \
     SM_SCMI_AGNT1_CONFIG, \
     SM_SCMI_AGNT2_CONFIG, \
-    SM_SCMI_AGNT3_CONFIG
+    SM_SCMI_AGNT3_CONFIG, \
+    SM_SCMI_AGNT4_CONFIG
 
 /*--------------------------------------------------------------------------*/
 /* SCMI Channel Config                                                      */
 /*--------------------------------------------------------------------------*/
 
 /*! Config for number of SCMI channels */
-#define SM_SCMI_NUM_CHN  9U
+#define SM_SCMI_NUM_CHN  10U
 
 /*! Config data array for SCMI channels */
 #define SM_SCMI_CHN_CONFIG_DATA \
@@ -306,7 +332,8 @@
     SM_SCMI_CHN5_CONFIG, \
     SM_SCMI_CHN6_CONFIG, \
     SM_SCMI_CHN7_CONFIG, \
-    SM_SCMI_CHN8_CONFIG
+    SM_SCMI_CHN8_CONFIG, \
+    SM_SCMI_CHN9_CONFIG
 
 /*--------------------------------------------------------------------------*/
 /* SCMI Config                                                              */
@@ -70,6 +70,7 @@
         .mbInst = 0U, \
         .mbDoorbell = 0U, \
         .crc = SM_SMT_CRC_CRC32, \
+        .pollTime = 2U, \
     }
 
 /*! Config for SMT channel 1 */
@@ -166,12 +167,22 @@
         .crc = SM_SMT_CRC_J1850, \
     }
 
+/*! Config for SMT channel 9 */
+#define SM_SMT_CHN9_CONFIG \
+    { \
+        .rpcType = SM_RPC_SCMI, \
+        .rpcChannel = 9U, \
+        .mbType = SM_MB_LOOPBACK, \
+        .mbInst = 4U, \
+        .mbDoorbell = 0U, \
+    }
+
 /*--------------------------------------------------------------------------*/
 /* SMT Config                                                               */
 /*--------------------------------------------------------------------------*/
 
 /*! Config for number of SMT channels */
-#define SM_NUM_SMT_CHN  9U
+#define SM_NUM_SMT_CHN  10U
 
 /*! Config data array for SMT channels */
 #define SM_SMT_CHN_CONFIG_DATA \
@@ -183,7 +194,8 @@
     SM_SMT_CHN5_CONFIG, \
     SM_SMT_CHN6_CONFIG, \
     SM_SMT_CHN7_CONFIG, \
-    SM_SMT_CHN8_CONFIG
+    SM_SMT_CHN8_CONFIG, \
+    SM_SMT_CHN9_CONFIG
 
 /* Mailbox and CRC types to support */
 /*! Config for MB_LOOPBACK USE */
@@ -137,12 +137,20 @@
         .agentId = 3U, \
     }
 
+/*! Config for test channel 9 */
+#define SM_TEST_CHN9_CONFIG \
+    { \
+        .mbInst = 4U, \
+        .mbDoorbell = 0U, \
+        .agentId = 4U, \
+    }
+
 /*--------------------------------------------------------------------------*/
 /* Test Channel Config                                                      */
 /*--------------------------------------------------------------------------*/
 
 /*! Config for number of test channels */
-#define SM_NUM_TEST_CHN  9U
+#define SM_NUM_TEST_CHN  10U
 
 /*! Config data array for test channels */
 #define SM_TEST_CHN_CONFIG_DATA \
@@ -154,7 +162,8 @@
     SM_TEST_CHN5_CONFIG, \
     SM_TEST_CHN6_CONFIG, \
     SM_TEST_CHN7_CONFIG, \
-    SM_TEST_CHN8_CONFIG
+    SM_TEST_CHN8_CONFIG, \
+    SM_TEST_CHN9_CONFIG
 
 /*--------------------------------------------------------------------------*/
 /* Test Config                                                              */
@@ -261,6 +261,30 @@ bool CCM_RootMuxInputGet(uint32_t rootIdx, uint32_t muxIdx,
     return rc;
 }
 
+/*--------------------------------------------------------------------------*/
+/* Get mux select of a clock source for CCM root                            */
+/*--------------------------------------------------------------------------*/
+bool CCM_RootMuxSelGet(uint32_t rootIdx, uint32_t sourceIdx,
+    uint32_t *muxIdx)
+{
+    bool rc = false;
+
+    if ((rootIdx < CLOCK_NUM_ROOT) && (sourceIdx < CLOCK_NUM_SRC))
+    {
+        uint32_t muxType = g_clockRootMuxType[rootIdx];
+        uint32_t muxSel = g_clockMuxTypeSel[muxType][sourceIdx];
+
+        /* Source is a mux input? */
+        if ((muxSel & CLOCK_MUX_SEL_VALID) != 0U)
+        {
+            *muxIdx = muxSel & ~CLOCK_MUX_SEL_VALID;
+            rc = true;
+        }
+    }
+
+    return rc;
+}
+
 /*--------------------------------------------------------------------------*/
 /* Get CCM root parent                                                      */
 /*--------------------------------------------------------------------------*/
@@ -289,34 +313,18 @@ bool CCM_RootGetParent(uint32_t rootIdx, uint32_t *sourceIdx)
 /*--------------------------------------------------------------------------*/
 bool CCM_RootSetParent(uint32_t rootIdx, uint32_t sourceIdx)
 {
-    bool updateParent = false;
+    uint32_t rootMux = 0U;
 
-    if (rootIdx < CLOCK_NUM_ROOT)
-    {
-        uint32_t rootMux = 0U;
+    /* Translate source to mux */
+    bool updateParent = CCM_RootMuxSelGet(rootIdx, sourceIdx, &rootMux);
 
-        /* Translate source to mux */
-        while ((!updateParent) && (rootMux < CLOCK_NUM_ROOT_MUX_SEL))
-        {
-            if (sourceIdx == g_clockRootMux[rootIdx][rootMux])
-            {
-                updateParent = true;
-            }
-            else
-            {
-                rootMux++;
-            }
-        }
-
-        /* Found in mux tables? */
-        if (updateParent)
-        {
-            uint32_t cr =
-                CCM_CTRL->CLOCK_ROOT[rootIdx].CLOCK_ROOT_CONTROL.RW;
-            cr &= (~(CCM_CLOCK_ROOT_MUX_MASK));
-            cr |= CCM_CLOCK_ROOT_MUX(rootMux);
-            CCM_CTRL->CLOCK_ROOT[rootIdx].CLOCK_ROOT_CONTROL.RW = cr;
-        }
+    /* Found in mux tables? */
+    if (updateParent)
+    {
+        uint32_t cr = CCM_CTRL->CLOCK_ROOT[rootIdx].CLOCK_ROOT_CONTROL.RW;
+        cr &= (~(CCM_CLOCK_ROOT_MUX_MASK));
+        cr |= CCM_CLOCK_ROOT_MUX(rootMux);
+        CCM_CTRL->CLOCK_ROOT[rootIdx].CLOCK_ROOT_CONTROL.RW = cr;
     }
 
     return updateParent;
@@ -130,6 +130,22 @@ bool CCM_RootMuxNumInputsGet(uint32_t rootIdx, uint32_t *numMuxInputs);
 bool CCM_RootMuxInputGet(uint32_t rootIdx, uint32_t muxIdx,
     uint32_t *muxInput);
 
+/*!
+ * Get mux select of a clock source for CCM clock root
+ *
+ * @param[in]       rootIdx     CCM clock root ID
+ * @param[in]       sourceIdx   Clock source ID
+ * @param[out]      muxIdx      Clock root mux ID
+ *
+ * This function returns the mux select of \a sourceIdx for given
+ * \a rootIdx. It is the reverse of CCM_RootMuxInputGet() and uses the
+ * device reverse mux map rather than scanning the mux inputs.
+ *
+ * @return Returns true if \a sourceIdx is a mux input of the clock root.
+ */
+bool CCM_RootMuxSelGet(uint32_t rootIdx, uint32_t sourceIdx,
+    uint32_t *muxIdx);
+
 /*!
  * Get CCM clock root parent
  *
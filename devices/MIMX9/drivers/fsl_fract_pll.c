@@ -271,6 +271,41 @@ bool FRACTPLL_UpdateRate(uint32_t pllIdx, uint32_t mfi, uint32_t mfn,
     return updateRate;
 }
 
+/*--------------------------------------------------------------------------*/
+/* Check PLL clock rate                                                     */
+/*--------------------------------------------------------------------------*/
+bool FRACTPLL_CheckRate(uint32_t pllIdx, uint32_t mfi, uint32_t mfn,
+    uint32_t odiv)
+{
+    bool rateSet = false;
+
+    if ((pllIdx < CLOCK_NUM_PLL) && (s_sscConfig[pllIdx].enable != 1U))
+    {
+        const PLL_Type *pll = s_pllPtrs[pllIdx];
+        uint32_t ctrlMask = PLL_CTRL_POWERUP_MASK | PLL_CTRL_CLKMUX_EN_MASK
+            | PLL_CTRL_CLKMUX_BYPASS_MASK;
+        uint32_t divMask = PLL_DIV_MFI_MASK | PLL_DIV_RDIV_MASK
+            | PLL_DIV_ODIV_MASK;
+
+        /* Powered, locked, not bypassed, and same dividers */
+        rateSet = ((pll->CTRL.RW & ctrlMask)
+            == (PLL_CTRL_POWERUP_MASK | PLL_CTRL_CLKMUX_EN_MASK))
+            && ((pll->PLL_STATUS & PLL_PLL_STATUS_PLL_LOCK_MASK) != 0U)
+            && ((pll->DIV.RW & divMask) == (PLL_DIV_MFI(mfi)
+            | PLL_DIV_RDIV(0U) | PLL_DIV_ODIV(odiv)));
+
+        /* Check fractional part */
+        if (rateSet && g_pllAttrs[pllIdx].isFrac)
+        {
+            rateSet = (pll->NUMERATOR.RW == PLL_NUMERATOR_MFN(mfn))
+                && (pll->DENOMINATOR.RW
+                == PLL_DENOMINATOR_MFD(CLOCK_PLL_MFD));
+        }
+    }
+
+    return rateSet;
+}
+
 /*--------------------------------------------------------------------------*/
 /* Set PLL clock rate                                                       */
 /*--------------------------------------------------------------------------*/
@@ -502,6 +537,38 @@ bool FRACTPLL_UpdateDfsRate(uint32_t pllIdx, uint8_t dfsIdx, uint32_t mfi,
     return updateRate;
 }
 
+/*--------------------------------------------------------------------------*/
+/* Check PLL DFS rate                                                       */
+/*--------------------------------------------------------------------------*/
+bool FRACTPLL_CheckDfsRate(uint32_t pllIdx, uint8_t dfsIdx, uint32_t mfi,
+    uint32_t mfn)
+{
+    bool rateSet = false;
+
+    if (pllIdx < CLOCK_NUM_PLL)
+    {
+        if (dfsIdx < g_pllAttrs[pllIdx].numDFS)
+        {
+            const PLL_Type *pll = s_pllPtrs[pllIdx];
+            uint32_t ctrlMask = PLL_NO_OF_DFS_CLKOUT_EN_MASK
+                | PLL_NO_OF_DFS_ENABLE_MASK | PLL_NO_OF_DFS_BYPASS_EN_MASK;
+            uint32_t divMask = PLL_NO_OF_DFS_MFI_MASK
+                | PLL_NO_OF_DFS_MFN_MASK;
+            uint32_t dfsOkMask = 1UL << dfsIdx;
+
+            /* Enabled, valid, not bypassed, and same dividers */
+            rateSet = ((pll->NO_OF_DFS[dfsIdx].DFS_CTRL.RW & ctrlMask)
+                == (PLL_NO_OF_DFS_CLKOUT_EN_MASK
+                | PLL_NO_OF_DFS_ENABLE_MASK))
+                && ((pll->DFS_STATUS & dfsOkMask) != 0U)
+                && ((pll->NO_OF_DFS[dfsIdx].DFS_DIV.RW & divMask)
+                == (PLL_NO_OF_DFS_MFI(mfi) | PLL_NO_OF_DFS_MFN(mfn)));
+        }
+    }
+
+    return rateSet;
+}
+
 /*--------------------------------------------------------------------------*/
 /* Set PLL DFS rate                                                         */
 /*--------------------------------------------------------------------------*/
@@ -141,6 +141,23 @@ uint64_t FRACTPLL_GetRate(uint32_t pllIdx, bool vcoOp);
 bool FRACTPLL_UpdateRate(uint32_t pllIdx, uint32_t mfi, uint32_t mfn,
     uint32_t odiv);
 
+/*!
+ * Check PLL clock rate
+ *
+ * @param[in]   pllIdx      PLL identifier
+ * @param[in]   mfi         Integer portion of loop divider
+ * @param[in]   mfn         Numerator of fractional loop divider
+ * @param[in]   odiv        Output frequency divider for clock output
+ *
+ * This function allows caller to check if the PLL is powered, locked, and
+ * running with the given mfi, mfn and odiv, so FRACTPLL_UpdateRate() can be
+ * skipped. Always false if spread spectrum is enabled.
+ *
+ * @return Returns true if PLL is running at the given rate.
+ */
+bool FRACTPLL_CheckRate(uint32_t pllIdx, uint32_t mfi, uint32_t mfn,
+    uint32_t odiv);
+
 /*!
  * Set PLL clock rate
  *
@@ -215,6 +232,23 @@ uint64_t FRACTPLL_GetDfsRate(uint32_t pllIdx, uint8_t dfsIdx, bool div2);
 bool FRACTPLL_UpdateDfsRate(uint32_t pllIdx, uint8_t dfsIdx, uint32_t mfi,
     uint32_t mfn);
 
+/*!
+ * Check PLL DFS rate
+ *
+ * @param[in]   pllIdx      PLL identifier
+ * @param[in]   dfsIdx      DFS identifier
+ * @param[in]   mfi         Integer portion of loop divider
+ * @param[in]   mfn         Numerator of fractional loop divider
+ *
+ * This function allows caller to check if the PLL's DFS is enabled and
+ * running with the given mfi and mfn, so FRACTPLL_UpdateDfsRate() can be
+ * skipped.
+ *
+ * @return Returns true if PLL DFS is running at the given rate.
+ */
+bool FRACTPLL_CheckDfsRate(uint32_t pllIdx, uint8_t dfsIdx, uint32_t mfi,
+    uint32_t mfn);
+
 /*!
  * Set PLL DFS rate
  *
@@ -738,6 +738,201 @@ const uint8_t g_clockRootMux[CLOCK_NUM_ROOT][CLOCK_NUM_ROOT_MUX_SEL] =
     [CLOCK_ROOT_XSPISLVROOT][3] = CLOCK_SRC_SYSPLL1_PFD2
 };
 
+/* Reverse of g_clockRootMux. Roots with the same mux inputs share a mux
+ * type. A source repeated on a mux maps to its first (lowest) input.
+ */
+const uint8_t g_clockRootMuxType[CLOCK_NUM_ROOT] =
+{
+    [CLOCK_ROOT_ADC] = CLOCK_MUX_TYPE_ADC,
+    [CLOCK_ROOT_TMU] = CLOCK_MUX_TYPE_ADC,
+    [CLOCK_ROOT_BUSAON] = CLOCK_MUX_TYPE_ADC,
+    [CLOCK_ROOT_CAN1] = CLOCK_MUX_TYPE_ADC,
+    [CLOCK_ROOT_I3C1] = CLOCK_MUX_TYPE_ADC,
+    [CLOCK_ROOT_I3C1SLOW] = CLOCK_MUX_TYPE_ADC,
+    [CLOCK_ROOT_LPI2C1] = CLOCK_MUX_TYPE_ADC,
+    [CLOCK_ROOT_LPI2C2] = CLOCK_MUX_TYPE_ADC,
+    [CLOCK_ROOT_LPSPI1] = CLOCK_MUX_TYPE_ADC,
+    [CLOCK_ROOT_LPSPI2] = CLOCK_MUX_TYPE_ADC,
+    [CLOCK_ROOT_LPTMR1] = CLOCK_MUX_TYPE_ADC,
+    [CLOCK_ROOT_LPUART1] = CLOCK_MUX_TYPE_ADC,
+    [CLOCK_ROOT_LPUART2] = CLOCK_MUX_TYPE_ADC,
+    [CLOCK_ROOT_M33] = CLOCK_MUX_TYPE_M33,
+    [CLOCK_ROOT_M33SYSTICK] = CLOCK_MUX_TYPE_ADC,
+    [CLOCK_ROOT_MQS1] = CLOCK_MUX_TYPE_MQS1,
+    [CLOCK_ROOT_PDM] = CLOCK_MUX_TYPE_MQS1,
+    [CLOCK_ROOT_SAI1] = CLOCK_MUX_TYPE_MQS1,
+    [CLOCK_ROOT_SENTINEL] = CLOCK_MUX_TYPE_M33,
+    [CLOCK_ROOT_TPM2] = CLOCK_MUX_TYPE_TPM2,
+    [CLOCK_ROOT_TSTMR1] = CLOCK_MUX_TYPE_ADC,
+    [CLOCK_ROOT_CAMAPB] = CLOCK_MUX_TYPE_ADC,
+    [CLOCK_ROOT_CAMAXI] = CLOCK_MUX_TYPE_CAMAXI,
+    [CLOCK_ROOT_CAMCM0] = CLOCK_MUX_TYPE_CAMAXI,
+    [CLOCK_ROOT_CAMISI] = CLOCK_MUX_TYPE_CAMAXI,
+    [CLOCK_ROOT_MIPIPHYCFG] = CLOCK_MUX_TYPE_MIPIPHYCFG,
+    [CLOCK_ROOT_MIPIPHYPLLBYPASS] = CLOCK_MUX_TYPE_MIPIPHYCFG,
+    [CLOCK_ROOT_MIPIPHYPLLREF] = CLOCK_MUX_TYPE_MIPIPHYCFG,
+    [CLOCK_ROOT_MIPITESTBYTE] = CLOCK_MUX_TYPE_MIPIPHYCFG,
+    [CLOCK_ROOT_A55] = CLOCK_MUX_TYPE_CAMAXI,
+    [CLOCK_ROOT_A55MTRBUS] = CLOCK_MUX_TYPE_ADC,
+    [CLOCK_ROOT_A55PERIPH] = CLOCK_MUX_TYPE_CAMAXI,
+    [CLOCK_ROOT_DRAMALT] = CLOCK_MUX_TYPE_CAMAXI,
+    [CLOCK_ROOT_DRAMAPB] = CLOCK_MUX_TYPE_ADC,
+    [CLOCK_ROOT_DISPAPB] = CLOCK_MUX_TYPE_ADC,
+    [CLOCK_ROOT_DISPAXI] = CLOCK_MUX_TYPE_CAMAXI,
+    [CLOCK_ROOT_RESERVED36] = CLOCK_MUX_TYPE_RESERVED,
+    [CLOCK_ROOT_DISPOCRAM] = CLOCK_MUX_TYPE_CAMAXI,
+    [CLOCK_ROOT_RESERVED38] = CLOCK_MUX_TYPE_RESERVED,
+    [CLOCK_ROOT_DISP1PIX] = CLOCK_MUX_TYPE_MIPIPHYCFG,
+    [CLOCK_ROOT_DISP2PIX] = CLOCK_MUX_TYPE_DISP2PIX,
+    [CLOCK_ROOT_DISP3PIX] = CLOCK_MUX_TYPE_DISP3PIX,
+    [CLOCK_ROOT_GPUAPB] = CLOCK_MUX_TYPE_ADC,
+    [CLOCK_ROOT_GPU] = CLOCK_MUX_TYPE_CAMAXI,
+    [CLOCK_ROOT_HSIOACSCAN480M] = CLOCK_MUX_TYPE_HSIOACSCAN480M,
+    [CLOCK_ROOT_HSIOACSCAN80M] = CLOCK_MUX_TYPE_ADC,
+    [CLOCK_ROOT_HSIO] = CLOCK_MUX_TYPE_CAMAXI,
+    [CLOCK_ROOT_HSIOPCIEAUX] = CLOCK_MUX_TYPE_ADC,
+    [CLOCK_ROOT_HSIOPCIETEST160M] = CLOCK_MUX_TYPE_CAMAXI,
+    [CLOCK_ROOT_HSIOPCIETEST400M] = CLOCK_MUX_TYPE_CAMAXI,
+    [CLOCK_ROOT_HSIOPCIETEST500M] = CLOCK_MUX_TYPE_CAMAXI,
+    [CLOCK_ROOT_HSIOUSBTEST50M] = CLOCK_MUX_TYPE_ADC,
+    [CLOCK_ROOT_HSIOUSBTEST60M] = CLOCK_MUX_TYPE_ADC,
+    [CLOCK_ROOT_BUSM7] = CLOCK_MUX_TYPE_ADC,
+    [CLOCK_ROOT_M7] = CLOCK_MUX_TYPE_CAMAXI,
+    [CLOCK_ROOT_M7SYSTICK] = CLOCK_MUX_TYPE_ADC,
+    [CLOCK_ROOT_BUSNETCMIX] = CLOCK_MUX_TYPE_ADC,
+    [CLOCK_ROOT_ENET] = CLOCK_MUX_TYPE_CAMAXI,
+    [CLOCK_ROOT_ENETPHYTEST200M] = CLOCK_MUX_TYPE_M33,
+    [CLOCK_ROOT_ENETPHYTEST500M] = CLOCK_MUX_TYPE_CAMAXI,
+    [CLOCK_ROOT_ENETPHYTEST667M] = CLOCK_MUX_TYPE_CAMAXI,
+    [CLOCK_ROOT_ENETREF] = CLOCK_MUX_TYPE_M33,
+    [CLOCK_ROOT_ENETTIMER1] = CLOCK_MUX_TYPE_ADC,
+    [CLOCK_ROOT_MQS2] = CLOCK_MUX_TYPE_MQS1,
+    [CLOCK_ROOT_SAI2] = CLOCK_MUX_TYPE_MQS1,
+    [CLOCK_ROOT_NOCAPB] = CLOCK_MUX_TYPE_ADC,
+    [CLOCK_ROOT_NOC] = CLOCK_MUX_TYPE_CAMAXI,
+    [CLOCK_ROOT_NPUAPB] = CLOCK_MUX_TYPE_ADC,
+    [CLOCK_ROOT_NPU] = CLOCK_MUX_TYPE_CAMAXI,
+    [CLOCK_ROOT_CCMCKO1] = CLOCK_MUX_TYPE_CCMCKO1,
+    [CLOCK_ROOT_CCMCKO2] = CLOCK_MUX_TYPE_CCMCKO2,
+    [CLOCK_ROOT_CCMCKO3] = CLOCK_MUX_TYPE_CCMCKO3,
+    [CLOCK_ROOT_CCMCKO4] = CLOCK_MUX_TYPE_CCMCKO2,
+    [CLOCK_ROOT_VPUAPB] = CLOCK_MUX_TYPE_ADC,
+    [CLOCK_ROOT_VPU] = CLOCK_MUX_TYPE_CAMAXI,
+    [CLOCK_ROOT_VPUDSP] = CLOCK_MUX_TYPE_CAMAXI,
+    [CLOCK_ROOT_VPUJPEG] = CLOCK_MUX_TYPE_CAMAXI,
+    [CLOCK_ROOT_AUDIOXCVR] = CLOCK_MUX_TYPE_M33,
+    [CLOCK_ROOT_BUSWAKEUP] = CLOCK_MUX_TYPE_ADC,
+    [CLOCK_ROOT_CAN2] = CLOCK_MUX_TYPE_ADC,
+    [CLOCK_ROOT_CAN3] = CLOCK_MUX_TYPE_ADC,
+    [CLOCK_ROOT_CAN4] = CLOCK_MUX_TYPE_ADC,
+    [CLOCK_ROOT_CAN5] = CLOCK_MUX_TYPE_ADC,
+    [CLOCK_ROOT_FLEXIO1] = CLOCK_MUX_TYPE_ADC,
+    [CLOCK_ROOT_FLEXIO2] = CLOCK_MUX_TYPE_ADC,
+    [CLOCK_ROOT_FLEXSPI1] = CLOCK_MUX_TYPE_CAMAXI,
+    [CLOCK_ROOT_I3C2] = CLOCK_MUX_TYPE_ADC,
+    [CLOCK_ROOT_I3C2SLOW] = CLOCK_MUX_TYPE_ADC,
+    [CLOCK_ROOT_LPI2C3] = CLOCK_MUX_TYPE_ADC,
+    [CLOCK_ROOT_LPI2C4] = CLOCK_MUX_TYPE_ADC,
+    [CLOCK_ROOT_LPI2C5] = CLOCK_MUX_TYPE_ADC,
+    [CLOCK_ROOT_LPI2C6] = CLOCK_MUX_TYPE_ADC,
+    [CLOCK_ROOT_LPI2C7] = CLOCK_MUX_TYPE_ADC,
+    [CLOCK_ROOT_LPI2C8] = CLOCK_MUX_TYPE_ADC,
+    [CLOCK_ROOT_LPSPI3] = CLOCK_MUX_TYPE_ADC,
+    [CLOCK_ROOT_LPSPI4] = CLOCK_MUX_TYPE_ADC,
+    [CLOCK_ROOT_LPSPI5] = CLOCK_MUX_TYPE_ADC,
+    [CLOCK_ROOT_LPSPI6] = CLOCK_MUX_TYPE_ADC,
+    [CLOCK_ROOT_LPSPI7] = CLOCK_MUX_TYPE_ADC,
+    [CLOCK_ROOT_LPSPI8] = CLOCK_MUX_TYPE_ADC,
+    [CLOCK_ROOT_LPTMR2] = CLOCK_MUX_TYPE_ADC,
+    [CLOCK_ROOT_LPUART3] = CLOCK_MUX_TYPE_ADC,
+    [CLOCK_ROOT_LPUART4] = CLOCK_MUX_TYPE_ADC,
+    [CLOCK_ROOT_LPUART5] = CLOCK_MUX_TYPE_ADC,
+    [CLOCK_ROOT_LPUART6] = CLOCK_MUX_TYPE_ADC,
+    [CLOCK_ROOT_LPUART7] = CLOCK_MUX_TYPE_ADC,
+    [CLOCK_ROOT_LPUART8] = CLOCK_MUX_TYPE_ADC,
+    [CLOCK_ROOT_SAI3] = CLOCK_MUX_TYPE_MQS1,
+    [CLOCK_ROOT_SAI4] = CLOCK_MUX_TYPE_MQS1,
+    [CLOCK_ROOT_SAI5] = CLOCK_MUX_TYPE_MQS1,
+    [CLOCK_ROOT_SPDIF] = CLOCK_MUX_TYPE_MQS1,
+    [CLOCK_ROOT_SWOTRACE] = CLOCK_MUX_TYPE_ADC,
+    [CLOCK_ROOT_TPM4] = CLOCK_MUX_TYPE_TPM2,
+    [CLOCK_ROOT_TPM5] = CLOCK_MUX_TYPE_TPM2,
+    [CLOCK_ROOT_TPM6] = CLOCK_MUX_TYPE_TPM2,
+    [CLOCK_ROOT_TSTMR2] = CLOCK_MUX_TYPE_ADC,
+    [CLOCK_ROOT_USBPHYBURUNIN] = CLOCK_MUX_TYPE_ADC,
+    [CLOCK_ROOT_USDHC1] = CLOCK_MUX_TYPE_CAMAXI,
+    [CLOCK_ROOT_USDHC2] = CLOCK_MUX_TYPE_CAMAXI,
+    [CLOCK_ROOT_USDHC3] = CLOCK_MUX_TYPE_CAMAXI,
+    [CLOCK_ROOT_V2XPK] = CLOCK_MUX_TYPE_CAMAXI,
+    [CLOCK_ROOT_WAKEUPAXI] = CLOCK_MUX_TYPE_CAMAXI,
+    [CLOCK_ROOT_XSPISLVROOT] = CLOCK_MUX_TYPE_CAMAXI
+};
+
+const uint8_t g_clockMuxTypeSel[CLOCK_NUM_MUX_TYPE][CLOCK_NUM_SRC] =
+{
+    [CLOCK_MUX_TYPE_ADC][CLOCK_SRC_OSC24M] = CLOCK_MUX_SEL(0U),
+    [CLOCK_MUX_TYPE_ADC][CLOCK_SRC_SYSPLL1_PFD0_DIV2] = CLOCK_MUX_SEL(1U),
+    [CLOCK_MUX_TYPE_ADC][CLOCK_SRC_SYSPLL1_PFD1_DIV2] = CLOCK_MUX_SEL(2U),
+    [CLOCK_MUX_TYPE_ADC][CLOCK_SRC_FRO] = CLOCK_MUX_SEL(3U),
+
+    [CLOCK_MUX_TYPE_M33][CLOCK_SRC_OSC24M] = CLOCK_MUX_SEL(0U),
+    [CLOCK_MUX_TYPE_M33][CLOCK_SRC_SYSPLL1_PFD0] = CLOCK_MUX_SEL(1U),
+    [CLOCK_MUX_TYPE_M33][CLOCK_SRC_SYSPLL1_PFD1_DIV2] = CLOCK_MUX_SEL(2U),
+    [CLOCK_MUX_TYPE_M33][CLOCK_SRC_FRO] = CLOCK_MUX_SEL(3U),
+
+    [CLOCK_MUX_TYPE_MQS1][CLOCK_SRC_OSC24M] = CLOCK_MUX_SEL(0U),
+    [CLOCK_MUX_TYPE_MQS1][CLOCK_SRC_AUDIOPLL1] = CLOCK_MUX_SEL(1U),
+    [CLOCK_MUX_TYPE_MQS1][CLOCK_SRC_AUDIOPLL2] = CLOCK_MUX_SEL(2U),
+    [CLOCK_MUX_TYPE_MQS1][CLOCK_SRC_EXT] = CLOCK_MUX_SEL(3U),
+
+    [CLOCK_MUX_TYPE_TPM2][CLOCK_SRC_OSC24M] = CLOCK_MUX_SEL(0U),
+    [CLOCK_MUX_TYPE_TPM2][CLOCK_SRC_SYSPLL1_PFD0] = CLOCK_MUX_SEL(1U),
+    [CLOCK_MUX_TYPE_TPM2][CLOCK_SRC_AUDIOPLL1] = CLOCK_MUX_SEL(2U),
+    [CLOCK_MUX_TYPE_TPM2][CLOCK_SRC_EXT] = CLOCK_MUX_SEL(3U),
+
+    [CLOCK_MUX_TYPE_CAMAXI][CLOCK_SRC_OSC24M] = CLOCK_MUX_SEL(0U),
+    [CLOCK_MUX_TYPE_CAMAXI][CLOCK_SRC_SYSPLL1_PFD0] = CLOCK_MUX_SEL(1U),
+    [CLOCK_MUX_TYPE_CAMAXI][CLOCK_SRC_SYSPLL1_PFD1] = CLOCK_MUX_SEL(2U),
+    [CLOCK_MUX_TYPE_CAMAXI][CLOCK_SRC_SYSPLL1_PFD2] = CLOCK_MUX_SEL(3U),
+
+    [CLOCK_MUX_TYPE_MIPIPHYCFG][CLOCK_SRC_OSC24M] = CLOCK_MUX_SEL(0U),
+    [CLOCK_MUX_TYPE_MIPIPHYCFG][CLOCK_SRC_AUDIOPLL1] = CLOCK_MUX_SEL(1U),
+    [CLOCK_MUX_TYPE_MIPIPHYCFG][CLOCK_SRC_VIDEOPLL1] = CLOCK_MUX_SEL(2U),
+
+    [CLOCK_MUX_TYPE_RESERVED][CLOCK_SRC_EXT] = CLOCK_MUX_SEL(0U),
+
+    [CLOCK_MUX_TYPE_DISP2PIX][CLOCK_SRC_OSC24M] = CLOCK_MUX_SEL(0U),
+    [CLOCK_MUX_TYPE_DISP2PIX][CLOCK_SRC_AUDIOPLL1] = CLOCK_MUX_SEL(1U),
+    [CLOCK_MUX_TYPE_DISP2PIX][CLOCK_SRC_RESERVED21] = CLOCK_MUX_SEL(2U),
+    [CLOCK_MUX_TYPE_DISP2PIX][CLOCK_SRC_SYSPLL1_PFD2] = CLOCK_MUX_SEL(3U),
+
+    [CLOCK_MUX_TYPE_DISP3PIX][CLOCK_SRC_OSC24M] = CLOCK_MUX_SEL(0U),
+    [CLOCK_MUX_TYPE_DISP3PIX][CLOCK_SRC_AUDIOPLL1] = CLOCK_MUX_SEL(1U),
+    [CLOCK_MUX_TYPE_DISP3PIX][CLOCK_SRC_RESERVED23] = CLOCK_MUX_SEL(2U),
+    [CLOCK_MUX_TYPE_DISP3PIX][CLOCK_SRC_SYSPLL1_PFD2] = CLOCK_MUX_SEL(3U),
+
+    [CLOCK_MUX_TYPE_HSIOACSCAN480M][CLOCK_SRC_OSC24M] = CLOCK_MUX_SEL(0U),
+    [CLOCK_MUX_TYPE_HSIOACSCAN480M][CLOCK_SRC_AUDIOPLL1] = CLOCK_MUX_SEL(1U),
+    [CLOCK_MUX_TYPE_HSIOACSCAN480M][CLOCK_SRC_VIDEOPLL1] = CLOCK_MUX_SEL(2U),
+    [CLOCK_MUX_TYPE_HSIOACSCAN480M][CLOCK_SRC_SYSPLL1_PFD2] =
+        CLOCK_MUX_SEL(3U),
+
+    [CLOCK_MUX_TYPE_CCMCKO1][CLOCK_SRC_OSC24M] = CLOCK_MUX_SEL(0U),
+    [CLOCK_MUX_TYPE_CCMCKO1][CLOCK_SRC_SYSPLL1_PFD0] = CLOCK_MUX_SEL(1U),
+    [CLOCK_MUX_TYPE_CCMCKO1][CLOCK_SRC_OSC32K] = CLOCK_MUX_SEL(2U),
+    [CLOCK_MUX_TYPE_CCMCKO1][CLOCK_SRC_AUDIOPLL1] = CLOCK_MUX_SEL(3U),
+
+    [CLOCK_MUX_TYPE_CCMCKO2][CLOCK_SRC_OSC24M] = CLOCK_MUX_SEL(0U),
+    [CLOCK_MUX_TYPE_CCMCKO2][CLOCK_SRC_SYSPLL1_PFD0] = CLOCK_MUX_SEL(1U),
+    [CLOCK_MUX_TYPE_CCMCKO2][CLOCK_SRC_OSC32K] = CLOCK_MUX_SEL(2U),
+    [CLOCK_MUX_TYPE_CCMCKO2][CLOCK_SRC_VIDEOPLL1] = CLOCK_MUX_SEL(3U),
+
+    [CLOCK_MUX_TYPE_CCMCKO3][CLOCK_SRC_OSC24M] = CLOCK_MUX_SEL(0U),
+    [CLOCK_MUX_TYPE_CCMCKO3][CLOCK_SRC_SYSPLL1_PFD0] = CLOCK_MUX_SEL(1U),
+    [CLOCK_MUX_TYPE_CCMCKO3][CLOCK_SRC_OSC32K] = CLOCK_MUX_SEL(2U),
+    [CLOCK_MUX_TYPE_CCMCKO3][CLOCK_SRC_AUDIOPLL2] = CLOCK_MUX_SEL(3U)
+};
+
 /* CCM GPR-selected clocks may be sources/roots.  Encode selections
  * that map to roots as offset from CLOCK_NUM_SRC for unique mapping.
  */
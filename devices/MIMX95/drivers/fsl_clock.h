@@ -242,6 +242,25 @@
 #define CLOCK_ROOT_WAKEUPAXI                121U
 #define CLOCK_ROOT_XSPISLVROOT              122U
 
+#define CLOCK_NUM_MUX_TYPE                  13U
+
+#define CLOCK_MUX_TYPE_ADC                  0U
+#define CLOCK_MUX_TYPE_M33                  1U
+#define CLOCK_MUX_TYPE_MQS1                 2U
+#define CLOCK_MUX_TYPE_TPM2                 3U
+#define CLOCK_MUX_TYPE_CAMAXI               4U
+#define CLOCK_MUX_TYPE_MIPIPHYCFG           5U
+#define CLOCK_MUX_TYPE_RESERVED             6U
+#define CLOCK_MUX_TYPE_DISP2PIX             7U
+#define CLOCK_MUX_TYPE_DISP3PIX             8U
+#define CLOCK_MUX_TYPE_HSIOACSCAN480M       9U
+#define CLOCK_MUX_TYPE_CCMCKO1              10U
+#define CLOCK_MUX_TYPE_CCMCKO2              11U
+#define CLOCK_MUX_TYPE_CCMCKO3              12U
+
+#define CLOCK_MUX_SEL_VALID                 0x80U
+#define CLOCK_MUX_SEL(x)                    (CLOCK_MUX_SEL_VALID | (x))
+
 #define CLOCK_NUM_GPR                       3U
 #define CLOCK_NUM_GPR_SEL                   10UL
 #define CLOCK_NUM_GPR_MUX_SEL               2U
@@ -442,6 +461,12 @@ extern const pll_attr_t g_pllAttrs[];
 /*! Clock root mux select (parent clock source for the clock root)*/
 extern const uint8_t g_clockRootMux[][CLOCK_NUM_ROOT_MUX_SEL];
 
+/*! Clock root mux type (roots sharing the same mux inputs) */
+extern const uint8_t g_clockRootMuxType[CLOCK_NUM_ROOT];
+
+/*! Reverse mux map (clock source to CLOCK_MUX_SEL() of a mux type) */
+extern const uint8_t g_clockMuxTypeSel[][CLOCK_NUM_SRC];
+
 /*! GPR-selected clocks (clock source/clock root) */
 extern const ccm_gpr_sel_attr_t g_clockGprSel[CLOCK_NUM_GPR_SEL];
 
@@ -86,6 +86,12 @@ int32_t DEV_SM_Init(uint32_t bootPerfLevel, uint32_t runPerfLevel)
         status = DEV_SM_PowerInit();
     }
 
+    /* Initialize clocks */
+    if (status == SM_ERR_SUCCESS)
+    {
+        status = DEV_SM_ClockInit();
+    }
+
     /* Release M7 */
     if ((status == SM_ERR_SUCCESS) && (SRC_MixIsPwrSwitchOn(DEV_SM_PD_M7)))
     {
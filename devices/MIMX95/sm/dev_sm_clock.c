@@ -40,13 +40,77 @@
 
 #include "sm.h"
 #include "dev_sm.h"
+#include "lmm.h"
 
 /* Local defines */
 
+/* Maximum CCM root divider */
+#define DEV_SM_CLOCK_ROOT_DIV_MAX  256U
+
+/* Delay before powering down an unused source, 0 to keep running */
+#ifdef BOARD_CLOCK_GATE_MSEC
+#define DEV_SM_CLOCK_GATE_MSEC  BOARD_CLOCK_GATE_MSEC
+#else
+#define DEV_SM_CLOCK_GATE_MSEC  100U
+#endif
+
+/* Sources powered down automatically when unused */
+#define DEV_SM_CLOCK_GATE_FIRST  DEV_SM_CLK_AUDIOPLL1_VCO
+#define DEV_SM_CLOCK_GATE_LAST   DEV_SM_CLK_VIDEOPLL1
+
 /* Local types */
 
 /* Local variables */
 
+static uint64_t s_clockRate[DEV_SM_NUM_CLOCK];
+static BITARRAY_DEC(s_clockRateValid, DEV_SM_NUM_CLOCK);
+static uint32_t s_clockRateGen;
+
+static uint16_t s_clockSrcUse[CLOCK_NUM_SRC];
+static uint32_t s_clockSrcIdle[CLOCK_NUM_SRC];
+static BITARRAY_DEC(s_clockSrcReq, CLOCK_NUM_SRC);
+static BITARRAY_DEC(s_clockSrcHeld, CLOCK_NUM_SRC);
+
+/* Local functions */
+
+static int32_t DEV_SM_ClockRateRead(uint32_t clockId, uint64_t *rate);
+static bool DEV_SM_ClockRateCacheable(uint32_t clockId);
+static bool DEV_SM_ClockSrcGated(uint32_t clockId);
+static bool DEV_SM_ClockSrcInUse(uint32_t clockId);
+static void DEV_SM_ClockSrcUp(uint32_t clockId);
+static void DEV_SM_ClockSrcDown(uint32_t clockId);
+static void DEV_SM_ClockSrcAcquire(uint32_t clockId);
+static void DEV_SM_ClockSrcRelease(uint32_t clockId);
+static void DEV_SM_ClockSrcSync(void);
+static void DEV_SM_ClockRateDrop(uint32_t clockId);
+static uint32_t DEV_SM_ClockChildFirst(uint32_t clockId);
+
+/*--------------------------------------------------------------------------*/
+/* Init clocks                                                              */
+/*--------------------------------------------------------------------------*/
+int32_t DEV_SM_ClockInit(void)
+{
+    /* Count enabled roots using each gated source */
+    for (uint32_t clockIndex = 0U; clockIndex < CLOCK_NUM_ROOT;
+        clockIndex++)
+    {
+        uint32_t parent;
+
+        if (CCM_RootGetEnable(clockIndex)
+            && CCM_RootGetParent(clockIndex, &parent)
+            && DEV_SM_ClockSrcGated(parent))
+        {
+            s_clockSrcUse[parent]++;
+        }
+    }
+
+    /* Track running sources, unused ones power down after a delay */
+    DEV_SM_ClockSrcSync();
+
+    /* Return status */
+    return SM_ERR_SUCCESS;
+}
+
 /*--------------------------------------------------------------------------*/
 /* Return clock name                                                        */
 /*--------------------------------------------------------------------------*/
@@ -723,6 +787,91 @@ int32_t DEV_SM_ClockMuxGet(uint32_t clockId, uint32_t idx, uint32_t *mux,
     return status;
 }
 
+/*--------------------------------------------------------------------------*/
+/* Return discrete clock rates                                              */
+/*--------------------------------------------------------------------------*/
+int32_t DEV_SM_ClockRatesGet(uint32_t clockId, uint32_t idx,
+    uint64_t *rates, uint32_t *numRates, uint32_t *remaining)
+{
+    int32_t status = SM_ERR_SUCCESS;
+    uint32_t rootIdx = clockId - CLOCK_NUM_SRC;
+    dev_sm_clock_range_t range = { 0ULL, 0ULL, 0ULL };
+    uint64_t srcRate = 0ULL;
+
+    /* Only roots have a discrete set of rates */
+    if (clockId >= DEV_SM_NUM_CLOCK)
+    {
+        status = SM_ERR_NOT_FOUND;
+    }
+    else if ((clockId < CLOCK_NUM_SRC) || (rootIdx >= CLOCK_NUM_ROOT))
+    {
+        status = SM_ERR_NOT_SUPPORTED;
+    }
+    else
+    {
+        uint32_t sourceIdx;
+
+        /* Rate set only changes the divider, so use current source */
+        if (CCM_RootGetParent(rootIdx, &sourceIdx))
+        {
+            srcRate = CLOCK_SourceGetRate(sourceIdx);
+        }
+
+        /* Get supported range */
+        status = DEV_SM_ClockDescribe(clockId, &range);
+    }
+
+    /* Check source rate */
+    if ((status == SM_ERR_SUCCESS) && (srcRate == 0ULL))
+    {
+        status = SM_ERR_NOT_SUPPORTED;
+    }
+
+    if (status == SM_ERR_SUCCESS)
+    {
+        uint32_t total = 0U;
+        uint32_t num = 0U;
+        uint64_t prevRate = 0ULL;
+
+        /* Walk dividers to return ascending unique rates within range */
+        for (uint32_t div = DEV_SM_CLOCK_ROOT_DIV_MAX; div > 0U; div--)
+        {
+            uint64_t rate = srcRate / ((uint64_t) div);
+
+            if ((rate != prevRate) && (rate >= range.lowestRate)
+                && (rate <= range.highestRate))
+            {
+                /* Return rate if within requested window */
+                if ((total >= idx) && (num < *numRates))
+                {
+                    rates[num] = rate;
+                    num++;
+                }
+                total++;
+            }
+            prevRate = rate;
+        }
+
+        /* Check list and index */
+        if (total == 0U)
+        {
+            status = SM_ERR_NOT_SUPPORTED;
+        }
+        else if (idx >= total)
+        {
+            status = SM_ERR_OUT_OF_RANGE;
+        }
+        else
+        {
+            *numRates = num;
+            *remaining = total - idx - num;
+        }
+    }
+
+    /* Return status */
+    return status;
+}
+
 /*--------------------------------------------------------------------------*/
 /* Set clock rate                                                           */
 /*--------------------------------------------------------------------------*/
@@ -730,6 +879,10 @@ int32_t DEV_SM_ClockRateSet(uint32_t clockId, uint64_t rate,
     uint32_t roundSel)
 {
     int32_t status = SM_ERR_SUCCESS;
+    uint64_t oldRate = 0ULL;
+
+    /* Get current rate */
+    (void) DEV_SM_ClockRateGet(clockId, &oldRate);
 
     if (clockId < CLOCK_NUM_SRC)
     {
@@ -763,6 +916,9 @@ int32_t DEV_SM_ClockRateSet(uint32_t clockId, uint64_t rate,
                 status = SM_ERR_INVALID_PARAMETERS;
                 break;
         }
+
+        /* Relocking a PLL powers it up */
+        DEV_SM_ClockSrcSync();
     }
     else
     {
@@ -816,6 +972,12 @@ int32_t DEV_SM_ClockRateSet(uint32_t clockId, uint64_t rate,
         }
     }
 
+    /* Report rate change */
+    if (status == SM_ERR_SUCCESS)
+    {
+        DEV_SM_ClockRateReport(clockId, oldRate);
+    }
+
     /* Return status */
     return status;
 }
@@ -827,30 +989,35 @@ int32_t DEV_SM_ClockRateGet(uint32_t clockId, uint64_t *rate)
 {
     int32_t status = SM_ERR_SUCCESS;
 
-    if (clockId < CLOCK_NUM_SRC)
+    /* Return cached rate */
+    if ((clockId < DEV_SM_NUM_CLOCK)
+        && (BITARRAY_GET(s_clockRateValid, clockId) != 0U))
     {
-        *rate = CLOCK_SourceGetRate(clockId);
+        *rate = s_clockRate[clockId];
     }
     else
     {
-        uint32_t clockIndex = clockId - CLOCK_NUM_SRC;
+        uint32_t gen = s_clockRateGen;
 
-        if (clockIndex < CLOCK_NUM_ROOT)
-        {
-            *rate = CCM_RootGetRate(clockIndex);
-        }
-        else
+        /* Read rate from hardware */
+        status = DEV_SM_ClockRateRead(clockId, rate);
+
+        /* Update cache */
+        if ((status == SM_ERR_SUCCESS)
+            && DEV_SM_ClockRateCacheable(clockId))
         {
-            clockIndex = clockIndex - CLOCK_NUM_ROOT;
+            /* Tick can power down the source between read and update */
+            uint32_t priMask = DisableGlobalIRQ();
 
-            if (clockIndex < CLOCK_NUM_GPR_SEL)
-            {
-                *rate = CCM_GprSelGetRate(clockIndex);
-            }
-            else
+            /* Skip fill if invalidated during the read */
+            if (gen == s_clockRateGen)
             {
-                status = SM_ERR_NOT_FOUND;
+                s_clockRate[clockId] = *rate;
+                BITARRAY_SET(s_clockRateValid, clockId);
             }
+
+            /* Restore interrupts */
+            EnableGlobalIRQ(priMask);
         }
     }
 
@@ -865,12 +1032,43 @@ int32_t DEV_SM_ClockEnable(uint32_t clockId, bool enable)
 {
     int32_t status = SM_ERR_SUCCESS;
 
-    if (clockId < CLOCK_NUM_SRC)
+    if (DEV_SM_ClockSrcGated(clockId))
+    {
+        /* Disable interrupts, tick also changes source state */
+        uint32_t priMask = DisableGlobalIRQ();
+
+        /* Source stays on while used by enabled roots */
+        if (enable)
+        {
+            BITARRAY_SET(s_clockSrcReq, clockId);
+            DEV_SM_ClockSrcUp(clockId);
+        }
+        else
+        {
+            BITARRAY_CLR(s_clockSrcReq, clockId);
+            if (!DEV_SM_ClockSrcInUse(clockId))
+            {
+                DEV_SM_ClockSrcDown(clockId);
+            }
+        }
+
+        /* Restore interrupts */
+        EnableGlobalIRQ(priMask);
+
+        if (CLOCK_SourceGetEnable(clockId) != DEV_SM_ClockSrcInUse(clockId))
+        {
+            status = SM_ERR_INVALID_PARAMETERS;
+        }
+    }
+    else if (clockId < CLOCK_NUM_SRC)
     {
         if (!CLOCK_SourceSetEnable(clockId, enable))
         {
             status = SM_ERR_INVALID_PARAMETERS;
         }
+
+        /* Source rate can depend on enable */
+        DEV_SM_ClockRateInvalidate(clockId);
     }
     else
     {
@@ -878,10 +1076,27 @@ int32_t DEV_SM_ClockEnable(uint32_t clockId, bool enable)
 
         if (clockIndex < CLOCK_NUM_ROOT)
         {
+            uint32_t parent = CLOCK_NUM_SRC;
+            bool wasEnabled = CCM_RootGetEnable(clockIndex);
+
+            (void) CCM_RootGetParent(clockIndex, &parent);
+
+            /* Hold the source before the root starts using it */
+            if (enable && !wasEnabled)
+            {
+                DEV_SM_ClockSrcAcquire(parent);
+            }
+
             if (!CCM_RootSetEnable(clockIndex, enable))
             {
                 status = SM_ERR_INVALID_PARAMETERS;
             }
+
+            /* Drop the hold if the root no longer uses the source */
+            if ((enable != wasEnabled) && !CCM_RootGetEnable(clockIndex))
+            {
+                DEV_SM_ClockSrcRelease(parent);
+            }
         }
         else
         {
@@ -946,6 +1161,10 @@ int32_t DEV_SM_ClockIsEnabled(uint32_t clockId, bool *enabled)
 int32_t DEV_SM_ClockParentSet(uint32_t clockId, uint32_t parent)
 {
     int32_t status = SM_ERR_SUCCESS;
+    uint64_t oldRate = 0ULL;
+
+    /* Get current rate */
+    (void) DEV_SM_ClockRateGet(clockId, &oldRate);
 
     if (clockId < CLOCK_NUM_SRC)
     {
@@ -960,10 +1179,40 @@ int32_t DEV_SM_ClockParentSet(uint32_t clockId, uint32_t parent)
 
         if (clockIndex < CLOCK_NUM_ROOT)
         {
-            if (!CCM_RootSetParent(clockIndex, parent))
+            uint32_t muxIdx = 0U;
+
+            /* Check parent is a mux input before touching sources */
+            if (!CCM_RootMuxSelGet(clockIndex, parent, &muxIdx))
             {
                 status = SM_ERR_INVALID_PARAMETERS;
             }
+            else
+            {
+                uint32_t oldParent = CLOCK_NUM_SRC;
+                uint32_t newParent = CLOCK_NUM_SRC;
+                bool enabled = CCM_RootGetEnable(clockIndex);
+
+                (void) CCM_RootGetParent(clockIndex, &oldParent);
+
+                /* Enabled root needs both sources running to switch */
+                if (enabled)
+                {
+                    DEV_SM_ClockSrcAcquire(parent);
+                }
+
+                if (!CCM_RootSetParent(clockIndex, parent))
+                {
+                    status = SM_ERR_INVALID_PARAMETERS;
+                }
+
+                /* Release whichever source the root is not using */
+                (void) CCM_RootGetParent(clockIndex, &newParent);
+                if (enabled)
+                {
+                    DEV_SM_ClockSrcRelease((newParent == parent)
+                        ? oldParent : parent);
+                }
+            }
         }
         else
         {
@@ -983,6 +1232,12 @@ int32_t DEV_SM_ClockParentSet(uint32_t clockId, uint32_t parent)
         }
     }
 
+    /* Report rate change */
+    if (status == SM_ERR_SUCCESS)
+    {
+        DEV_SM_ClockRateReport(clockId, oldRate);
+    }
+
     /* Return status */
     return status;
 }
@@ -1076,6 +1331,9 @@ int32_t DEV_SM_ClockExtendedSet(uint32_t clockId, uint32_t extId,
                 {
                     status = SM_ERR_INVALID_PARAMETERS;
                 }
+
+                /* Spread spectrum changes the PLL configuration */
+                DEV_SM_ClockRateInvalidate(clockId);
             }
             break;
 
@@ -1130,3 +1388,427 @@ int32_t DEV_SM_ClockExtendedGet(uint32_t clockId, uint32_t extId,
     return status;
 }
 
+/*--------------------------------------------------------------------------*/
+/* Report clock rate change                                                 */
+/*--------------------------------------------------------------------------*/
+void DEV_SM_ClockRateReport(uint32_t clockId, uint64_t oldRate)
+{
+    uint64_t rate = 0ULL;
+
+    /* Drop cached rates of the clock and descendants */
+    DEV_SM_ClockRateInvalidate(clockId);
+
+    /* Report if changed */
+    if ((DEV_SM_ClockRateGet(clockId, &rate) == SM_ERR_SUCCESS)
+        && (rate != oldRate))
+    {
+        BITARRAY_DEC(changed, DEV_SM_NUM_CLOCK) = { 0U };
+
+        BITARRAY_SET(changed, clockId);
+        LMM_ClockRateEvent(clockId, rate);
+
+        /* Parents always have lower IDs, one pass finds all descendants */
+        for (uint32_t child = DEV_SM_ClockChildFirst(clockId);
+            child < DEV_SM_NUM_CLOCK; child++)
+        {
+            uint32_t parent;
+
+            if ((DEV_SM_ClockParentGet(child, &parent) == SM_ERR_SUCCESS)
+                && (parent < DEV_SM_NUM_CLOCK)
+                && (BITARRAY_GET(changed, parent) != 0U)
+                && (DEV_SM_ClockRateGet(child, &rate) == SM_ERR_SUCCESS))
+            {
+                BITARRAY_SET(changed, child);
+                LMM_ClockRateEvent(child, rate);
+            }
+        }
+    }
+}
+
+/*--------------------------------------------------------------------------*/
+/* Invalidate cached clock rates                                            */
+/*--------------------------------------------------------------------------*/
+void DEV_SM_ClockRateInvalidate(uint32_t clockId)
+{
+    /* Fail any cache fill in progress */
+    s_clockRateGen++;
+
+    if (clockId < DEV_SM_NUM_CLOCK)
+    {
+        BITARRAY_DEC(dirty, DEV_SM_NUM_CLOCK) = { 0U };
+
+        BITARRAY_SET(dirty, clockId);
+        DEV_SM_ClockRateDrop(clockId);
+
+        /* Parents always have lower IDs, one pass finds all descendants */
+        for (uint32_t child = DEV_SM_ClockChildFirst(clockId);
+            child < DEV_SM_NUM_CLOCK; child++)
+        {
+            uint32_t parent;
+
+            if ((DEV_SM_ClockParentGet(child, &parent) == SM_ERR_SUCCESS)
+                && (parent < DEV_SM_NUM_CLOCK)
+                && (BITARRAY_GET(dirty, parent) != 0U))
+            {
+                BITARRAY_SET(dirty, child);
+                DEV_SM_ClockRateDrop(child);
+            }
+        }
+    }
+    else
+    {
+        /* Invalidate all */
+        for (uint32_t idx = 0U; idx < BITARRAY_SIZE(DEV_SM_NUM_CLOCK);
+            idx++)
+        {
+            s_clockRateValid[idx] = 0U;
+        }
+    }
+}
+
+/*--------------------------------------------------------------------------*/
+/* Clock tick                                                               */
+/*--------------------------------------------------------------------------*/
+void DEV_SM_ClockTick(uint32_t msec)
+{
+    /* Power down sources unused for the full delay */
+    for (uint32_t clockId = DEV_SM_CLOCK_GATE_FIRST;
+        clockId <= DEV_SM_CLOCK_GATE_LAST; clockId++)
+    {
+        /* Disable interrupts, higher priority handlers may use clocks */
+        uint32_t priMask = DisableGlobalIRQ();
+
+        if (s_clockSrcIdle[clockId] > msec)
+        {
+            s_clockSrcIdle[clockId] -= msec;
+        }
+        else if (s_clockSrcIdle[clockId] != 0U)
+        {
+            s_clockSrcIdle[clockId] = 0U;
+
+            /* Recheck, a user may have been added from thread mode */
+            if (!DEV_SM_ClockSrcInUse(clockId))
+            {
+                DEV_SM_ClockSrcDown(clockId);
+            }
+        }
+        else
+        {
+            ; /* Intentional empty else */
+        }
+
+        /* Restore interrupts */
+        EnableGlobalIRQ(priMask);
+    }
+}
+
+/*--------------------------------------------------------------------------*/
+/* Get gated source state                                                   */
+/*--------------------------------------------------------------------------*/
+int32_t DEV_SM_ClockSrcStateGet(uint32_t clockId, uint32_t *use,
+    uint32_t *idleMsec)
+{
+    int32_t status = SM_ERR_SUCCESS;
+
+    if (DEV_SM_ClockSrcGated(clockId))
+    {
+        *use = s_clockSrcUse[clockId];
+        *idleMsec = s_clockSrcIdle[clockId];
+    }
+    else
+    {
+        status = SM_ERR_NOT_SUPPORTED;
+    }
+
+    /* Return status */
+    return status;
+}
+
+/*==========================================================================*/
+
+/*--------------------------------------------------------------------------*/
+/* Read clock rate from hardware                                            */
+/*--------------------------------------------------------------------------*/
+static int32_t DEV_SM_ClockRateRead(uint32_t clockId, uint64_t *rate)
+{
+    int32_t status = SM_ERR_SUCCESS;
+
+    if (clockId < CLOCK_NUM_SRC)
+    {
+        *rate = CLOCK_SourceGetRate(clockId);
+    }
+    else
+    {
+        uint32_t clockIndex = clockId - CLOCK_NUM_SRC;
+
+        if (clockIndex < CLOCK_NUM_ROOT)
+        {
+            *rate = CCM_RootGetRate(clockIndex);
+        }
+        else
+        {
+            clockIndex = clockIndex - CLOCK_NUM_ROOT;
+
+            if (clockIndex < CLOCK_NUM_GPR_SEL)
+            {
+                *rate = CCM_GprSelGetRate(clockIndex);
+            }
+            else
+            {
+                status = SM_ERR_NOT_FOUND;
+            }
+        }
+    }
+
+    /* Return status */
+    return status;
+}
+
+/*--------------------------------------------------------------------------*/
+/* Check if clock rate can be cached                                        */
+/*--------------------------------------------------------------------------*/
+static bool DEV_SM_ClockRateCacheable(uint32_t clockId)
+{
+    bool cacheable = true;
+    uint32_t clk = clockId;
+    uint32_t parent;
+
+    /* ARMPLL rates follow A55P power which the GPC sequences in hardware */
+    while (cacheable && (clk < DEV_SM_NUM_CLOCK))
+    {
+        if ((clk >= DEV_SM_CLK_ARMPLL_VCO) && (clk <= DEV_SM_CLK_ARMPLL_PFD3))
+        {
+            cacheable = false;
+        }
+        else if ((DEV_SM_ClockParentGet(clk, &parent) == SM_ERR_SUCCESS)
+            && (parent < clk))
+        {
+            clk = parent;
+        }
+        else
+        {
+            clk = DEV_SM_NUM_CLOCK;
+        }
+    }
+
+    /* Return result */
+    return cacheable;
+}
+
+/*--------------------------------------------------------------------------*/
+/* Check if source is powered down automatically                            */
+/*--------------------------------------------------------------------------*/
+static bool DEV_SM_ClockSrcGated(uint32_t clockId)
+{
+    /* Return result */
+    return (clockId >= DEV_SM_CLOCK_GATE_FIRST)
+        && (clockId <= DEV_SM_CLOCK_GATE_LAST);
+}
+
+/*--------------------------------------------------------------------------*/
+/* Check if source is requested or used by an enabled clock                 */
+/*--------------------------------------------------------------------------*/
+static bool DEV_SM_ClockSrcInUse(uint32_t clockId)
+{
+    /* Return result */
+    return (BITARRAY_GET(s_clockSrcReq, clockId) != 0U)
+        || (s_clockSrcUse[clockId] != 0U);
+}
+
+/*--------------------------------------------------------------------------*/
+/* Power up source and any gated sources it depends on                      */
+/*--------------------------------------------------------------------------*/
+static void DEV_SM_ClockSrcUp(uint32_t clockId)
+{
+    uint32_t top;
+
+    /* Cancel pending power down */
+    s_clockSrcIdle[clockId] = 0U;
+
+    /* Power up the chain from the topmost source not yet held */
+    do
+    {
+        uint32_t parent;
+
+        top = clockId;
+        while ((DEV_SM_ClockParentGet(top, &parent) == SM_ERR_SUCCESS)
+            && DEV_SM_ClockSrcGated(parent)
+            && (BITARRAY_GET(s_clockSrcHeld, parent) == 0U))
+        {
+            top = parent;
+        }
+
+        if (BITARRAY_GET(s_clockSrcHeld, top) == 0U)
+        {
+            if ((DEV_SM_ClockParentGet(top, &parent) == SM_ERR_SUCCESS)
+                && DEV_SM_ClockSrcGated(parent))
+            {
+                s_clockSrcUse[parent]++;
+                s_clockSrcIdle[parent] = 0U;
+            }
+
+            (void) CLOCK_SourceSetEnable(top, true);
+            BITARRAY_SET(s_clockSrcHeld, top);
+            DEV_SM_ClockRateInvalidate(top);
+        }
+    }
+    while (top != clockId);
+}
+
+/*--------------------------------------------------------------------------*/
+/* Power down source and any gated sources left unused                      */
+/*--------------------------------------------------------------------------*/
+static void DEV_SM_ClockSrcDown(uint32_t clockId)
+{
+    uint32_t clk = clockId;
+
+    while (DEV_SM_ClockSrcGated(clk))
+    {
+        uint32_t parent = CLOCK_NUM_SRC;
+
+        s_clockSrcIdle[clk] = 0U;
+        (void) CLOCK_SourceSetEnable(clk, false);
+        DEV_SM_ClockRateInvalidate(clk);
+
+        /* Parent was only held if this source was */
+        if ((BITARRAY_GET(s_clockSrcHeld, clk) != 0U)
+            && (DEV_SM_ClockParentGet(clk, &parent) == SM_ERR_SUCCESS)
+            && DEV_SM_ClockSrcGated(parent))
+        {
+            s_clockSrcUse[parent]--;
+        }
+        BITARRAY_CLR(s_clockSrcHeld, clk);
+
+        /* Parent already waited as long as this source */
+        if (DEV_SM_ClockSrcGated(parent) && !DEV_SM_ClockSrcInUse(parent))
+        {
+            clk = parent;
+        }
+        else
+        {
+            clk = CLOCK_NUM_SRC;
+        }
+    }
+}
+
+/*--------------------------------------------------------------------------*/
+/* Add a user of a source, powering it up if needed                         */
+/*--------------------------------------------------------------------------*/
+static void DEV_SM_ClockSrcAcquire(uint32_t clockId)
+{
+    if (DEV_SM_ClockSrcGated(clockId))
+    {
+        /* Disable interrupts, tick also changes source state */
+        uint32_t priMask = DisableGlobalIRQ();
+
+        s_clockSrcUse[clockId]++;
+        DEV_SM_ClockSrcUp(clockId);
+
+        /* Restore interrupts */
+        EnableGlobalIRQ(priMask);
+    }
+}
+
+/*--------------------------------------------------------------------------*/
+/* Remove a user of a source, power down after a delay if unused            */
+/*--------------------------------------------------------------------------*/
+static void DEV_SM_ClockSrcRelease(uint32_t clockId)
+{
+    /* Disable interrupts, tick also changes source state */
+    uint32_t priMask = DisableGlobalIRQ();
+
+    if (DEV_SM_ClockSrcGated(clockId) && (s_clockSrcUse[clockId] != 0U))
+    {
+        s_clockSrcUse[clockId]--;
+
+        if (!DEV_SM_ClockSrcInUse(clockId))
+        {
+            s_clockSrcIdle[clockId] = DEV_SM_CLOCK_GATE_MSEC;
+        }
+    }
+
+    /* Restore interrupts */
+    EnableGlobalIRQ(priMask);
+}
+
+/*--------------------------------------------------------------------------*/
+/* Track gated sources powered up outside of the enable API                 */
+/*--------------------------------------------------------------------------*/
+static void DEV_SM_ClockSrcSync(void)
+{
+    /* Disable interrupts, tick also changes source state */
+    uint32_t priMask = DisableGlobalIRQ();
+
+    /* Parents have lower IDs, held before their children are checked */
+    for (uint32_t clockId = DEV_SM_CLOCK_GATE_FIRST;
+        clockId <= DEV_SM_CLOCK_GATE_LAST; clockId++)
+    {
+        uint32_t parent = CLOCK_NUM_SRC;
+        bool gatedParent =
+            (DEV_SM_ClockParentGet(clockId, &parent) == SM_ERR_SUCCESS)
+            && DEV_SM_ClockSrcGated(parent);
+
+        /* Output of a powered down PLL is not running */
+        if ((BITARRAY_GET(s_clockSrcHeld, clockId) == 0U)
+            && CLOCK_SourceGetEnable(clockId)
+            && (!gatedParent
+            || (BITARRAY_GET(s_clockSrcHeld, parent) != 0U)))
+        {
+            if (gatedParent)
+            {
+                s_clockSrcUse[parent]++;
+                s_clockSrcIdle[parent] = 0U;
+            }
+            BITARRAY_SET(s_clockSrcHeld, clockId);
+
+            if (!DEV_SM_ClockSrcInUse(clockId))
+            {
+                s_clockSrcIdle[clockId] = DEV_SM_CLOCK_GATE_MSEC;
+            }
+        }
+    }
+
+    /* Restore interrupts */
+    EnableGlobalIRQ(priMask);
+}
+
+/*--------------------------------------------------------------------------*/
+/* Drop cached clock rate                                                   */
+/*--------------------------------------------------------------------------*/
+static void DEV_SM_ClockRateDrop(uint32_t clockId)
+{
+    /* Disable interrupts, tick also updates the bit array */
+    uint32_t priMask = DisableGlobalIRQ();
+
+    BITARRAY_CLR(s_clockRateValid, clockId);
+
+    /* Restore interrupts */
+    EnableGlobalIRQ(priMask);
+}
+
+/*--------------------------------------------------------------------------*/
+/* Get first clock ID that can be derived from a clock                      */
+/*--------------------------------------------------------------------------*/
+static uint32_t DEV_SM_ClockChildFirst(uint32_t clockId)
+{
+    uint32_t first;
+
+    /* Sources feed sources, roots, and GPR selects */
+    if (clockId < CLOCK_NUM_SRC)
+    {
+        first = clockId + 1U;
+    }
+    /* Roots only feed GPR selects */
+    else if (clockId < (CLOCK_NUM_SRC + CLOCK_NUM_ROOT))
+    {
+        first = CLOCK_NUM_SRC + CLOCK_NUM_ROOT;
+    }
+    /* GPR selects feed nothing */
+    else
+    {
+        first = DEV_SM_NUM_CLOCK;
+    }
+
+    /* Return first ID */
+    return first;
+}
@@ -299,6 +299,76 @@
 
 /* Functions */
 
+/*!
+ * Init clocks.
+ *
+ * @return Returns the status (::SM_ERR_SUCCESS = success).
+ *
+ * This function counts the enabled roots using each automatically
+ * gated source (audio and video PLLs). Running sources with no users
+ * are powered down after the gating delay.
+ */
+int32_t DEV_SM_ClockInit(void);
+
+/*!
+ * Report clock rate change.
+ *
+ * @param[in]     clockId     Clock that was modified
+ * @param[in]     oldRate     Rate of the clock before the modification
+ *
+ * This function reports the new rate of \a clockId to the LMM if it
+ * differs from \a oldRate. All clocks derived from \a clockId are
+ * reported as well. Called after rate, parent, and performance level
+ * changes.
+ *
+ * Descendants are found by reading the parent of each clock that can be
+ * derived from \a clockId. For a root only the GPR selects are read; for
+ * a source all higher source, root, and GPR select IDs are read (O(N) in
+ * ::DEV_SM_NUM_CLOCK). Nothing is scanned if the rate did not change.
+ */
+void DEV_SM_ClockRateReport(uint32_t clockId, uint64_t oldRate);
+
+/*!
+ * Invalidate cached clock rates.
+ *
+ * @param[in]     clockId     Clock that was modified, or
+ *                            ::DEV_SM_NUM_CLOCK for all clocks
+ *
+ * This function drops the cached rate of \a clockId and all clocks
+ * derived from it. Must be called after any PLL, PFD, mux, or divider
+ * change not made through the clock API.
+ */
+void DEV_SM_ClockRateInvalidate(uint32_t clockId);
+
+/*!
+ * Clock tick.
+ *
+ * @param[in]     msec        Time since last tick in milliseconds
+ *
+ * This function powers down automatically gated sources that have had
+ * no enabled users for BOARD_CLOCK_GATE_MSEC (default 100ms). The delay
+ * avoids PLL relock when a root is briefly disabled and re-enabled.
+ * Called from the SysTick handler.
+ */
+void DEV_SM_ClockTick(uint32_t msec);
+
+/*!
+ * Get gated source state.
+ *
+ * @param[in]     clockId     Gated source
+ * @param[out]    use         Return number of enabled users
+ * @param[out]    idleMsec    Return time left before power down, 0 if
+ *                            no power down is pending
+ *
+ * @return Returns the status (::SM_ERR_SUCCESS = success).
+ *
+ * Return errors (see @ref STATUS "SM error codes"):
+ * - ::SM_ERR_SUCCESS: if the state is returned.
+ * - ::SM_ERR_NOT_SUPPORTED: if \a clockId is not a gated source.
+ */
+int32_t DEV_SM_ClockSrcStateGet(uint32_t clockId, uint32_t *use,
+    uint32_t *idleMsec);
+
 /** @} */
 
 /* Include SM device API */
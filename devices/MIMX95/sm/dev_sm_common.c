@@ -67,6 +67,9 @@ dev_sm_syslog_t g_syslog;
 /* Local functions */
 
 static void DEV_SM_StrCpy(char *dst, const char *src, uint32_t maxLen);
+#ifdef INC_LIBC
+static void DEV_SM_SyslogSleepStatsDump(const dev_sm_sys_sleep_stats_t *stats);
+#endif
 
 /*--------------------------------------------------------------------------*/
 /* Get silicon info                                                         */
@@ -160,6 +163,21 @@ int32_t DEV_SM_SyslogDump(uint32_t flags)
         printf("Sleep latency = %u usec\n", sysSleepRecord->sleepEntryUsec);
         printf("Wake latency = %u usec\n", sysSleepRecord->sleepExitUsec);
         printf("Sleep count = %u\n", sysSleepRecord->sleepCnt);
+        printf("Sleep residency = %u usec\n", sysSleepRecord->sleepUsec);
+
+        DEV_SM_SyslogSleepStatsDump(&syslog->sysSleepStats);
+
+        const dev_sm_idle_gov_t *gov = &syslog->sysIdleGov;
+
+        printf("Idle count = %u/%u/%u (wfi/shallow/deep)\n",
+            gov->idleCnt[DEV_SM_IDLE_WFI], gov->idleCnt[DEV_SM_IDLE_SHALLOW],
+            gov->idleCnt[DEV_SM_IDLE_DEEP]);
+        printf("Idle demotions = %u timer, %u predicted\n",
+            gov->timerDemoteCnt, gov->predDemoteCnt);
+        printf("Idle predicted = %u usec\n", gov->predUsec);
+        printf("Idle latency = %u/%u usec (shallow/deep)\n",
+            gov->latUsec[DEV_SM_IDLE_SHALLOW],
+            gov->latUsec[DEV_SM_IDLE_DEEP]);
     }
 #endif
 
@@ -248,6 +266,14 @@ int32_t DEV_SM_StrLen(string str)
 
 /*==========================================================================*/
 
+/*--------------------------------------------------------------------------*/
+/* Memory barrier                                                           */
+/*--------------------------------------------------------------------------*/
+void DEV_SM_MemBarrier(void)
+{
+    __DMB();
+}
+
 /*--------------------------------------------------------------------------*/
 /* Bounded string copy                                                      */
 /*--------------------------------------------------------------------------*/
@@ -267,3 +293,59 @@ static void DEV_SM_StrCpy(char *dst, const char *src, uint32_t maxLen)
     *pDst = '\0';
 }
 
+#ifdef INC_LIBC
+/*--------------------------------------------------------------------------*/
+/* Dump the sleep statistics                                                */
+/*--------------------------------------------------------------------------*/
+static void DEV_SM_SyslogSleepStatsDump(const dev_sm_sys_sleep_stats_t *stats)
+{
+    uint32_t numRec = MIN(stats->recIdx, DEV_SM_NUM_SLEEP_REC);
+
+    /* Dump per-mode residency */
+    for (uint32_t mode = 0U; mode < DEV_SM_NUM_SLEEP_MODE; mode++)
+    {
+        const dev_sm_sleep_mode_stat_t *modeStat = &stats->modeStat[mode];
+
+        if ((modeStat->sleepCnt != 0U) || (modeStat->abortCnt != 0U))
+        {
+            printf("Mode 0x%02X: count = %u, aborts = %u, residency = "
+                "%u msec\n", mode << 4U, modeStat->sleepCnt,
+                modeStat->abortCnt, (uint32_t) (modeStat->sleepUsec
+                / 1000ULL));
+        }
+    }
+
+    /* Dump latency histograms */
+    printf("Latency (usec)   entry     exit\n");
+    for (uint32_t bin = 0U; bin < DEV_SM_NUM_SLEEP_HIST; bin++)
+    {
+        printf("  <%-8u %8u %8u\n", (bin < (DEV_SM_NUM_SLEEP_HIST - 1U))
+            ? (1U << (bin + DEV_SM_SLEEP_HIST_MIN)) : 0xFFFFFFFFU,
+            stats->entryHist[bin], stats->exitHist[bin]);
+    }
+
+    /* Dump wake sources */
+    for (uint32_t idx = 0U; idx < DEV_SM_NUM_WAKE_SRC; idx++)
+    {
+        if (stats->wakeStat[idx].wakeCnt != 0U)
+        {
+            printf("Wake vector %u: count = %u\n",
+                stats->wakeStat[idx].wakeSource,
+                stats->wakeStat[idx].wakeCnt);
+        }
+    }
+    printf("Wake other: count = %u\n", stats->wakeOtherCnt);
+
+    /* Dump records, newest first */
+    for (uint32_t idx = 1U; idx <= numRec; idx++)
+    {
+        const dev_sm_sys_sleep_rec_t *rec = &stats->rec[(stats->recIdx
+            - idx) % DEV_SM_NUM_SLEEP_REC];
+
+        printf("Sleep %u: mode=0x%02X, wake=%u, entry=%u, exit=%u, "
+            "residency=%u\n", rec->sleepCnt, rec->sysSleepMode,
+            rec->wakeSource, rec->sleepEntryUsec, rec->sleepExitUsec,
+            rec->sleepUsec);
+    }
+}
+#endif
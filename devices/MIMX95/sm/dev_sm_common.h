@@ -81,6 +81,12 @@ typedef struct
 {
     /*! System sleep record */
     dev_sm_sys_sleep_rec_t sysSleepRecord;
+
+    /*! System sleep statistics */
+    dev_sm_sys_sleep_stats_t sysSleepStats;
+
+    /*! System idle governor */
+    dev_sm_idle_gov_t sysIdleGov;
 } dev_sm_syslog_t;
 
 /* Global variables */
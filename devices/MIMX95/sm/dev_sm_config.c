@@ -302,6 +302,7 @@ int32_t DEV_SM_DdrConfigLoad(void)
             {
                 status = SM_ERR_HARDWARE_ERROR;
             }
+            DEV_SM_ClockRateInvalidate(DEV_SM_CLK_DRAMPLL_VCO);
         }
     }
 
@@ -343,6 +344,7 @@ int32_t DEV_SM_DisplayConfigLoad(void)
             {
                 status = SM_ERR_HARDWARE_ERROR;
             }
+            DEV_SM_ClockRateInvalidate(DEV_SM_CLK_LDBPLL_VCO);
         }
     }
 
@@ -413,6 +415,7 @@ int32_t DEV_SM_HsioTopConfigLoad(void)
             {
                 status = SM_ERR_HARDWARE_ERROR;
             }
+            DEV_SM_ClockRateInvalidate(DEV_SM_CLK_HSIOPLL_VCO);
         }
     }
 
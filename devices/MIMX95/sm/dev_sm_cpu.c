@@ -158,6 +158,9 @@ int32_t DEV_SM_CpuStart(uint32_t cpuId)
         status = SM_ERR_NOT_FOUND;
     }
 
+    /* Run mode changes GPC wake masks and LPM settings */
+    DEV_SM_SystemSleepPlanUpdate(cpuId);
+
     /* Return status */
     return status;
 }
@@ -175,6 +178,9 @@ int32_t DEV_SM_CpuHold(uint32_t cpuId)
         status = SM_ERR_NOT_FOUND;
     }
 
+    /* Run mode changes GPC wake masks and LPM settings */
+    DEV_SM_SystemSleepPlanUpdate(cpuId);
+
     /* Return status */
     return status;
 }
@@ -192,6 +198,9 @@ int32_t DEV_SM_CpuStop(uint32_t cpuId)
         status = SM_ERR_NOT_FOUND;
     }
 
+    /* Run mode changes GPC wake masks and LPM settings */
+    DEV_SM_SystemSleepPlanUpdate(cpuId);
+
     /* Return status */
     return status;
 }
@@ -283,6 +292,11 @@ int32_t DEV_SM_CpuIrqWakeSet(uint32_t cpuId, uint32_t maskIdx,
         {
             status = SM_ERR_NOT_FOUND;
         }
+        else
+        {
+            /* Update system sleep plan */
+            DEV_SM_SystemSleepPlanUpdate(cpuId);
+        }
     }
 
     /* Return status */
@@ -326,6 +340,11 @@ int32_t DEV_SM_CpuPdLpmConfigSet(uint32_t cpuId, uint32_t domainId,
     {
         status = SM_ERR_NOT_FOUND;
     }
+    else
+    {
+        /* Update system sleep plan */
+        DEV_SM_SystemSleepPlanUpdate(cpuId);
+    }
 
     /* Return status */
     return status;
@@ -45,6 +45,7 @@
 #include "config_mb_mu.h"
 #include "lmm.h"
 #include "eMcem_Vfccu.h"
+#include "trace.h"
 
 /* Local defines */
 
@@ -339,6 +340,12 @@ void SysTick_Handler(void)
     /* Call board tick */
     BRD_SM_TimerTick(BOARD_TICK_PERIOD_MSEC);
 
+    /* Call clock tick */
+    DEV_SM_ClockTick(BOARD_TICK_PERIOD_MSEC);
+
+    /* Call LMM tick */
+    LMM_Tick(BOARD_TICK_PERIOD_MSEC);
+
     s_smTimeMsec += BOARD_TICK_PERIOD_MSEC;
 }
 
@@ -641,6 +648,9 @@ void GPC_SM_REQ_IRQHandler(void)
         CPU_MixPowerUpNotify(lpHsMode.srcMixIdx);
         PWR_LpHandshakeAck();
         (void) DEV_SM_PowerUpAckComplete(lpHsMode.srcMixIdx);
+
+        /* Report power state change */
+        LMM_PowerEvent(lpHsMode.srcMixIdx, DEV_SM_POWER_STATE_ON);
     }
     /* Else powering down or asserting reset */
     else
@@ -648,6 +658,9 @@ void GPC_SM_REQ_IRQHandler(void)
         (void) DEV_SM_PowerDownPre(lpHsMode.srcMixIdx);
         CPU_MixPowerDownNotify(lpHsMode.srcMixIdx);
         PWR_LpHandshakeAck();
+
+        /* Report power state change */
+        LMM_PowerEvent(lpHsMode.srcMixIdx, DEV_SM_POWER_STATE_OFF);
     }
 }
 
@@ -982,6 +995,10 @@ static void IrqPrioUpdate(irq_prio_info_t *pInfo)
         /* Update IRQ counter */
         ++pInfo->irqCntr;
 
+        /* Trace IRQ */
+        SM_TRACE(SM_TRACE_CAT_IRQ, SM_TRACE_IRQ_DONE, pInfo->irqId,
+            pInfo->irqCntr);
+
         /* Get current priorty */
         IRQn_Type irqId = pInfo->irqId;
         uint32_t irqPrio = NVIC_GetPriority(irqId);
@@ -42,6 +42,8 @@
 #include "dev_sm.h"
 #include "brd_sm.h"
 #include "fsl_fract_pll.h"
+#include "fsl_ddr.h"
+#include "lmm.h"
 
 /* Local defines */
 
@@ -65,6 +67,17 @@
 
 #define DEV_SM_PERF_NUM_BUS_CLK     11U
 
+/* Perf domains driving and following NoC/bus demand */
+#define DEV_SM_NUM_PERF_BUS_DMD     5U
+#define DEV_SM_NUM_PERF_BUS         2U
+
+/* Max PFDs per PLL */
+#define DEV_SM_PERF_NUM_PFD         4U
+
+/* A55 core groups, each clocked by one ARMPLL PFD, platform on PFD3 */
+#define DEV_SM_NUM_A55_GRP          3U
+#define DEV_SM_A55_PFD_PLAT         3U
+
 /* Local types */
 
 /* Setpoint clock root configuration */
@@ -133,7 +146,44 @@ static uint32_t s_perfLevelCurrent[DEV_SM_NUM_PERF] =
     [DEV_SM_PERF_GPU] = DEV_SM_PERF_LVL_PRK,
     [DEV_SM_PERF_VPU] = DEV_SM_PERF_LVL_PRK,
     [DEV_SM_PERF_CAM] = DEV_SM_PERF_LVL_PRK,
-    [DEV_SM_PERF_DISP] = DEV_SM_PERF_LVL_PRK
+    [DEV_SM_PERF_DISP] = DEV_SM_PERF_LVL_PRK,
+    [DEV_SM_PERF_A55C01] = DEV_SM_PERF_LVL_PRK,
+    [DEV_SM_PERF_A55C23] = DEV_SM_PERF_LVL_PRK,
+    [DEV_SM_PERF_A55C45] = DEV_SM_PERF_LVL_PRK
+};
+
+/* Clock rate reporting suppressed during system sleep */
+static bool s_perfSleepActive = false;
+
+/* Aggregate NoC/bus demand of consuming perf domains */
+static uint32_t s_perfBusDemand = DEV_SM_PERF_LVL_PRK;
+
+/* Running level of MIX-level bus clocks */
+static uint32_t s_perfBusLevel = DEV_SM_PERF_LVL_NOM;
+
+/* VCO clock of each PLL */
+static uint32_t const s_perfPllClk[CLOCK_NUM_PLL] =
+{
+    [CLOCK_PLL_SYS1] = DEV_SM_CLK_SYSPLL1_VCO,
+    [CLOCK_PLL_AUDIO1] = DEV_SM_CLK_AUDIOPLL1_VCO,
+    [CLOCK_PLL_AUDIO2] = DEV_SM_CLK_AUDIOPLL2_VCO,
+    [CLOCK_PLL_VIDEO1] = DEV_SM_CLK_VIDEOPLL1_VCO,
+    [CLOCK_PLL_ARM] = DEV_SM_CLK_ARMPLL_VCO,
+    [CLOCK_PLL_DRAM] = DEV_SM_CLK_DRAMPLL_VCO,
+    [CLOCK_PLL_HSIO] = DEV_SM_CLK_HSIOPLL_VCO,
+    [CLOCK_PLL_LDB] = DEV_SM_CLK_LDBPLL_VCO
+};
+
+/* Ungated PFD clock of each PLL PFD */
+static uint32_t const s_perfPfdClk[CLOCK_NUM_PLL][DEV_SM_PERF_NUM_PFD] =
+{
+    [CLOCK_PLL_SYS1][0] = DEV_SM_CLK_SYSPLL1_PFD0_UNGATED,
+    [CLOCK_PLL_SYS1][1] = DEV_SM_CLK_SYSPLL1_PFD1_UNGATED,
+    [CLOCK_PLL_SYS1][2] = DEV_SM_CLK_SYSPLL1_PFD2_UNGATED,
+    [CLOCK_PLL_ARM][0] = DEV_SM_CLK_ARMPLL_PFD0_UNGATED,
+    [CLOCK_PLL_ARM][1] = DEV_SM_CLK_ARMPLL_PFD1_UNGATED,
+    [CLOCK_PLL_ARM][2] = DEV_SM_CLK_ARMPLL_PFD2_UNGATED,
+    [CLOCK_PLL_ARM][3] = DEV_SM_CLK_ARMPLL_PFD3_UNGATED
 };
 
 /* List of performance domains managed during sleep modes */
@@ -151,6 +201,23 @@ static uint32_t const s_perfSleepDomain[DEV_SM_NUM_PERF_SLEEP] =
     [9] = DEV_SM_PERF_DISP
 };
 
+/* List of performance domains consuming NoC/bus bandwidth */
+static uint32_t const s_perfBusDmdDomain[DEV_SM_NUM_PERF_BUS_DMD] =
+{
+    [0] = DEV_SM_PERF_A55,
+    [1] = DEV_SM_PERF_DRAM,
+    [2] = DEV_SM_PERF_VPU,
+    [3] = DEV_SM_PERF_CAM,
+    [4] = DEV_SM_PERF_DISP
+};
+
+/* List of interconnect performance domains scaled with NoC/bus demand */
+static uint32_t const s_perfBusDomain[DEV_SM_NUM_PERF_BUS] =
+{
+    [0] = DEV_SM_PERF_NOC,
+    [1] = DEV_SM_PERF_WAKEUP
+};
+
 /* Voltage setpoints for VDD_SOC */
 static uint32_t const s_perfDvsTableSoc[DEV_SM_NUM_PERF_LVL_SOC] =
 {
@@ -184,7 +251,7 @@ static dev_sm_perf_ps_cfg_t const s_psCfgArm =
 {
     .psIdx = PS_VDD_ARM,
     .idStart = DEV_SM_PERF_A55,
-    .idEnd = DEV_SM_PERF_A55,
+    .idEnd = DEV_SM_PERF_A55C45,
     .dvsTable = s_perfDvsTableArm
 };
 
@@ -1218,6 +1285,25 @@ static dev_sm_perf_root_cfg_t const s_perfRootCfgA55Per[DEV_SM_NUM_PERF_LVL_ARM]
     }
 };
 
+/* A55 GPR select bits clocked by each ARMPLL PFD */
+static uint32_t const s_perfA55PfdSelMask[DEV_SM_PERF_NUM_PFD] =
+{
+    [0] = CCM_GPR_SHARED1_CA55_CORE0_CLOCK_SELECT_MASK
+        | CCM_GPR_SHARED1_CA55_CORE1_CLOCK_SELECT_MASK,
+    [1] = CCM_GPR_SHARED1_CA55_CORE2_CLOCK_SELECT_MASK
+        | CCM_GPR_SHARED1_CA55_CORE3_CLOCK_SELECT_MASK,
+    [2] = CCM_GPR_SHARED1_CA55_CORE4_CLOCK_SELECT_MASK
+        | CCM_GPR_SHARED1_CA55_CORE5_CLOCK_SELECT_MASK,
+    [DEV_SM_A55_PFD_PLAT] = CCM_GPR_SHARED1_CA55_PLATFORM_CLOCK_SELECT_MASK
+};
+
+/* Measured DRAM transition time in uS, indexed by to level */
+static uint32_t s_perfDramLatUsec[DEV_SM_NUM_PERF_LVL_SOC];
+
+/* Measured A55 transition time in uS, indexed by from and to level */
+static uint32_t s_perfA55LatUsec[DEV_SM_NUM_PERF_LVL_ARM]
+    [DEV_SM_NUM_PERF_LVL_ARM];
+
 /* Max performance level */
 static uint32_t s_perfNumLevels[PS_NUM_SUPPLY];
 
@@ -1332,6 +1418,30 @@ static dev_sm_perf_cfg_t const s_perfCfg[DEV_SM_NUM_PERF] =
     },
 
     [DEV_SM_PERF_A55] =
+    {
+        .rootClk = CLOCK_ROOT_A55,
+        .srcMixIdx = PWR_MIX_SLICE_IDX_A55P,
+        .psCfg = &s_psCfgArm,
+        .desc = s_perfDescA55,
+        .rootCfg = &s_perfRootCfgA55,
+    },
+    [DEV_SM_PERF_A55C01] =
+    {
+        .rootClk = CLOCK_ROOT_A55,
+        .srcMixIdx = PWR_MIX_SLICE_IDX_A55P,
+        .psCfg = &s_psCfgArm,
+        .desc = s_perfDescA55,
+        .rootCfg = &s_perfRootCfgA55,
+    },
+    [DEV_SM_PERF_A55C23] =
+    {
+        .rootClk = CLOCK_ROOT_A55,
+        .srcMixIdx = PWR_MIX_SLICE_IDX_A55P,
+        .psCfg = &s_psCfgArm,
+        .desc = s_perfDescA55,
+        .rootCfg = &s_perfRootCfgA55,
+    },
+    [DEV_SM_PERF_A55C45] =
     {
         .rootClk = CLOCK_ROOT_A55,
         .srcMixIdx = PWR_MIX_SLICE_IDX_A55P,
@@ -1352,17 +1462,31 @@ static int32_t DEV_SM_PerfPllFreqUpdate(uint32_t pllIdx,
     dev_sm_perf_pll_cfg_t const * pllCfg);
 static int32_t DEV_SM_PerfPfdFreqUpdate(uint32_t pllIdx, uint8_t pfdIdx,
     dev_sm_perf_pfd_cfg_t const * pfdUpdate);
-static int32_t DEV_SM_PerfBusFreqSet(bool parkedLevel);
+static int32_t DEV_SM_PerfBusFreqSet(uint32_t perfLevel);
+static uint32_t DEV_SM_PerfBusDemandScan(void);
+static uint32_t DEV_SM_PerfBusLevelGet(uint32_t domainId, uint32_t perfLevel);
+static int32_t DEV_SM_PerfBusUpdate(void);
+static int32_t DEV_SM_PerfBusSupplySet(void);
+static void DEV_SM_PerfClockReport(uint32_t clockId, uint64_t oldRate);
+static void DEV_SM_PerfA55SelInvalidate(void);
 static int32_t DEV_SM_PerfWakeupFreqUpdate(uint32_t perfLevel);
 static int32_t DEV_SM_PerfVpuFreqUpdate(uint32_t perfLevel);
 static int32_t DEV_SM_PerfCamFreqUpdate(uint32_t perfLevel);
 static int32_t DEV_SM_PerfDispFreqUpdate(uint32_t perfLevel);
 static int32_t DEV_SM_PerfDramFreqUpdate(uint32_t perfLevel);
+static int32_t DEV_SM_PerfDramClockUpdate(uint32_t perfLevel);
 static int32_t DEV_SM_PerfA55FreqUpdate(uint32_t perfLevel);
+static int32_t DEV_SM_PerfA55GrpFreqUpdate(uint32_t domainId,
+    uint32_t perfLevel);
+static int32_t DEV_SM_PerfA55ClusterUpdate(uint32_t pllLevel,
+    uint32_t const *grpLevel);
+static void DEV_SM_PerfA55PfdCalc(uint32_t pllLevel, uint32_t perfLevel,
+    dev_sm_perf_pfd_cfg_t *pfdCfg);
 static int32_t DEV_SM_PerfFreqUpdate(uint32_t domainId, uint32_t perfLevel);
 static int32_t DEV_SM_PerfCurrentUpdate(uint32_t domainId, uint32_t perfLevel);
 static int32_t DEV_SM_PerfCurrentGet(uint32_t domainId, uint32_t * perfLevel);
 static uint32_t DEV_SM_PerfDramTypeGet(void);
+static bool DEV_SM_PerfDramPstateGet(uint32_t perfLevel, uint32_t *pstate);
 
 /*--------------------------------------------------------------------------*/
 /* Initialize performance domains                                           */
@@ -1371,12 +1495,13 @@ int32_t DEV_SM_PerfInit(uint32_t bootPerfLevel, uint32_t runPerfLevel)
 {
     int32_t status = SM_ERR_SUCCESS;
 
-    /* Initialize fixed SoC BUS clocks not configured by ROM */
-    (void) DEV_SM_PerfBusFreqSet(false);
+    /* Initialize SoC BUS clocks not configured by ROM */
+    (void) DEV_SM_PerfBusFreqSet(DEV_SM_PERF_LVL_NOM);
 
     /* NETCMIX configured separately (does not support frequency scaling) */
     (void) CCM_RootSetDiv(CLOCK_ROOT_ENET, 1U);
     (void) CCM_RootSetParent(CLOCK_ROOT_ENET, CLOCK_SRC_SYSPLL1_PFD2);
+    DEV_SM_ClockRateInvalidate(DEV_SM_CLK_ENET);
 
     /* Configure SYSPLL for software control (ROM sets hardware control) */
     SYS_PLL1->CTRL.CLR = PLL_CTRL_HW_CTRL_SEL_MASK;
@@ -1455,6 +1580,12 @@ int32_t DEV_SM_PerfInit(uint32_t bootPerfLevel, uint32_t runPerfLevel)
             domainId++;
         }
 
+        /* Scale NoC/bus clocks to demand of consuming domains */
+        if (status == SM_ERR_SUCCESS)
+        {
+            status = DEV_SM_PerfBusUpdate();
+        }
+
         /* If lowering performance level, decrease voltage last */
         if (bootPerfLevel > runPerfLevel)
         {
@@ -1491,7 +1622,10 @@ int32_t DEV_SM_PerfNameGet(uint32_t domainId, string *perfNameAddr,
         [DEV_SM_PERF_GPU] =    "gpu",
         [DEV_SM_PERF_VPU] =    "vpu",
         [DEV_SM_PERF_CAM] =    "cam",
-        [DEV_SM_PERF_DISP] =   "disp"
+        [DEV_SM_PERF_DISP] =   "disp",
+        [DEV_SM_PERF_A55C01] = "a55c01",
+        [DEV_SM_PERF_A55C23] = "a55c23",
+        [DEV_SM_PERF_A55C45] = "a55c45"
     };
 
     /* Get max string width */
@@ -1613,6 +1747,28 @@ int32_t DEV_SM_PerfDescribe(uint32_t domainId, uint32_t levelIndex,
             {
                 *desc = s_perfCfg[domainId].desc[levelIndex];
             }
+
+            /* Report worst measured DRAM transition into this level */
+            if ((domainId == DEV_SM_PERF_DRAM)
+                && (s_perfDramLatUsec[levelIndex] != 0U))
+            {
+                desc->latency = s_perfDramLatUsec[levelIndex];
+            }
+
+            /* Report worst measured A55 transition into this level */
+            if (domainId == DEV_SM_PERF_A55)
+            {
+                for (uint32_t fromLevel = 0U;
+                    fromLevel < DEV_SM_NUM_PERF_LVL_ARM; fromLevel++)
+                {
+                    if (s_perfA55LatUsec[fromLevel][levelIndex]
+                        > desc->latency)
+                    {
+                        desc->latency =
+                            s_perfA55LatUsec[fromLevel][levelIndex];
+                    }
+                }
+            }
         }
     }
 
@@ -1646,17 +1802,20 @@ int32_t DEV_SM_PerfLevelSet(uint32_t domainId, uint32_t perfLevel)
             uint32_t srcMixIdx = s_perfCfg[domainId].srcMixIdx;
             status = DEV_SM_PerfPowerCheck(perfLevel, srcMixIdx);
 
+            /* NoC/bus domains do not drop below consumer demand */
+            uint32_t freqLevel = DEV_SM_PerfBusLevelGet(domainId, perfLevel);
+
             if (status == SM_ERR_SUCCESS)
             {
                 /* If lowering perf level, adjust frequency first */
                 if (perfLevel < s_perfLevelCurrent[domainId])
                 {
-                    status = DEV_SM_PerfFreqUpdate(domainId, perfLevel);
+                    status = DEV_SM_PerfFreqUpdate(domainId, freqLevel);
                 }
             }
 
             /* Default max perf level to new requested level */
-            uint32_t maxPerfLevel = perfLevel;
+            uint32_t maxPerfLevel = freqLevel;
 
             if (status == SM_ERR_SUCCESS)
             {
@@ -1676,7 +1835,7 @@ int32_t DEV_SM_PerfLevelSet(uint32_t domainId, uint32_t perfLevel)
                 /* If raising perf level, adjust frequency last */
                 if (perfLevel > s_perfLevelCurrent[domainId])
                 {
-                    status = DEV_SM_PerfFreqUpdate(domainId, perfLevel);
+                    status = DEV_SM_PerfFreqUpdate(domainId, freqLevel);
                 }
             }
         }
@@ -1688,6 +1847,12 @@ int32_t DEV_SM_PerfLevelSet(uint32_t domainId, uint32_t perfLevel)
         status = DEV_SM_PerfCurrentUpdate(domainId, perfLevel);
     }
 
+    if (status == SM_ERR_SUCCESS)
+    {
+        /* Scale NoC/bus clocks to new demand */
+        status = DEV_SM_PerfBusUpdate();
+    }
+
     /* Return status */
     return status;
 }
@@ -1728,6 +1893,9 @@ int32_t DEV_SM_PerfSystemSleep(uint32_t perfLevelSleep)
         /* Find wake performance level */
         uint32_t perfLevelWake = DEV_SM_PerfSystemSleepScan();
 
+        /* Changes are undone on wake, don't report */
+        s_perfSleepActive = true;
+
         /* Raise VDD_SOC setpoint if sleep perf level higher than max
          * among sleep domains
          */
@@ -1747,7 +1915,8 @@ int32_t DEV_SM_PerfSystemSleep(uint32_t perfLevelSleep)
 
             uint32_t domainId = s_perfSleepDomain[slpIdx];
 
-            if (perfLevelSleep < s_perfLevelCurrent[domainId])
+            if (perfLevelSleep < DEV_SM_PerfBusLevelGet(domainId,
+                s_perfLevelCurrent[domainId]))
             {
                 status = DEV_SM_PerfFreqUpdate(domainId, perfLevelSleep);
             }
@@ -1758,7 +1927,7 @@ int32_t DEV_SM_PerfSystemSleep(uint32_t perfLevelSleep)
             /* If moving to parked level, update MIX-level bus clocks */
             if (perfLevelSleep == DEV_SM_PERF_LVL_PRK)
             {
-                status = DEV_SM_PerfBusFreqSet(true);
+                status = DEV_SM_PerfBusFreqSet(DEV_SM_PERF_LVL_PRK);
             }
         }
 
@@ -1800,6 +1969,9 @@ int32_t DEV_SM_PerfSystemWake(uint32_t perfLevelSleep)
 
     /* Note: s_perfLevelCurrent maintains perf rates to restore upon wake */
 
+    /* Restored rates match those before sleep */
+    s_perfSleepActive = true;
+
     /* Find wake performance level */
     uint32_t perfLevelWake = DEV_SM_PerfSystemSleepScan();
 
@@ -1821,7 +1993,7 @@ int32_t DEV_SM_PerfSystemWake(uint32_t perfLevelSleep)
     /* Unpark MIX-level bus clocks */
     if (status == SM_ERR_SUCCESS)
     {
-        status = DEV_SM_PerfBusFreqSet(false);
+        status = DEV_SM_PerfBusFreqSet(s_perfBusLevel);
     }
 
     /* Restore levels for perf domains in sleep list */
@@ -1833,7 +2005,7 @@ int32_t DEV_SM_PerfSystemWake(uint32_t perfLevelSleep)
         uint32_t perfIdx = s_perfSleepDomain[slpIdx];
 
         status = DEV_SM_PerfFreqUpdate(perfIdx,
-            s_perfLevelCurrent[perfIdx]);
+            DEV_SM_PerfBusLevelGet(perfIdx, s_perfLevelCurrent[perfIdx]));
         slpIdx++;
     }
 
@@ -1848,6 +2020,36 @@ int32_t DEV_SM_PerfSystemWake(uint32_t perfLevelSleep)
         }
     }
 
+    /* Resume reporting */
+    s_perfSleepActive = false;
+
+    /* Return status */
+    return status;
+}
+
+/*--------------------------------------------------------------------------*/
+/* Rescan NoC/bus demand after a mix changes power state                    */
+/*--------------------------------------------------------------------------*/
+int32_t DEV_SM_PerfPowerUpdate(uint32_t srcMixIdx)
+{
+    int32_t status = SM_ERR_SUCCESS;
+    bool consumer = false;
+
+    /* Check if mix hosts a NoC/bus demand consumer */
+    for (uint32_t dmdIdx = 0U; dmdIdx < DEV_SM_NUM_PERF_BUS_DMD; dmdIdx++)
+    {
+        if (s_perfCfg[s_perfBusDmdDomain[dmdIdx]].srcMixIdx == srcMixIdx)
+        {
+            consumer = true;
+        }
+    }
+
+    /* Sleep/wake sequence manages bus levels itself */
+    if (consumer && !s_perfSleepActive)
+    {
+        status = DEV_SM_PerfBusUpdate();
+    }
+
     /* Return status */
     return status;
 }
@@ -1916,16 +2118,21 @@ static int32_t DEV_SM_PerfMaxScan(uint32_t domainId, uint32_t *maxPerfLevel)
         {
             dev_sm_perf_ps_cfg_t const *psCfg = s_perfCfg[domainId].psCfg;
 
-            /* Scan other domains on same power supply  */
+            /* Scan other domains on same power supply, A55 level is
+             * derived from its subdomains
+             */
             for (uint32_t id = psCfg->idStart; id <= psCfg->idEnd; id++)
             {
-                if (id != domainId)
+                if ((id != domainId) && (id != DEV_SM_PERF_A55))
                 {
                     if (s_perfCfg[id].psCfg->psIdx == psCfg->psIdx)
                     {
-                        if (s_perfLevelCurrent[id] > *maxPerfLevel)
+                        uint32_t level = DEV_SM_PerfBusLevelGet(id,
+                            s_perfLevelCurrent[id]);
+
+                        if (level > *maxPerfLevel)
                         {
-                            *maxPerfLevel = s_perfLevelCurrent[id];
+                            *maxPerfLevel = level;
                         }
                     }
                 }
@@ -1948,9 +2155,12 @@ static uint32_t DEV_SM_PerfSystemSleepScan(void)
     for (uint32_t slpIdx = 0U; slpIdx < DEV_SM_NUM_PERF_SLEEP; slpIdx++)
     {
         uint32_t perfIdx = s_perfSleepDomain[slpIdx];
-        if (s_perfLevelCurrent[perfIdx] > maxPerfLevel)
+        uint32_t level = DEV_SM_PerfBusLevelGet(perfIdx,
+            s_perfLevelCurrent[perfIdx]);
+
+        if (level > maxPerfLevel)
         {
-            maxPerfLevel = s_perfLevelCurrent[perfIdx];
+            maxPerfLevel = level;
         }
     }
 
@@ -1987,6 +2197,11 @@ static int32_t DEV_SM_PerfRootFreqUpdate(uint32_t rootClk,
 
     uint32_t newDiv = rootCfg->rootDiv;
     uint32_t newParent = rootCfg->parent;
+    uint32_t clockId = rootClk + CLOCK_NUM_SRC;
+    uint64_t oldRate = 0ULL;
+
+    /* Get current rate */
+    (void) DEV_SM_ClockRateGet(clockId, &oldRate);
 
     if (status == SM_ERR_SUCCESS)
     {
@@ -2021,6 +2236,12 @@ static int32_t DEV_SM_PerfRootFreqUpdate(uint32_t rootClk,
         }
     }
 
+    /* Report rate change */
+    if (status == SM_ERR_SUCCESS)
+    {
+        DEV_SM_PerfClockReport(clockId, oldRate);
+    }
+
     /* Return status */
     return status;
 }
@@ -2032,6 +2253,13 @@ static int32_t DEV_SM_PerfPllFreqUpdate(uint32_t pllIdx,
     dev_sm_perf_pll_cfg_t const *pllCfg)
 {
     int32_t status = SM_ERR_SUCCESS;
+    uint64_t oldRate = 0ULL;
+
+    /* Get current rate */
+    if (pllIdx < CLOCK_NUM_PLL)
+    {
+        (void) DEV_SM_ClockRateGet(s_perfPllClk[pllIdx], &oldRate);
+    }
 
     if (!FRACTPLL_UpdateRate(pllIdx,
         pllCfg->mfi,
@@ -2041,6 +2269,12 @@ static int32_t DEV_SM_PerfPllFreqUpdate(uint32_t pllIdx,
         status = SM_ERR_HARDWARE_ERROR;
     }
 
+    /* Report rate change */
+    if (status == SM_ERR_SUCCESS)
+    {
+        DEV_SM_PerfClockReport(s_perfPllClk[pllIdx], oldRate);
+    }
+
     /* Return status */
     return status;
 }
@@ -2052,6 +2286,14 @@ static int32_t DEV_SM_PerfPfdFreqUpdate(uint32_t pllIdx, uint8_t pfdIdx,
     dev_sm_perf_pfd_cfg_t const *pfdUpdate)
 {
     int32_t status = SM_ERR_SUCCESS;
+    uint64_t oldRate = 0ULL;
+
+    /* Get current rate */
+    if ((pllIdx < CLOCK_NUM_PLL) && (pfdIdx < DEV_SM_PERF_NUM_PFD))
+    {
+        (void) DEV_SM_ClockRateGet(s_perfPfdClk[pllIdx][pfdIdx],
+            &oldRate);
+    }
 
     if (!FRACTPLL_UpdateDfsRate(pllIdx,
         pfdIdx,
@@ -2061,6 +2303,12 @@ static int32_t DEV_SM_PerfPfdFreqUpdate(uint32_t pllIdx, uint8_t pfdIdx,
         status = SM_ERR_HARDWARE_ERROR;
     }
 
+    /* Report rate change */
+    if (status == SM_ERR_SUCCESS)
+    {
+        DEV_SM_PerfClockReport(s_perfPfdClk[pllIdx][pfdIdx], oldRate);
+    }
+
     /* Return status */
     return status;
 }
@@ -2068,7 +2316,7 @@ static int32_t DEV_SM_PerfPfdFreqUpdate(uint32_t pllIdx, uint8_t pfdIdx,
 /*--------------------------------------------------------------------------*/
 /* Update MIX-level bus frequencies                                         */
 /*--------------------------------------------------------------------------*/
-static int32_t DEV_SM_PerfBusFreqSet(bool parkedLevel)
+static int32_t DEV_SM_PerfBusFreqSet(uint32_t perfLevel)
 {
     int32_t status = SM_ERR_SUCCESS;
 
@@ -2102,25 +2350,32 @@ static int32_t DEV_SM_PerfBusFreqSet(bool parkedLevel)
         [10] = 2U
     };
 
-    static const uint8_t s_busClkDiv[DEV_SM_PERF_NUM_BUS_CLK] =
+    /* Dividers per level: LOW = /4 (100MHz), NOM/ODV = /3 (133MHz) */
+    static const uint8_t s_busClkDiv[DEV_SM_NUM_PERF_LVL_SOC]
+        [DEV_SM_PERF_NUM_BUS_CLK] =
     {
-        [0] = 2U,
-        [1] = 2U,
-        [2] = 2U,
-        [3] = 2U,
-        [4] = 2U,
-        [5] = 2U,
-        [6] = 2U,
-        [7] = 2U,
-        [8] = 2U,
-        [9] = 2U,
-        [10] = 2U
+        [DEV_SM_PERF_LVL_LOW] =
+        {
+            3U, 3U, 3U, 3U, 3U, 3U, 3U, 3U, 3U, 3U, 3U
+        },
+        [DEV_SM_PERF_LVL_NOM] =
+        {
+            2U, 2U, 2U, 2U, 2U, 2U, 2U, 2U, 2U, 2U, 2U
+        },
+        [DEV_SM_PERF_LVL_ODV] =
+        {
+            2U, 2U, 2U, 2U, 2U, 2U, 2U, 2U, 2U, 2U, 2U
+        }
     };
 
+    if (perfLevel >= DEV_SM_NUM_PERF_LVL_SOC)
+    {
+        status = SM_ERR_OUT_OF_RANGE;
+    }
     /* Parked level moves bus clock source to OSC24M / 1 */
-    if (parkedLevel)
+    else if (perfLevel == DEV_SM_PERF_LVL_PRK)
     {
-        /* Update MIX-level bus clocks not scaled by perf levels  */
+        /* Update MIX-level bus clocks */
         for (uint32_t clkIdx = 0U; clkIdx < DEV_SM_PERF_NUM_BUS_CLK; clkIdx++)
         {
             uint32_t rootIdx = s_busClkRoot[clkIdx];
@@ -2155,14 +2410,14 @@ static int32_t DEV_SM_PerfBusFreqSet(bool parkedLevel)
         cr |= CCM_CLOCK_ROOT_MUX(0x2U);
         CCM_CTRL->CLOCK_ROOT[CLOCK_ROOT_BUSAON].CLOCK_ROOT_CONTROL.RW = cr;
 
-        /* Update MIX-level bus clocks not scaled by perf levels  */
+        /* Update MIX-level bus clocks scaled by NoC/bus demand */
         for (uint32_t clkIdx = 0U; clkIdx < DEV_SM_PERF_NUM_BUS_CLK; clkIdx++)
         {
             uint32_t rootIdx = s_busClkRoot[clkIdx];
             uint8_t rootSrcSel = s_busClkSrcSel[clkIdx];
-            uint8_t rootDiv = s_busClkDiv[clkIdx];
+            uint8_t rootDiv = s_busClkDiv[perfLevel][clkIdx];
 
-            /* Set DIV = 2 (/3) */
+            /* Set DIV */
             cr = CCM_CTRL->CLOCK_ROOT[rootIdx].CLOCK_ROOT_CONTROL.RW;
             cr &= (~(CCM_CLOCK_ROOT_DIV_MASK));
             cr |= CCM_CLOCK_ROOT_DIV(rootDiv);
@@ -2176,6 +2431,138 @@ static int32_t DEV_SM_PerfBusFreqSet(bool parkedLevel)
         }
     }
 
+    if (status == SM_ERR_SUCCESS)
+    {
+        /* Parked level is only used in sleep, keep level to restore */
+        if (perfLevel != DEV_SM_PERF_LVL_PRK)
+        {
+            s_perfBusLevel = perfLevel;
+        }
+
+        /* Bus roots are written directly, drop cached rates */
+        DEV_SM_ClockRateInvalidate(DEV_SM_NUM_CLOCK);
+    }
+
+    /* Return status */
+    return status;
+}
+
+/*--------------------------------------------------------------------------*/
+/* Scan for aggregate NoC/bus demand of consuming domains                   */
+/*--------------------------------------------------------------------------*/
+static uint32_t DEV_SM_PerfBusDemandScan(void)
+{
+    uint32_t demand = DEV_SM_PERF_LVL_PRK;
+
+    for (uint32_t dmdIdx = 0U; dmdIdx < DEV_SM_NUM_PERF_BUS_DMD; dmdIdx++)
+    {
+        uint32_t domainId = s_perfBusDmdDomain[dmdIdx];
+
+        /* A55 levels above ODV map to the top SoC level */
+        uint32_t level = MIN(s_perfLevelCurrent[domainId],
+            DEV_SM_PERF_LVL_ODV);
+
+        /* Skip consumers whose mix is powered down */
+        if (SRC_MixIsPwrSwitchOn(s_perfCfg[domainId].srcMixIdx))
+        {
+            demand = MAX(demand, level);
+        }
+    }
+
+    return demand;
+}
+
+/*--------------------------------------------------------------------------*/
+/* Apply NoC/bus demand to level of a performance domain                    */
+/*--------------------------------------------------------------------------*/
+static uint32_t DEV_SM_PerfBusLevelGet(uint32_t domainId, uint32_t perfLevel)
+{
+    uint32_t level = perfLevel;
+
+    /* NOC and WAKEUP run at least at the aggregate demand */
+    if ((domainId == DEV_SM_PERF_NOC) || (domainId == DEV_SM_PERF_WAKEUP))
+    {
+        level = MAX(perfLevel, s_perfBusDemand);
+    }
+
+    return level;
+}
+
+/*--------------------------------------------------------------------------*/
+/* Scale NoC/bus clocks to aggregate demand                                 */
+/*--------------------------------------------------------------------------*/
+static int32_t DEV_SM_PerfBusUpdate(void)
+{
+    int32_t status = SM_ERR_SUCCESS;
+    uint32_t oldDemand = s_perfBusDemand;
+    uint32_t newDemand = DEV_SM_PerfBusDemandScan();
+
+    s_perfBusDemand = newDemand;
+
+    /* If raising demand, increase VDD_SOC first */
+    if (newDemand > oldDemand)
+    {
+        status = DEV_SM_PerfBusSupplySet();
+    }
+
+    /* Update NoC domains whose effective level changed */
+    if (newDemand != oldDemand)
+    {
+        for (uint32_t idx = 0U; (status == SM_ERR_SUCCESS)
+            && (idx < DEV_SM_NUM_PERF_BUS); idx++)
+        {
+            uint32_t domainId = s_perfBusDomain[idx];
+            uint32_t reqLevel = s_perfLevelCurrent[domainId];
+
+            if (MAX(reqLevel, oldDemand) != MAX(reqLevel, newDemand))
+            {
+                status = DEV_SM_PerfFreqUpdate(domainId,
+                    MAX(reqLevel, newDemand));
+            }
+        }
+    }
+
+    /* MIX-level bus clocks follow NOC, parked only in system sleep */
+    if (status == SM_ERR_SUCCESS)
+    {
+        uint32_t busLevel = MAX(DEV_SM_PERF_LVL_LOW,
+            DEV_SM_PerfBusLevelGet(DEV_SM_PERF_NOC,
+            s_perfLevelCurrent[DEV_SM_PERF_NOC]));
+
+        if (busLevel != s_perfBusLevel)
+        {
+            status = DEV_SM_PerfBusFreqSet(busLevel);
+        }
+    }
+
+    /* If lowering demand, decrease VDD_SOC last */
+    if ((status == SM_ERR_SUCCESS) && (newDemand < oldDemand))
+    {
+        status = DEV_SM_PerfBusSupplySet();
+    }
+
+    /* Return status */
+    return status;
+}
+
+/*--------------------------------------------------------------------------*/
+/* Update VDD_SOC setpoint for NoC/bus demand                               */
+/*--------------------------------------------------------------------------*/
+static int32_t DEV_SM_PerfBusSupplySet(void)
+{
+    int32_t status;
+    uint32_t maxPerfLevel = DEV_SM_PerfBusLevelGet(DEV_SM_PERF_NOC,
+        s_perfLevelCurrent[DEV_SM_PERF_NOC]);
+
+    /* Scan for highest perf level of VDD_SOC */
+    status = DEV_SM_PerfMaxScan(DEV_SM_PERF_NOC, &maxPerfLevel);
+
+    if (status == SM_ERR_SUCCESS)
+    {
+        status = BRD_SM_SupplyLevelSet(PS_VDD_SOC,
+            s_perfDvsTableSoc[maxPerfLevel]);
+    }
+
     /* Return status */
     return status;
 }
@@ -2300,25 +2687,100 @@ static int32_t DEV_SM_PerfDispFreqUpdate(uint32_t perfLevel)
 static int32_t DEV_SM_PerfDramFreqUpdate(uint32_t perfLevel)
 {
     int32_t status = SM_ERR_SUCCESS;
+    const struct ddr_info *ddr = (struct ddr_info*) &__DramInfo;
+    uint64_t startUsec = DEV_SM_Usec64Get();
+    uint32_t pstate = 0U;
+    uint32_t oldLevel = DEV_SM_PERF_LVL_PRK;
+    uint32_t oldPstate = DDR_PstateGet();
+    bool freqChange = false;
+    bool srActive = false;
 
     if (perfLevel >= DEV_SM_NUM_PERF_LVL_SOC)
     {
         status = SM_ERR_OUT_OF_RANGE;
     }
+    else
+    {
+        /* Use DDRC frequency change if level has a pstate image */
+        freqChange = DEV_SM_PerfDramPstateGet(perfLevel, &pstate);
+    }
+
+    if (freqChange)
+    {
+        /* Level to restore if the change fails */
+        if (DEV_SM_PerfCurrentGet(DEV_SM_PERF_DRAM, &oldLevel)
+            != SM_ERR_SUCCESS)
+        {
+            oldLevel = DEV_SM_PERF_LVL_PRK;
+        }
+
+        /* Halt DDRC and place DRAM into self-refresh */
+        if (!DDR_FreqChangeEnter(ddr, pstate))
+        {
+            status = SM_ERR_HARDWARE_ERROR;
+        }
+        else
+        {
+            srActive = true;
+        }
+    }
+
     if (status == SM_ERR_SUCCESS)
     {
-        if (DEV_SM_PerfDramTypeGet()== 4U)
+        status = DEV_SM_PerfDramClockUpdate(perfLevel);
+    }
+
+    if (srActive)
+    {
+        if (status == SM_ERR_SUCCESS)
         {
-            status = DEV_SM_PerfRootFreqUpdate(CLOCK_ROOT_DRAMALT,
-                &s_perfRootCfgDramLp4x);
+            /* Load pstate timing and exit self-refresh */
+            if (!DDR_FreqChangeExit(ddr, pstate))
+            {
+                status = SM_ERR_HARDWARE_ERROR;
+            }
         }
         else
         {
-            status = DEV_SM_PerfRootFreqUpdate(CLOCK_ROOT_DRAMALT,
-                &s_perfRootCfgDramLp5);
+            /* Restore the clock of the active pstate and exit */
+            (void) DEV_SM_PerfDramClockUpdate(oldLevel);
+            (void) DDR_FreqChangeExit(ddr, oldPstate);
+        }
+    }
+
+    /* Record worst transition time into this level */
+    if (status == SM_ERR_SUCCESS)
+    {
+        uint32_t usec = SM_UINT64_L(DEV_SM_Usec64Get() - startUsec);
+
+        if (usec > s_perfDramLatUsec[perfLevel])
+        {
+            s_perfDramLatUsec[perfLevel] = usec;
         }
     }
 
+    /* Return status */
+    return status;
+}
+
+/*--------------------------------------------------------------------------*/
+/* Update DRAM clock of performance level                                   */
+/*--------------------------------------------------------------------------*/
+static int32_t DEV_SM_PerfDramClockUpdate(uint32_t perfLevel)
+{
+    int32_t status;
+
+    if (DEV_SM_PerfDramTypeGet()== 4U)
+    {
+        status = DEV_SM_PerfRootFreqUpdate(CLOCK_ROOT_DRAMALT,
+            &s_perfRootCfgDramLp4x);
+    }
+    else
+    {
+        status = DEV_SM_PerfRootFreqUpdate(CLOCK_ROOT_DRAMALT,
+            &s_perfRootCfgDramLp5);
+    }
+
     uint32_t selIdx = g_clockGprSel[CLOCK_GPR_SEL_DRAM].selIdx;
     uint32_t selMask = g_clockGprSel[CLOCK_GPR_SEL_DRAM].selMask;
 
@@ -2328,6 +2790,7 @@ static int32_t DEV_SM_PerfDramFreqUpdate(uint32_t perfLevel)
         {
             status = SM_ERR_HARDWARE_ERROR;
         }
+        DEV_SM_ClockRateInvalidate(DEV_SM_CLK_DRAM_GPR_SEL);
     }
     if (status == SM_ERR_SUCCESS)
     {
@@ -2350,6 +2813,7 @@ static int32_t DEV_SM_PerfDramFreqUpdate(uint32_t perfLevel)
                 {
                     status = SM_ERR_HARDWARE_ERROR;
                 }
+                DEV_SM_ClockRateInvalidate(DEV_SM_CLK_DRAM_GPR_SEL);
             }
         }
     }
@@ -2363,65 +2827,163 @@ static int32_t DEV_SM_PerfDramFreqUpdate(uint32_t perfLevel)
 /*--------------------------------------------------------------------------*/
 static int32_t DEV_SM_PerfA55FreqUpdate(uint32_t perfLevel)
 {
-    int32_t status = SM_ERR_SUCCESS;
+    int32_t status;
+    uint64_t startUsec = DEV_SM_Usec64Get();
+    uint32_t fromLevel = s_perfLevelCurrent[DEV_SM_PERF_A55];
+    uint32_t grpLevel[DEV_SM_NUM_A55_GRP];
 
-    if (perfLevel >= DEV_SM_NUM_PERF_LVL_ARM)
+    /* All core groups follow the A55 domain */
+    for (uint32_t grp = 0U; grp < DEV_SM_NUM_A55_GRP; grp++)
     {
-        status = SM_ERR_OUT_OF_RANGE;
+        grpLevel[grp] = perfLevel;
     }
-    if (status == SM_ERR_SUCCESS)
+
+    status = DEV_SM_PerfA55ClusterUpdate(perfLevel, grpLevel);
+
+    /* Record worst transition time per level pair */
+    if ((status == SM_ERR_SUCCESS) && (fromLevel < DEV_SM_NUM_PERF_LVL_ARM)
+        && (fromLevel != perfLevel))
     {
-        status = DEV_SM_PerfRootFreqUpdate(CLOCK_ROOT_A55, &s_perfRootCfgA55);
+        uint32_t usec = UINT64_L(DEV_SM_Usec64Get() - startUsec);
+
+        if (usec > s_perfA55LatUsec[fromLevel][perfLevel])
+        {
+            s_perfA55LatUsec[fromLevel][perfLevel] = usec;
+        }
+    }
+
+    /* Return status */
+    return status;
+}
+
+/*--------------------------------------------------------------------------*/
+/* Update A55 core group frequency of performance level                     */
+/*--------------------------------------------------------------------------*/
+static int32_t DEV_SM_PerfA55GrpFreqUpdate(uint32_t domainId,
+    uint32_t perfLevel)
+{
+    uint32_t grpLevel[DEV_SM_NUM_A55_GRP];
+    uint32_t pllLevel = perfLevel;
+
+    /* ARMPLL runs at the level of the fastest group */
+    for (uint32_t grp = 0U; grp < DEV_SM_NUM_A55_GRP; grp++)
+    {
+        uint32_t id = DEV_SM_PERF_A55C01 + grp;
+
+        grpLevel[grp] = (id == domainId) ? perfLevel
+            : s_perfLevelCurrent[id];
+        pllLevel = MAX(pllLevel, grpLevel[grp]);
     }
 
+    /* Return status */
+    return DEV_SM_PerfA55ClusterUpdate(pllLevel, grpLevel);
+}
+
+/*--------------------------------------------------------------------------*/
+/* Update A55 cluster and core group frequencies                            */
+/*--------------------------------------------------------------------------*/
+static int32_t DEV_SM_PerfA55ClusterUpdate(uint32_t pllLevel,
+    uint32_t const *grpLevel)
+{
+    int32_t status = SM_ERR_SUCCESS;
+    dev_sm_perf_pfd_cfg_t pfdCfg[DEV_SM_PERF_NUM_PFD] = { 0 };
+    bool pfdSet[DEV_SM_PERF_NUM_PFD] = { false };
+    bool pllSet = false;
     uint32_t selIdx = DEV_SM_A55_GPR_SEL_IDX;
     uint32_t selMask = DEV_SM_A55_GPR_SEL_MASK;
+    uint32_t parkMask = selMask;
+    uint32_t runMask = 0U;
 
-    if (status == SM_ERR_SUCCESS)
+    if (pllLevel >= DEV_SM_NUM_PERF_LVL_ARM)
     {
-        if (!CCM_GprValSet(selIdx, selMask, 0U))
+        status = SM_ERR_OUT_OF_RANGE;
+    }
+    else if (pllLevel > DEV_SM_PERF_LVL_PRK)
+    {
+        /* Platform follows ARMPLL, slower groups divide down further */
+        pfdCfg[DEV_SM_A55_PFD_PLAT] = s_perfPfdCfgA55P[pllLevel];
+        runMask = s_perfA55PfdSelMask[DEV_SM_A55_PFD_PLAT];
+        for (uint8_t grp = 0U; grp < DEV_SM_NUM_A55_GRP; grp++)
         {
-            status = SM_ERR_HARDWARE_ERROR;
+            if ((grpLevel[grp] == pllLevel)
+                || (grpLevel[grp] == DEV_SM_PERF_LVL_PRK))
+            {
+                pfdCfg[grp] = s_perfPfdCfgA55C[pllLevel];
+            }
+            else
+            {
+                DEV_SM_PerfA55PfdCalc(pllLevel, grpLevel[grp],
+                    &pfdCfg[grp]);
+            }
+
+            /* Parked groups stay on CLOCK_ROOT_A55 */
+            if (grpLevel[grp] > DEV_SM_PERF_LVL_PRK)
+            {
+                runMask |= s_perfA55PfdSelMask[grp];
+            }
+        }
+
+        /* ARMPLL keeps its setpoint while parked, check what remains */
+        pllSet = FRACTPLL_CheckRate(CLOCK_PLL_ARM,
+            s_perfPllCfgA55[pllLevel].mfi, s_perfPllCfgA55[pllLevel].mfn,
+            s_perfPllCfgA55[pllLevel].odiv);
+        parkMask = pllSet ? 0U : selMask;
+        for (uint8_t pfdIdx = 0U; pfdIdx < DEV_SM_PERF_NUM_PFD; pfdIdx++)
+        {
+            pfdSet[pfdIdx] = pllSet && FRACTPLL_CheckDfsRate(CLOCK_PLL_ARM,
+                pfdIdx, pfdCfg[pfdIdx].mfi, pfdCfg[pfdIdx].mfn);
+            if (!pfdSet[pfdIdx])
+            {
+                parkMask |= s_perfA55PfdSelMask[pfdIdx];
+            }
+        }
+    }
+    else
+    {
+        ; /* Intentional empty else */
+    }
+
+    /* Park on CLOCK_ROOT_A55 only cores whose PFD must be reprogrammed */
+    if ((status == SM_ERR_SUCCESS) && (parkMask != 0U))
+    {
+        status = DEV_SM_PerfRootFreqUpdate(CLOCK_ROOT_A55, &s_perfRootCfgA55);
+
+        if (status == SM_ERR_SUCCESS)
+        {
+            if (!CCM_GprValSet(selIdx, parkMask, 0U))
+            {
+                status = SM_ERR_HARDWARE_ERROR;
+            }
+            DEV_SM_PerfA55SelInvalidate();
         }
     }
     if (status == SM_ERR_SUCCESS)
     {
         status = DEV_SM_PerfRootFreqUpdate(CLOCK_ROOT_A55PERIPH,
-            &s_perfRootCfgA55Per[perfLevel]);
+            &s_perfRootCfgA55Per[pllLevel]);
     }
-    if (status == SM_ERR_SUCCESS)
+    if ((status == SM_ERR_SUCCESS) && (pllLevel > DEV_SM_PERF_LVL_PRK))
     {
-        if (perfLevel > DEV_SM_PERF_LVL_PRK)
+        if (!pllSet)
         {
             status = DEV_SM_PerfPllFreqUpdate(CLOCK_PLL_ARM,
-                &s_perfPllCfgA55[perfLevel]);
-            if (status == SM_ERR_SUCCESS)
-            {
-                status = DEV_SM_PerfPfdFreqUpdate(CLOCK_PLL_ARM, 0U,
-                    &s_perfPfdCfgA55C[perfLevel]);
-            }
-            if (status == SM_ERR_SUCCESS)
-            {
-                status = DEV_SM_PerfPfdFreqUpdate(CLOCK_PLL_ARM, 1U,
-                    &s_perfPfdCfgA55C[perfLevel]);
-            }
-            if (status == SM_ERR_SUCCESS)
-            {
-                status = DEV_SM_PerfPfdFreqUpdate(CLOCK_PLL_ARM, 2U,
-                    &s_perfPfdCfgA55C[perfLevel]);
-            }
-            if (status == SM_ERR_SUCCESS)
+                &s_perfPllCfgA55[pllLevel]);
+        }
+        for (uint8_t pfdIdx = 0U; pfdIdx < DEV_SM_PERF_NUM_PFD; pfdIdx++)
+        {
+            if ((status == SM_ERR_SUCCESS) && !pfdSet[pfdIdx])
             {
-                status = DEV_SM_PerfPfdFreqUpdate(CLOCK_PLL_ARM, 3U,
-                    &s_perfPfdCfgA55P[perfLevel]);
+                status = DEV_SM_PerfPfdFreqUpdate(CLOCK_PLL_ARM, pfdIdx,
+                    &pfdCfg[pfdIdx]);
             }
-            if (status == SM_ERR_SUCCESS)
+        }
+        if (status == SM_ERR_SUCCESS)
+        {
+            if (!CCM_GprValSet(selIdx, selMask, runMask))
             {
-                if (!CCM_GprValSet(selIdx, selMask, selMask))
-                {
-                    status = SM_ERR_HARDWARE_ERROR;
-                }
+                status = SM_ERR_HARDWARE_ERROR;
             }
+            DEV_SM_PerfA55SelInvalidate();
         }
     }
 
@@ -2429,6 +2991,27 @@ static int32_t DEV_SM_PerfA55FreqUpdate(uint32_t perfLevel)
     return status;
 }
 
+/*--------------------------------------------------------------------------*/
+/* Calculate A55 core group PFD divider for a level below ARMPLL level      */
+/*--------------------------------------------------------------------------*/
+static void DEV_SM_PerfA55PfdCalc(uint32_t pllLevel, uint32_t perfLevel,
+    dev_sm_perf_pfd_cfg_t *pfdCfg)
+{
+    dev_sm_perf_pll_cfg_t const *pllCfg = &s_perfPllCfgA55[pllLevel];
+    uint64_t vcoKhz = (((uint64_t) CLOCK_PLL_FREF_HZ) * pllCfg->mfi)
+        + ((((uint64_t) CLOCK_PLL_FREF_HZ) * pllCfg->mfn) / VCO_MFD);
+    uint64_t levelKhz = s_perfDescA55[perfLevel].value;
+
+    vcoKhz = vcoKhz / 1000ULL;
+
+    /* PFD divides by mfi + mfn/5, round up to never exceed the level */
+    uint64_t div5 = ((vcoKhz * 5ULL) + levelKhz - 1ULL) / levelKhz;
+    div5 = MAX(div5, 10ULL);
+
+    pfdCfg->mfi = (uint32_t) (div5 / 5ULL);
+    pfdCfg->mfn = (uint32_t) (div5 % 5ULL);
+}
+
 /*--------------------------------------------------------------------------*/
 /* Update frequency of performance level                                    */
 /*--------------------------------------------------------------------------*/
@@ -2456,6 +3039,12 @@ static int32_t DEV_SM_PerfFreqUpdate(uint32_t domainId, uint32_t perfLevel)
                 status = DEV_SM_PerfA55FreqUpdate(perfLevel);
                 break;
 
+            case DEV_SM_PERF_A55C01:
+            case DEV_SM_PERF_A55C23:
+            case DEV_SM_PERF_A55C45:
+                status = DEV_SM_PerfA55GrpFreqUpdate(domainId, perfLevel);
+                break;
+
             case DEV_SM_PERF_VPU:
                 status = DEV_SM_PerfVpuFreqUpdate(perfLevel);
                 break;
@@ -2507,8 +3096,32 @@ static int32_t DEV_SM_PerfCurrentUpdate(uint32_t domainId, uint32_t perfLevel)
                 /* Update all subdomains */
                 for (uint32_t id = psCfg->idStart; id <= psCfg->idEnd; id++)
                 {
-                    s_perfLevelCurrent[id] = perfLevel;
+                    if (s_perfCfg[id].psCfg->psIdx == psCfg->psIdx)
+                    {
+                        s_perfLevelCurrent[id] = perfLevel;
+                        LMM_PerfLevelEvent(id, perfLevel);
+                    }
+                }
+            }
+            break;
+        case DEV_SM_PERF_A55C01:
+        case DEV_SM_PERF_A55C23:
+        case DEV_SM_PERF_A55C45:
+            {
+                uint32_t maxLevel = DEV_SM_PERF_LVL_PRK;
+
+                s_perfLevelCurrent[domainId] = perfLevel;
+
+                /* A55 runs at the level of the fastest subdomain */
+                for (uint32_t grp = 0U; grp < DEV_SM_NUM_A55_GRP; grp++)
+                {
+                    maxLevel = MAX(maxLevel,
+                        s_perfLevelCurrent[DEV_SM_PERF_A55C01 + grp]);
                 }
+                s_perfLevelCurrent[DEV_SM_PERF_A55] = maxLevel;
+
+                LMM_PerfLevelEvent(domainId, perfLevel);
+                LMM_PerfLevelEvent(DEV_SM_PERF_A55, maxLevel);
             }
             break;
         default:
@@ -2519,6 +3132,7 @@ static int32_t DEV_SM_PerfCurrentUpdate(uint32_t domainId, uint32_t perfLevel)
             else
             {
                 s_perfLevelCurrent[domainId] = perfLevel;
+                LMM_PerfLevelEvent(domainId, perfLevel);
             }
             break;
     }
@@ -2619,3 +3233,76 @@ static uint32_t DEV_SM_PerfDramTypeGet(void)
 
     return s_perfDramType;
 }
+
+/*--------------------------------------------------------------------------*/
+/* Find the DDR pstate image matching a DRAM performance level              */
+/*--------------------------------------------------------------------------*/
+static bool DEV_SM_PerfDramPstateGet(uint32_t perfLevel, uint32_t *pstate)
+{
+    bool found = false;
+    const struct ddr_info *ddr = (struct ddr_info*) &__DramInfo;
+
+    /* Pstate images are only provided for multi-pstate DDR configs */
+    if ((perfLevel > DEV_SM_PERF_LVL_PRK)
+        && (perfLevel < DEV_SM_NUM_PERF_LVL_SOC)
+        && (ddr->pstate != NULL) && (ddr->pstate_num > 1U))
+    {
+        uint32_t numPstate = MIN(ddr->pstate_num, 4U);
+        uint64_t mtsKhz;
+
+        /* DRAM rate in KHz is 1/8 of the MT/s of the pstate */
+        if (DEV_SM_PerfDramTypeGet() == 4U)
+        {
+            mtsKhz = ((uint64_t) s_perfDescDramLp4x[perfLevel].value) * 8U;
+        }
+        else
+        {
+            mtsKhz = ((uint64_t) s_perfDescDramLp5[perfLevel].value) * 8U;
+        }
+
+        /* Match within 1% to allow for rounded MT/s values */
+        for (uint32_t idx = 0U; idx < numPstate; idx++)
+        {
+            uint64_t freqKhz = ((uint64_t) ddr->pstate_freq[idx]) * 1000U;
+            uint64_t diff = (freqKhz > mtsKhz) ? (freqKhz - mtsKhz)
+                : (mtsKhz - freqKhz);
+
+            if ((diff * 100U) <= mtsKhz)
+            {
+                *pstate = idx;
+                found = true;
+                break;
+            }
+        }
+    }
+
+    return found;
+}
+
+/*--------------------------------------------------------------------------*/
+/* Report clock rate change of performance level update                     */
+/*--------------------------------------------------------------------------*/
+static void DEV_SM_PerfClockReport(uint32_t clockId, uint64_t oldRate)
+{
+    /* Skip transient sleep changes */
+    if (!s_perfSleepActive)
+    {
+        DEV_SM_ClockRateReport(clockId, oldRate);
+    }
+    else
+    {
+        DEV_SM_ClockRateInvalidate(clockId);
+    }
+}
+
+/*--------------------------------------------------------------------------*/
+/* Invalidate cached rates of A55 GPR selects                               */
+/*--------------------------------------------------------------------------*/
+static void DEV_SM_PerfA55SelInvalidate(void)
+{
+    for (uint32_t clockId = DEV_SM_CLK_A55C0_GPR_SEL;
+        clockId <= DEV_SM_CLK_A55P_GPR_SEL; clockId++)
+    {
+        DEV_SM_ClockRateInvalidate(clockId);
+    }
+}
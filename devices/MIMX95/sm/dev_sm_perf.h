@@ -55,7 +55,7 @@
 /* Defines */
 
 /*! Number of device performance domains */
-#define DEV_SM_NUM_PERF     13U
+#define DEV_SM_NUM_PERF     16U
 
 /*!
  * @name Device performance domain indexes
@@ -74,6 +74,9 @@
 #define DEV_SM_PERF_VPU     10U  /*!< VPU domain */
 #define DEV_SM_PERF_CAM     11U  /*!< CAM domain */
 #define DEV_SM_PERF_DISP    12U  /*!< DISP domain */
+#define DEV_SM_PERF_A55C01  13U  /*!< A55 core 0-1 subdomain */
+#define DEV_SM_PERF_A55C23  14U  /*!< A55 core 2-3 subdomain */
+#define DEV_SM_PERF_A55C45  15U  /*!< A55 core 4-5 subdomain */
 /** @} */
 
 /*!
@@ -91,6 +94,19 @@
 
 /* Functions */
 
+/*!
+ * Update NoC/bus demand for a power change.
+ *
+ * @param[in]   srcMixIdx  Index of the mix that changed power state
+ *
+ * Called after a mix is powered up or down. If the mix hosts a domain
+ * that sets NoC/bus demand, the demand is rescanned and the NoC, WAKEUP
+ * and bus clocks are scaled to match.
+ *
+ * @return Returns the status (::SM_ERR_SUCCESS = success).
+ */
+int32_t DEV_SM_PerfPowerUpdate(uint32_t srcMixIdx);
+
 /** @} */
 
 /* Include SM device API */
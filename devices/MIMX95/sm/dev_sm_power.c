@@ -207,6 +207,18 @@ int32_t DEV_SM_PowerStateSet(uint32_t domainId, uint8_t powerState)
         }
     }
 
+    /* PLL rates depend on the power state of their mix */
+    if (status == SM_ERR_SUCCESS)
+    {
+        DEV_SM_ClockRateInvalidate(DEV_SM_NUM_CLOCK);
+    }
+
+    /* NoC/bus demand depends on the power state of consumers */
+    if (status == SM_ERR_SUCCESS)
+    {
+        status = DEV_SM_PerfPowerUpdate(domainId);
+    }
+
     /* Return status */
     return status;
 }
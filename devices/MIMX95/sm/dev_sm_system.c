@@ -41,23 +41,65 @@
 #include "sm.h"
 #include "dev_sm.h"
 #include "lmm.h"
+#include "fsl_bbnsm.h"
 #include "fsl_ddr.h"
 #include "fsl_power.h"
 #include "fsl_reset.h"
 #include "fsl_sysctr.h"
+#include "trace.h"
 
 /* Local defines */
 
 #define DEV_SM_NUM_SLEEP_ROOTS  3U
 
+/* SysTick exception number, as reported in ICSR.VECTPENDING */
+#define DEV_SM_VECT_SYSTICK     ((uint32_t) (((int32_t) SysTick_IRQn) \
+    + NVIC_USER_IRQ_OFFSET))
+
 /* Local types */
 
+/* System sleep plan, updated when CPU wake/LPM config changes */
+typedef struct
+{
+    /* GPC wake masks per CPU */
+    uint32_t cpuWakeMask[CPU_NUM_IDX][GPC_CPU_CTRL_CMC_IRQ_WAKEUP_MASK_COUNT];
+
+    /* NOCMIX/WAKEUPMIX LPM settings per CPU */
+    uint32_t cpuLpmNoc[CPU_NUM_IDX];
+    uint32_t cpuLpmWakeup[CPU_NUM_IDX];
+
+    /* System wake mask, AND of active CPU masks */
+    uint32_t sysWakeMask[GPC_CPU_CTRL_CMC_IRQ_WAKEUP_MASK_COUNT];
+
+    /* NOCMIX/WAKEUPMIX dependencies, max of active CPU settings */
+    uint32_t lpmSettingNoc;
+    uint32_t lpmSettingWakeup;
+
+    /* CPUs not sleep forced when the aggregate was built */
+    uint32_t activeMask;
+
+    /* CPUs with cached state to reload */
+    uint32_t dirtyMask;
+} dev_sm_sleep_plan_t;
+
 /* Local variables */
 
 static uint32_t s_sysSleepMode = 0U;
 static uint32_t s_sysSleepFlags = 0U;
 static dev_sm_rst_rec_t s_shutdownRecord = { 0 };
 static BLK_CTRL_DDRMIX_Type ddr_blk_ctrl;
+static uint64_t s_idleStart = 0ULL;
+static bool s_idleTickWake = false;
+static dev_sm_sleep_plan_t s_sleepPlan;
+
+/* Local functions */
+
+static void DEV_SM_SystemSleepStatsUpdate(void);
+static uint32_t DEV_SM_SystemSleepHistBin(uint32_t usec);
+static uint32_t DEV_SM_SystemIdleSelect(void);
+static uint64_t DEV_SM_SystemIdleTimerGet(void);
+static void DEV_SM_SystemIdleEwma(uint32_t *avg, uint32_t sample);
+static void DEV_SM_SystemSleepPlanLoad(void);
 
 /*--------------------------------------------------------------------------*/
 /* Initialize system functions                                              */
@@ -89,6 +131,15 @@ int32_t DEV_SM_SystemInit(void)
         (BLK_CTRL_S_AONMIX_M7_CFG_CORECLK_FORCE_ON_MASK |
         BLK_CTRL_S_AONMIX_M7_CFG_HCLK_FORCE_ON_MASK);
 
+    /* Sleep plan loads all agent CPUs on first use */
+    s_sleepPlan.dirtyMask = ((1UL << CPU_NUM_IDX) - 1UL)
+        & (~(1UL << CPU_IDX_M33P));
+
+    /* Seed idle governor latencies until measured */
+    dev_sm_idle_gov_t *gov = &g_syslog.sysIdleGov;
+    gov->latUsec[DEV_SM_IDLE_SHALLOW] = DEV_SM_IDLE_LAT_SHALLOW;
+    gov->latUsec[DEV_SM_IDLE_DEEP] = DEV_SM_IDLE_LAT_DEEP;
+
     /* Return status */
     return status;
 }
@@ -103,6 +154,86 @@ void DEV_SM_SystemSleepModeSet(uint32_t sleepMode, uint32_t sleepFlags)
     s_sysSleepFlags = sleepFlags;
 }
 
+/*--------------------------------------------------------------------------*/
+/* Update sleep plan for CPU wake/LPM change                                */
+/*--------------------------------------------------------------------------*/
+void DEV_SM_SystemSleepPlanUpdate(uint32_t cpuId)
+{
+    /* A55 platform changes can apply to all A55 cores */
+    if (cpuId == CPU_IDX_A55P)
+    {
+        for (uint32_t cpuIdx = CPU_IDX_A55C0; cpuIdx <= CPU_IDX_A55P;
+            cpuIdx++)
+        {
+            s_sleepPlan.dirtyMask |= (1UL << cpuIdx);
+        }
+    }
+    else if ((cpuId >= CPU_IDX_A55C0) && (cpuId <= CPU_IDX_A55C_LAST))
+    {
+        /* Core run mode changes also update A55P wake/LPM config */
+        s_sleepPlan.dirtyMask |= (1UL << cpuId);
+        s_sleepPlan.dirtyMask |= (1UL << CPU_IDX_A55P);
+    }
+    else if ((cpuId < CPU_NUM_IDX) && (cpuId != CPU_IDX_M33P))
+    {
+        s_sleepPlan.dirtyMask |= (1UL << cpuId);
+    }
+    else
+    {
+        ; /* Intentional empty else */
+    }
+
+    /* Reload changed CPUs and rebuild aggregate */
+    DEV_SM_SystemSleepPlanLoad();
+}
+
+/*--------------------------------------------------------------------------*/
+/* Check sleep plan matches CPU wake/LPM config                             */
+/*--------------------------------------------------------------------------*/
+bool DEV_SM_SystemSleepPlanCheck(void)
+{
+    bool valid = true;
+
+    for (uint32_t cpuIdx = 0U; cpuIdx < CPU_NUM_IDX; cpuIdx++)
+    {
+        if (cpuIdx != CPU_IDX_M33P)
+        {
+            uint32_t lpmSetting;
+
+            for (uint32_t wakeIdx = 0U;
+                wakeIdx < GPC_CPU_CTRL_CMC_IRQ_WAKEUP_MASK_COUNT;
+                wakeIdx++)
+            {
+                uint32_t wakeVal = 0xFFFFFFFFU;
+                (void) CPU_IrqWakeGet(cpuIdx, wakeIdx, &wakeVal);
+                if (wakeVal != s_sleepPlan.cpuWakeMask[cpuIdx][wakeIdx])
+                {
+                    valid = false;
+                }
+            }
+
+            lpmSetting = CPU_PD_LPM_ON_NEVER;
+            (void) SRC_MixCpuLpmGet(PWR_MIX_SLICE_IDX_NOC, cpuIdx,
+                &lpmSetting);
+            if (lpmSetting != s_sleepPlan.cpuLpmNoc[cpuIdx])
+            {
+                valid = false;
+            }
+
+            lpmSetting = CPU_PD_LPM_ON_NEVER;
+            (void) SRC_MixCpuLpmGet(PWR_MIX_SLICE_IDX_WAKEUP, cpuIdx,
+                &lpmSetting);
+            if (lpmSetting != s_sleepPlan.cpuLpmWakeup[cpuIdx])
+            {
+                valid = false;
+            }
+        }
+    }
+
+    /* Return result */
+    return valid;
+}
+
 /*--------------------------------------------------------------------------*/
 /* Reset device                                                             */
 /*--------------------------------------------------------------------------*/
@@ -326,118 +457,39 @@ int32_t DEV_SM_SystemSleep(uint32_t sleepMode)
 
     int32_t status = SM_ERR_SUCCESS;
     uint32_t s_clkRootCtrl[DEV_SM_NUM_SLEEP_ROOTS];
-    uint32_t cpuWakeMask[CPU_NUM_IDX][GPC_CPU_CTRL_CMC_IRQ_WAKEUP_MASK_COUNT];
-    uint32_t sysWakeMask[GPC_CPU_CTRL_CMC_IRQ_WAKEUP_MASK_COUNT];
     uint32_t nvicISER[GPC_CPU_CTRL_CMC_IRQ_WAKEUP_MASK_COUNT];
 
     /* Capture start of sleep entry */
     uint64_t sleepEntryStart = DEV_SM_Usec64Get();
     uint64_t sleepExitStart = sleepEntryStart;
 
-    /* Reset wake source of sleep record */
+    /* Reset wake source, residency and power status of sleep record */
     g_syslog.sysSleepRecord.wakeSource = 0U;
-
-    /* Capture system sleep mode/flags */
-    g_syslog.sysSleepRecord.sysSleepMode = s_sysSleepMode;
-    g_syslog.sysSleepRecord.sysSleepFlags = s_sysSleepFlags;
-
-    /* Capture power status of MIXes */
+    g_syslog.sysSleepRecord.sleepUsec = 0U;
     g_syslog.sysSleepRecord.mixPwrStat = 0U;
-    for (uint32_t mixIdx = 0U; mixIdx < PWR_NUM_MIX_SLICE; mixIdx++)
-    {
-        if (SRC_MixIsPwrSwitchOn(mixIdx))
-        {
-            g_syslog.sysSleepRecord.mixPwrStat |= (1UL << mixIdx);
-        }
-    }
-
-    /* Capture power status of memories */
     g_syslog.sysSleepRecord.memPwrStat = 0U;
-    for (uint32_t memIdx = 0U; memIdx < PWR_NUM_MEM_SLICE; memIdx++)
-    {
-        const src_mem_slice_t *srcMem = s_srcMemPtrs[memIdx];
-        if ((srcMem->MEM_CTRL & SRC_MEM_MEM_CTRL_MEM_LP_MODE_MASK) != 0U)
-        {
-            g_syslog.sysSleepRecord.memPwrStat |= (1UL << memIdx);
-        }
-    }
-
-    /* Capture power status of PLLs */
     g_syslog.sysSleepRecord.pllPwrStat = 0U;
-    for (uint32_t pllIdx = 0U; pllIdx < CLOCK_NUM_PLL; pllIdx++)
-    {
-        uint32_t sourceIdx = s_pllVcoList[pllIdx];
-        if (CLOCK_SourceGetEnable(sourceIdx))
-        {
-            g_syslog.sysSleepRecord.pllPwrStat |= (1UL << pllIdx);
-        }
-    }
 
-    /* Initalize wake masks */
-    for (uint32_t wakeIdx = 0;
-        wakeIdx < GPC_CPU_CTRL_CMC_IRQ_WAKEUP_MASK_COUNT;
-        wakeIdx++)
-    {
-        sysWakeMask[wakeIdx] = 0xFFFFFFFFU;
+    /* Capture system sleep mode/flags */
+    g_syslog.sysSleepRecord.sysSleepMode = s_sysSleepMode;
+    g_syslog.sysSleepRecord.sysSleepFlags = s_sysSleepFlags;
 
-        for (uint32_t cpuIdx = 0U; cpuIdx < CPU_NUM_IDX; cpuIdx++)
-        {
-            cpuWakeMask[cpuIdx][wakeIdx] = 0xFFFFFFFFU;
-        }
-    }
+    /* Apply sleep plan, only rebuilt if sleep-forced CPUs changed */
+    DEV_SM_SystemSleepPlanLoad();
 
-    /* Initialize NOC/WAKEUP MIX dependencies */
-    uint32_t lpmSettingNoc = CPU_PD_LPM_ON_NEVER;
-    uint32_t lpmSettingWakeup = CPU_PD_LPM_ON_NEVER;
+    /* Sleep entry switches clocks outside the clock API */
+    DEV_SM_ClockRateInvalidate(DEV_SM_NUM_CLOCK);
 
-    /* Scan CPUs, update GPC wake masks, assess NOC/WAKEUP MIX dependencies */
+    /* Mask GPC wakes of CPUs in the plan */
     for (uint32_t cpuIdx = 0U; cpuIdx < CPU_NUM_IDX; cpuIdx++)
     {
-        if (cpuIdx != CPU_IDX_M33P)
+        if ((s_sleepPlan.activeMask & (1UL << cpuIdx)) != 0U)
         {
-            /* Check if sleep is forced for the CPU */
-            bool sleepForce;
-            if (CPU_SleepForceGet(cpuIdx, &sleepForce))
+            for (uint32_t wakeIdx = 0U;
+                wakeIdx < GPC_CPU_CTRL_CMC_IRQ_WAKEUP_MASK_COUNT;
+                wakeIdx++)
             {
-                /* If sleep is not forced, manage GPC masks */
-                if (!sleepForce)
-                {
-                    /* IRQs enabled at NVIC level become GPC wake sources */
-                    for (uint32_t wakeIdx = 0;
-                        wakeIdx < GPC_CPU_CTRL_CMC_IRQ_WAKEUP_MASK_COUNT;
-                        wakeIdx++)
-                    {
-                        uint32_t wakeVal;
-                        if (CPU_IrqWakeGet(cpuIdx, wakeIdx, &wakeVal))
-                        {
-                            cpuWakeMask[cpuIdx][wakeIdx] = wakeVal;
-                            sysWakeMask[wakeIdx] &= wakeVal;
-                            (void) CPU_IrqWakeSet(cpuIdx, wakeIdx,
-                                0xFFFFFFFFU);
-                        }
-                    }
-
-                    /* Update NOCMIX dependency */
-                    uint32_t lpmSetting;
-                    if (SRC_MixCpuLpmGet(PWR_MIX_SLICE_IDX_NOC, cpuIdx,
-                        &lpmSetting))
-                    {
-                        if (lpmSetting > lpmSettingNoc)
-                        {
-                            lpmSettingNoc = lpmSetting;
-                        }
-                    }
-
-                    /* Update WAKEUPMIX dependency */
-                    if (SRC_MixCpuLpmGet(PWR_MIX_SLICE_IDX_WAKEUP, cpuIdx,
-                        &lpmSetting))
-                    {
-                        if (lpmSetting > lpmSettingWakeup)
-                        {
-                            lpmSettingWakeup = lpmSetting;
-                        }
-                    }
-                }
+                (void) CPU_IrqWakeSet(cpuIdx, wakeIdx, 0xFFFFFFFFU);
             }
         }
     }
@@ -462,6 +514,36 @@ int32_t DEV_SM_SystemSleep(uint32_t sleepMode)
             /*! Increment system sleep counter */
             g_syslog.sysSleepRecord.sleepCnt++;
 
+            /* Capture power status of MIXes */
+            for (uint32_t mixIdx = 0U; mixIdx < PWR_NUM_MIX_SLICE; mixIdx++)
+            {
+                if (SRC_MixIsPwrSwitchOn(mixIdx))
+                {
+                    g_syslog.sysSleepRecord.mixPwrStat |= (1UL << mixIdx);
+                }
+            }
+
+            /* Capture power status of memories */
+            for (uint32_t memIdx = 0U; memIdx < PWR_NUM_MEM_SLICE; memIdx++)
+            {
+                const src_mem_slice_t *srcMem = s_srcMemPtrs[memIdx];
+                if ((srcMem->MEM_CTRL & SRC_MEM_MEM_CTRL_MEM_LP_MODE_MASK)
+                    != 0U)
+                {
+                    g_syslog.sysSleepRecord.memPwrStat |= (1UL << memIdx);
+                }
+            }
+
+            /* Capture power status of PLLs */
+            for (uint32_t pllIdx = 0U; pllIdx < CLOCK_NUM_PLL; pllIdx++)
+            {
+                uint32_t sourceIdx = s_pllVcoList[pllIdx];
+                if (CLOCK_SourceGetEnable(sourceIdx))
+                {
+                    g_syslog.sysSleepRecord.pllPwrStat |= (1UL << pllIdx);
+                }
+            }
+
             bool dramInRetention = false;
             /* Attempt to place DRAM into retention */
             if (DEV_SM_SystemDramRetentionEnter() == SM_ERR_SUCCESS)
@@ -479,7 +561,7 @@ int32_t DEV_SM_SystemSleep(uint32_t sleepMode)
             }
 
             /* If NOCMIX powered down during SUSPEND, force power down */
-            if (lpmSettingNoc <= sleepMode)
+            if (s_sleepPlan.lpmSettingNoc <= sleepMode)
             {
                 if (DEV_SM_PowerStateSet(DEV_SM_PD_NOC, DEV_SM_POWER_STATE_OFF)
                     == SM_ERR_SUCCESS)
@@ -490,7 +572,7 @@ int32_t DEV_SM_SystemSleep(uint32_t sleepMode)
             }
 
             /* If WAKEUPMIX powered down during SUSPEND, force power down */
-            if ((lpmSettingWakeup <= sleepMode) &&
+            if ((s_sleepPlan.lpmSettingWakeup <= sleepMode) &&
                 ((CoreDebug->DHCSR & CoreDebug_DHCSR_C_DEBUGEN_Msk) == 0x0U))
             {
                 if (DEV_SM_PowerStateSet(DEV_SM_PD_WAKEUP,
@@ -524,7 +606,7 @@ int32_t DEV_SM_SystemSleep(uint32_t sleepMode)
                 NVIC->ICPR[wakeIdx] = 0xFFFFFFFFU & maskVal;
 
                 /* Add system-level wake events */
-                maskVal &= sysWakeMask[wakeIdx];
+                maskVal &= s_sleepPlan.sysWakeMask[wakeIdx];
 
                 /* Update GPC wake mask */
                 (void) CPU_IrqWakeSet(CPU_IDX_M33P, wakeIdx, maskVal);
@@ -637,6 +719,10 @@ int32_t DEV_SM_SystemSleep(uint32_t sleepMode)
             g_syslog.sysSleepRecord.sleepEntryUsec =
                 UINT64_L(DEV_SM_Usec64Get() - sleepEntryStart);
 
+            /* Trace sleep entry */
+            SM_TRACE(SM_TRACE_CAT_SLEEP, SM_TRACE_SLEEP_ENTRY,
+                s_sysSleepMode, s_sysSleepFlags);
+
             /* Check SYSCTR system sleep mode flag */
             if ((s_sysSleepFlags & DEV_SM_SSF_SYSCTR_ACTIVE_MASK) != 0U)
             {
@@ -673,11 +759,21 @@ int32_t DEV_SM_SystemSleep(uint32_t sleepMode)
             /* Capture start of sleep exit */
             sleepExitStart = DEV_SM_Usec64Get();
 
+            /* Capture sleep residency */
+            g_syslog.sysSleepRecord.sleepUsec =
+                UINT64_L(sleepExitStart - sleepEntryStart)
+                - g_syslog.sysSleepRecord.sleepEntryUsec;
+
             /* Capture wake source */
             g_syslog.sysSleepRecord.wakeSource =
                 (SCB->ICSR & SCB_ICSR_VECTPENDING_Msk)
                 >> SCB_ICSR_VECTPENDING_Pos;
 
+            /* Trace sleep exit */
+            SM_TRACE(SM_TRACE_CAT_SLEEP, SM_TRACE_SLEEP_EXIT,
+                g_syslog.sysSleepRecord.wakeSource,
+                g_syslog.sysSleepRecord.sleepCnt);
+
             /* Process SM LPIs for sleep exit */
             (void) CPU_PerLpiProcess(CPU_IDX_M33P, CPU_SLEEP_MODE_RUN);
 
@@ -730,14 +826,15 @@ int32_t DEV_SM_SystemSleep(uint32_t sleepMode)
             BLK_CTRL_S_AONMIX->LP_HANDSHAKE2_SENTINEL = lpHs2Ele;
 
             /* If WAKEUPMIX powered down during SUSPEND, force power up */
-            if (lpmSettingWakeup <= sleepMode)
+            if (s_sleepPlan.lpmSettingWakeup <= sleepMode)
             {
                 status = DEV_SM_PowerStateSet(DEV_SM_PD_WAKEUP,
                     DEV_SM_POWER_STATE_ON);
             }
 
             /* If NOCMIX powered down during SUSPEND, force power up */
-            if ((status == SM_ERR_SUCCESS) && (lpmSettingNoc <= sleepMode))
+            if ((status == SM_ERR_SUCCESS)
+                && (s_sleepPlan.lpmSettingNoc <= sleepMode))
             {
                 status = DEV_SM_PowerStateSet(DEV_SM_PD_NOC,
                     DEV_SM_POWER_STATE_ON);
@@ -785,27 +882,17 @@ int32_t DEV_SM_SystemSleep(uint32_t sleepMode)
             UINT64_L(sleepExitStart - sleepEntryStart);
     }
 
-    /* Restore GPC wake masks for sleeping CPUs */
+    /* Restore GPC wake masks of CPUs in the plan */
     for (uint32_t cpuIdx = 0U; cpuIdx < CPU_NUM_IDX; cpuIdx++)
     {
-        if (cpuIdx != CPU_IDX_M33P)
+        if ((s_sleepPlan.activeMask & (1UL << cpuIdx)) != 0U)
         {
-            /* Check if sleep is forced for the CPU */
-            bool sleepForce;
-            if (CPU_SleepForceGet(cpuIdx, &sleepForce))
+            for (uint32_t wakeIdx = 0U;
+                wakeIdx < GPC_CPU_CTRL_CMC_IRQ_WAKEUP_MASK_COUNT;
+                wakeIdx++)
             {
-                /* If sleep is not forced, manage GPC masks */
-                if (!sleepForce)
-                {
-                    /* IRQs enabled at NVIC level become GPC wake sources */
-                    for (uint32_t wakeIdx = 0U;
-                        wakeIdx < GPC_CPU_CTRL_CMC_IRQ_WAKEUP_MASK_COUNT;
-                        wakeIdx++)
-                    {
-                        (void) CPU_IrqWakeSet(cpuIdx, wakeIdx,
-                            cpuWakeMask[cpuIdx][wakeIdx]);
-                    }
-                }
+                (void) CPU_IrqWakeSet(cpuIdx, wakeIdx,
+                    s_sleepPlan.cpuWakeMask[cpuIdx][wakeIdx]);
             }
         }
     }
@@ -813,6 +900,12 @@ int32_t DEV_SM_SystemSleep(uint32_t sleepMode)
     g_syslog.sysSleepRecord.sleepExitUsec =
         UINT64_L(DEV_SM_Usec64Get() - sleepExitStart);
 
+    /* Drop rates cached during sleep entry/exit */
+    DEV_SM_ClockRateInvalidate(DEV_SM_NUM_CLOCK);
+
+    /* Accumulate sleep statistics */
+    DEV_SM_SystemSleepStatsUpdate();
+
     return status;
 }
 
@@ -822,9 +915,17 @@ int32_t DEV_SM_SystemSleep(uint32_t sleepMode)
 int32_t DEV_SM_SystemIdle(void)
 {
     int32_t status = SM_ERR_SUCCESS;
+    dev_sm_idle_gov_t *gov = &g_syslog.sysIdleGov;
+    uint32_t idleState = DEV_SM_IDLE_WFI;
 
     __disable_irq();
 
+    /* Start new idle period unless only the SM tick ended the last one */
+    if (!s_idleTickWake)
+    {
+        s_idleStart = DEV_SM_Usec64Get();
+    }
+
     /* Check if system sleep mode flag allows system sleep */
     if ((s_sysSleepFlags & DEV_SM_SSF_SM_ACTIVE_MASK) == 0U)
     {
@@ -834,20 +935,40 @@ int32_t DEV_SM_SystemIdle(void)
         {
             if (sysSleepStat == CPU_SLEEP_MODE_SUSPEND)
             {
-                status = DEV_SM_SystemSleep(CPU_SLEEP_MODE_SUSPEND);
-            }
-            /* Otherwise stay in RUN mode and enter WFI */
-            else
-            {
-                (void) CPU_SleepModeSet(CPU_IDX_M33P, CPU_SLEEP_MODE_RUN);
-                __DSB();
-                // coverity[misra_c_2012_rule_1_2_violation:FALSE]
-                __WFI();
-                __ISB();
+                /* Select idle state based on expected idle time */
+                idleState = DEV_SM_SystemIdleSelect();
             }
         }
     }
-    /* SM remains active, no system sleep */
+
+    /* Count idle state */
+    gov->idleCnt[idleState]++;
+
+    /* Suspend? */
+    if (idleState != DEV_SM_IDLE_WFI)
+    {
+        uint32_t sleepFlags = s_sysSleepFlags;
+
+        /* Shallow idle keeps fast-exit resources active */
+        if (idleState == DEV_SM_IDLE_SHALLOW)
+        {
+            s_sysSleepFlags |= DEV_SM_IDLE_SSF_SHALLOW;
+        }
+
+        status = DEV_SM_SystemSleep(CPU_SLEEP_MODE_SUSPEND);
+
+        /* Restore sleep flags */
+        s_sysSleepFlags = sleepFlags;
+
+        /* Update measured latency if system slept */
+        if (g_syslog.sysSleepRecord.wakeSource != 0U)
+        {
+            DEV_SM_SystemIdleEwma(&gov->latUsec[idleState],
+                g_syslog.sysSleepRecord.sleepEntryUsec
+                + g_syslog.sysSleepRecord.sleepExitUsec);
+        }
+    }
+    /* Otherwise stay in RUN mode and enter WFI */
     else
     {
         (void) CPU_SleepModeSet(CPU_IDX_M33P, CPU_SLEEP_MODE_RUN);
@@ -857,6 +978,29 @@ int32_t DEV_SM_SystemIdle(void)
         __ISB();
     }
 
+    /* SM tick wakes do not end the idle period */
+    s_idleTickWake = (((SCB->ICSR & SCB_ICSR_VECTPENDING_Msk)
+        >> SCB_ICSR_VECTPENDING_Pos) == DEV_SM_VECT_SYSTICK);
+
+    /* Update predicted residency at end of idle period */
+    if (!s_idleTickWake)
+    {
+        uint64_t idleUsec = DEV_SM_Usec64Get() - s_idleStart;
+        uint32_t sample = (idleUsec > ((uint64_t) UINT32_MAX))
+            ? UINT32_MAX : UINT64_L(idleUsec);
+
+        /* Seed with first sample */
+        if (gov->predCnt == 0U)
+        {
+            gov->predUsec = sample;
+        }
+        else
+        {
+            DEV_SM_SystemIdleEwma(&gov->predUsec, sample);
+        }
+        gov->predCnt++;
+    }
+
     __enable_irq();
 
     return status;
@@ -1045,3 +1189,266 @@ int32_t DEV_SM_SystemDramRetentionExit(void)
     return status;
 }
 
+/*==========================================================================*/
+
+/*--------------------------------------------------------------------------*/
+/* Accumulate system sleep statistics from the last sleep record            */
+/*--------------------------------------------------------------------------*/
+static void DEV_SM_SystemSleepStatsUpdate(void)
+{
+    const dev_sm_sys_sleep_rec_t *rec = &g_syslog.sysSleepRecord;
+    dev_sm_sys_sleep_stats_t *stats = &g_syslog.sysSleepStats;
+    dev_sm_sleep_mode_stat_t *modeStat
+        = &stats->modeStat[(rec->sysSleepMode >> 4U)
+        % DEV_SM_NUM_SLEEP_MODE];
+
+    /* Did system sleep? */
+    if (rec->wakeSource != 0U)
+    {
+        uint32_t idx = 0U;
+
+        /* Accumulate residency */
+        modeStat->sleepUsec += (uint64_t) rec->sleepUsec;
+        modeStat->sleepCnt++;
+
+        /* Update latency histograms */
+        stats->entryHist[DEV_SM_SystemSleepHistBin(rec->sleepEntryUsec)]++;
+        stats->exitHist[DEV_SM_SystemSleepHistBin(rec->sleepExitUsec)]++;
+
+        /* Find or allocate wake source counter */
+        while ((idx < DEV_SM_NUM_WAKE_SRC)
+            && (stats->wakeStat[idx].wakeCnt != 0U)
+            && (stats->wakeStat[idx].wakeSource != rec->wakeSource))
+        {
+            idx++;
+        }
+
+        /* Count wake source */
+        if (idx < DEV_SM_NUM_WAKE_SRC)
+        {
+            stats->wakeStat[idx].wakeSource = rec->wakeSource;
+            stats->wakeStat[idx].wakeCnt++;
+        }
+        else
+        {
+            stats->wakeOtherCnt++;
+        }
+    }
+    else
+    {
+        modeStat->abortCnt++;
+    }
+
+    /* Save record in ring */
+    stats->rec[stats->recIdx % DEV_SM_NUM_SLEEP_REC] = *rec;
+    stats->recIdx++;
+}
+
+/*--------------------------------------------------------------------------*/
+/* Return log2 latency histogram bin                                        */
+/*--------------------------------------------------------------------------*/
+static uint32_t DEV_SM_SystemSleepHistBin(uint32_t usec)
+{
+    uint32_t bin = 0U;
+    uint32_t limit = 1UL << DEV_SM_SLEEP_HIST_MIN;
+
+    /* Find first bin with limit above latency */
+    while ((bin < (DEV_SM_NUM_SLEEP_HIST - 1U)) && (usec >= limit))
+    {
+        bin++;
+        limit <<= 1U;
+    }
+
+    /* Return bin */
+    return bin;
+}
+
+/*--------------------------------------------------------------------------*/
+/* Select deepest idle state with latency covered by expected idle time     */
+/*--------------------------------------------------------------------------*/
+static uint32_t DEV_SM_SystemIdleSelect(void)
+{
+    dev_sm_idle_gov_t *gov = &g_syslog.sysIdleGov;
+    uint32_t idleState = DEV_SM_IDLE_DEEP;
+    uint64_t timerUsec = DEV_SM_SystemIdleTimerGet();
+    uint64_t predUsec = UINT64_MAX;
+
+    /* Remaining predicted residency, no history assumes long idle */
+    if (gov->predCnt != 0U)
+    {
+        uint64_t elapsed = DEV_SM_Usec64Get() - s_idleStart;
+
+        predUsec = (uint64_t) gov->predUsec;
+        if (elapsed < predUsec)
+        {
+            predUsec -= elapsed;
+        }
+    }
+
+    uint64_t expUsec = MIN(timerUsec, predUsec);
+
+    /* Demote until latency fits in the expected idle time */
+    while ((idleState > DEV_SM_IDLE_WFI) && (expUsec
+        < (((uint64_t) gov->latUsec[idleState]) * DEV_SM_IDLE_LAT_FACTOR)))
+    {
+        idleState--;
+    }
+
+    /* Count reason for demotion */
+    if (idleState != DEV_SM_IDLE_DEEP)
+    {
+        if (timerUsec <= predUsec)
+        {
+            gov->timerDemoteCnt++;
+        }
+        else
+        {
+            gov->predDemoteCnt++;
+        }
+    }
+
+    /* Trace decision */
+    SM_TRACE(SM_TRACE_CAT_SLEEP, SM_TRACE_SLEEP_IDLE, idleState,
+        (expUsec > ((uint64_t) UINT32_MAX)) ? UINT32_MAX
+        : UINT64_L(expUsec));
+
+    /* Return idle state */
+    return idleState;
+}
+
+/*--------------------------------------------------------------------------*/
+/* Return usec until next armed SYSCTR compare or RTC alarm                 */
+/*--------------------------------------------------------------------------*/
+static uint64_t DEV_SM_SystemIdleTimerGet(void)
+{
+    uint64_t timerUsec = UINT64_MAX;
+    uint64_t cmpTicks;
+
+    /* Check armed SYSCTR compare frames */
+    if (SYSCTR_GetCompareNext(&cmpTicks))
+    {
+        uint64_t nowTicks = SYSCTR_GetCounter64();
+
+        timerUsec = 0ULL;
+        if (cmpTicks > nowTicks)
+        {
+            timerUsec = SYSCTR_TICKS_TO_USEC64(cmpTicks - nowTicks);
+        }
+    }
+
+    /* Check RTC alarm */
+    if ((BBNSM_GetEnabledInterrupts(BBNSM)
+        & BBNSM_BBNSM_INT_EN_TA_INT_EN_MASK)
+        == ((uint32_t) kBBNSM_RTC_AlarmInterrupt))
+    {
+        uint32_t alarmSec = BBNSM_RTC_GetAlarm(BBNSM);
+        uint32_t nowSec = BBNSM_RTC_GetSeconds(BBNSM);
+        uint64_t alarmUsec = 0ULL;
+
+        if (alarmSec > nowSec)
+        {
+            alarmUsec = ((uint64_t) (alarmSec - nowSec)) * 1000000ULL;
+        }
+        timerUsec = MIN(timerUsec, alarmUsec);
+    }
+
+    /* Return time to next timer */
+    return timerUsec;
+}
+
+/*--------------------------------------------------------------------------*/
+/* Update exponentially weighted moving average                             */
+/*--------------------------------------------------------------------------*/
+static void DEV_SM_SystemIdleEwma(uint32_t *avg, uint32_t sample)
+{
+    uint64_t val = (uint64_t) *avg;
+
+    /* avg += (sample - avg) / 2^N */
+    val = ((val << DEV_SM_IDLE_EWMA_SHIFT) - val + ((uint64_t) sample))
+        >> DEV_SM_IDLE_EWMA_SHIFT;
+    *avg = UINT64_L(val);
+}
+
+/*--------------------------------------------------------------------------*/
+/* Reload changed CPUs and rebuild sleep plan aggregate                     */
+/*--------------------------------------------------------------------------*/
+static void DEV_SM_SystemSleepPlanLoad(void)
+{
+    uint32_t activeMask = 0U;
+
+    /* Reload cached state of changed CPUs */
+    for (uint32_t cpuIdx = 0U; cpuIdx < CPU_NUM_IDX; cpuIdx++)
+    {
+        if ((s_sleepPlan.dirtyMask & (1UL << cpuIdx)) != 0U)
+        {
+            for (uint32_t wakeIdx = 0U;
+                wakeIdx < GPC_CPU_CTRL_CMC_IRQ_WAKEUP_MASK_COUNT;
+                wakeIdx++)
+            {
+                uint32_t wakeVal = 0xFFFFFFFFU;
+                (void) CPU_IrqWakeGet(cpuIdx, wakeIdx, &wakeVal);
+                s_sleepPlan.cpuWakeMask[cpuIdx][wakeIdx] = wakeVal;
+            }
+
+            s_sleepPlan.cpuLpmNoc[cpuIdx] = CPU_PD_LPM_ON_NEVER;
+            (void) SRC_MixCpuLpmGet(PWR_MIX_SLICE_IDX_NOC, cpuIdx,
+                &s_sleepPlan.cpuLpmNoc[cpuIdx]);
+            s_sleepPlan.cpuLpmWakeup[cpuIdx] = CPU_PD_LPM_ON_NEVER;
+            (void) SRC_MixCpuLpmGet(PWR_MIX_SLICE_IDX_WAKEUP, cpuIdx,
+                &s_sleepPlan.cpuLpmWakeup[cpuIdx]);
+        }
+    }
+
+    /* Find CPUs not forced to sleep, these manage GPC masks */
+    for (uint32_t cpuIdx = 0U; cpuIdx < CPU_NUM_IDX; cpuIdx++)
+    {
+        bool sleepForce;
+        if ((cpuIdx != CPU_IDX_M33P)
+            && CPU_SleepForceGet(cpuIdx, &sleepForce))
+        {
+            if (!sleepForce)
+            {
+                activeMask |= (1UL << cpuIdx);
+            }
+        }
+    }
+
+    /* Rebuild aggregate only if inputs changed */
+    if ((s_sleepPlan.dirtyMask != 0U)
+        || (activeMask != s_sleepPlan.activeMask))
+    {
+        /* Initialize wake mask and NOC/WAKEUP MIX dependencies */
+        for (uint32_t wakeIdx = 0U;
+            wakeIdx < GPC_CPU_CTRL_CMC_IRQ_WAKEUP_MASK_COUNT;
+            wakeIdx++)
+        {
+            s_sleepPlan.sysWakeMask[wakeIdx] = 0xFFFFFFFFU;
+        }
+        s_sleepPlan.lpmSettingNoc = CPU_PD_LPM_ON_NEVER;
+        s_sleepPlan.lpmSettingWakeup = CPU_PD_LPM_ON_NEVER;
+
+        /* IRQs enabled for any active CPU become system wake sources */
+        for (uint32_t cpuIdx = 0U; cpuIdx < CPU_NUM_IDX; cpuIdx++)
+        {
+            if ((activeMask & (1UL << cpuIdx)) != 0U)
+            {
+                for (uint32_t wakeIdx = 0U;
+                    wakeIdx < GPC_CPU_CTRL_CMC_IRQ_WAKEUP_MASK_COUNT;
+                    wakeIdx++)
+                {
+                    s_sleepPlan.sysWakeMask[wakeIdx]
+                        &= s_sleepPlan.cpuWakeMask[cpuIdx][wakeIdx];
+                }
+
+                s_sleepPlan.lpmSettingNoc = MAX(s_sleepPlan.lpmSettingNoc,
+                    s_sleepPlan.cpuLpmNoc[cpuIdx]);
+                s_sleepPlan.lpmSettingWakeup =
+                    MAX(s_sleepPlan.lpmSettingWakeup,
+                    s_sleepPlan.cpuLpmWakeup[cpuIdx]);
+            }
+        }
+
+        s_sleepPlan.activeMask = activeMask;
+        s_sleepPlan.dirtyMask = 0U;
+    }
+}
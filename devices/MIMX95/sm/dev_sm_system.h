@@ -134,6 +134,40 @@
 #define DEV_SM_SSF_OSC24M_ACTIVE_MASK       (1U << 4U)  /*!< Keep OSC24M active */
 /** @} */
 
+/*!
+ * @name System sleep statistics
+ */
+/** @{ */
+#define DEV_SM_NUM_SLEEP_MODE  16U  /*!< Mode stats, indexed by mode[7:4] */
+#define DEV_SM_NUM_SLEEP_HIST  12U  /*!< Latency histogram bins */
+#define DEV_SM_SLEEP_HIST_MIN  3U   /*!< Bin 0 is < 2^N uS, bins are log2 */
+#define DEV_SM_NUM_WAKE_SRC    8U   /*!< Wake sources counted separately */
+#define DEV_SM_NUM_SLEEP_REC   8U   /*!< Sleep records kept */
+/** @} */
+
+/*!
+ * @name System idle states
+ */
+/** @{ */
+#define DEV_SM_IDLE_WFI      0U  /*!< SM WFI, system remains in RUN */
+#define DEV_SM_IDLE_SHALLOW  1U  /*!< Suspend with fast-exit resources on */
+#define DEV_SM_IDLE_DEEP     2U  /*!< Suspend per system sleep mode/flags */
+#define DEV_SM_NUM_IDLE      3U  /*!< Number of idle states */
+/** @} */
+
+/*!
+ * @name System idle governor tuning
+ */
+/** @{ */
+#define DEV_SM_IDLE_SSF_SHALLOW  (DEV_SM_SSF_FRO_ACTIVE_MASK \
+    | DEV_SM_SSF_SYSCTR_ACTIVE_MASK | DEV_SM_SSF_PMIC_STBY_INACTIVE_MASK \
+    | DEV_SM_SSF_OSC24M_ACTIVE_MASK)  /*!< Flags forced for shallow */
+#define DEV_SM_IDLE_LAT_FACTOR   2U     /*!< Idle must exceed N x latency */
+#define DEV_SM_IDLE_LAT_SHALLOW  100U   /*!< Initial shallow latency (uS) */
+#define DEV_SM_IDLE_LAT_DEEP     1000U  /*!< Initial deep latency (uS) */
+#define DEV_SM_IDLE_EWMA_SHIFT   2U     /*!< New sample weight is 1/2^N */
+/** @} */
+
 /* Types */
 
 /*!
@@ -167,10 +201,120 @@ typedef struct
 
     /*! System sleep flags */
     uint32_t sysSleepFlags;
+
+    /*! System sleep residency (0 if aborted) */
+    uint32_t sleepUsec;
 } dev_sm_sys_sleep_rec_t;
 
+/*!
+ * System sleep mode statistics
+ */
+typedef struct
+{
+    /*! Total residency in this mode */
+    uint64_t sleepUsec;
+
+    /*! Number of system sleeps */
+    uint32_t sleepCnt;
+
+    /*! Number of sleep attempts aborted before WFI */
+    uint32_t abortCnt;
+} dev_sm_sleep_mode_stat_t;
+
+/*!
+ * System wake source count
+ */
+typedef struct
+{
+    /*! IRQ/exception causing system wake */
+    uint32_t wakeSource;
+
+    /*! Number of wakes */
+    uint32_t wakeCnt;
+} dev_sm_wake_stat_t;
+
+/*!
+ * System sleep statistics
+ *
+ * Latency histogram bin 0 counts < 2^::DEV_SM_SLEEP_HIST_MIN uS, each
+ * following bin doubles the range and the last bin counts the remainder.
+ */
+typedef struct
+{
+    /*! Residency and counts per sleep mode */
+    dev_sm_sleep_mode_stat_t modeStat[DEV_SM_NUM_SLEEP_MODE];
+
+    /*! Sleep entry latency histogram */
+    uint32_t entryHist[DEV_SM_NUM_SLEEP_HIST];
+
+    /*! Sleep exit latency histogram */
+    uint32_t exitHist[DEV_SM_NUM_SLEEP_HIST];
+
+    /*! Wake counts for the first wake sources seen */
+    dev_sm_wake_stat_t wakeStat[DEV_SM_NUM_WAKE_SRC];
+
+    /*! Wake count for sources not in wakeStat */
+    uint32_t wakeOtherCnt;
+
+    /*! Number of records written, next is recIdx % ::DEV_SM_NUM_SLEEP_REC */
+    uint32_t recIdx;
+
+    /*! Ring of the last sleep records */
+    dev_sm_sys_sleep_rec_t rec[DEV_SM_NUM_SLEEP_REC];
+} dev_sm_sys_sleep_stats_t;
+
+/*!
+ * System idle governor state
+ *
+ * The governor picks the deepest idle state whose measured entry + exit
+ * latency, scaled by ::DEV_SM_IDLE_LAT_FACTOR, fits in the expected idle
+ * time. The expected idle time is the lesser of the next armed SYSCTR
+ * compare or RTC alarm and the predicted residency.
+ */
+typedef struct
+{
+    /*! Number of idles entered per state */
+    uint32_t idleCnt[DEV_SM_NUM_IDLE];
+
+    /*! Number of idles made shallower due to the next timer/alarm */
+    uint32_t timerDemoteCnt;
+
+    /*! Number of idles made shallower due to the predicted residency */
+    uint32_t predDemoteCnt;
+
+    /*! Number of idle periods measured */
+    uint32_t predCnt;
+
+    /*! Predicted idle residency (EWMA of measured idle periods) */
+    uint32_t predUsec;
+
+    /*! Entry + exit latency per state (EWMA of measured sleeps) */
+    uint32_t latUsec[DEV_SM_NUM_IDLE];
+} dev_sm_idle_gov_t;
+
 /* Functions */
 
+/*!
+ * Update the system sleep plan for a CPU.
+ *
+ * @param[in]     cpuId       Index of CPU with changed wake/LPM config
+ *
+ * Called when the GPC wake masks, LPM settings or run mode of a CPU
+ * change. Reloads the cached state of that CPU and rebuilds the system
+ * wake mask and NOCMIX/WAKEUPMIX dependencies applied on sleep entry.
+ */
+void DEV_SM_SystemSleepPlanUpdate(uint32_t cpuId);
+
+/*!
+ * Check the system sleep plan.
+ *
+ * Compares the cached wake masks and LPM settings of each CPU against
+ * the GPC/SRC config.
+ *
+ * @return True if the cache matches the hardware config.
+ */
+bool DEV_SM_SystemSleepPlanCheck(void);
+
 /* Externs */
 
 /*! External pointer to the DRAM info */
@@ -46,6 +46,7 @@
 #include <sys/mman.h>
 #include "dev_sm.h"
 #include "brd_sm.h"
+#include "lmm.h"
 
 /* Local defines */
 
@@ -197,5 +198,8 @@ static void DEV_SM_Tick(union sigval timer_data)
 
     /* Tick sensor */
     DEV_SM_SensorHandler(0U, 0U);
+
+    /* Tick LMM */
+    LMM_Tick(1000U);
 }
 
@@ -40,9 +40,14 @@
 
 #include "sm.h"
 #include "dev_sm.h"
+#include "lmm.h"
 
 /* Local defines */
 
+/* Simulated source rate and divider for discrete rates */
+#define DEV_SM_CLOCK_SRC_RATE      19200000000ULL
+#define DEV_SM_CLOCK_DIV_MAX       256U
+
 /* Local types */
 
 /* Local variables */
@@ -51,6 +56,8 @@ static bool s_clockState[DEV_SM_NUM_CLOCK];
 static uint64_t s_clockFreq[DEV_SM_NUM_CLOCK];
 static uint32_t s_clockParent[DEV_SM_NUM_CLOCK];
 static uint32_t s_clockSscConfig[DEV_SM_NUM_CLOCK];
+static uint64_t s_clockRate[DEV_SM_NUM_CLOCK];
+static BITARRAY_DEC(s_clockRateValid, DEV_SM_NUM_CLOCK);
 
 /*--------------------------------------------------------------------------*/
 /* Return clock name                                                        */
@@ -153,6 +160,69 @@ int32_t DEV_SM_ClockMuxGet(uint32_t clockId, uint32_t idx, uint32_t *mux,
     return status;
 }
 
+/*--------------------------------------------------------------------------*/
+/* Return discrete clock rates                                              */
+/*--------------------------------------------------------------------------*/
+int32_t DEV_SM_ClockRatesGet(uint32_t clockId, uint32_t idx,
+    uint64_t *rates, uint32_t *numRates, uint32_t *remaining)
+{
+    int32_t status = SM_ERR_SUCCESS;
+    dev_sm_clock_range_t range = { 0ULL, 0ULL, 0ULL };
+    uint64_t srcRate = DEV_SM_CLOCK_SRC_RATE;
+
+    /* Clock 3 models a half step divider with a long list */
+    if (clockId == DEV_SM_CLK_3)
+    {
+        srcRate *= 2ULL;
+    }
+
+    /* Check clock */
+    if (clockId == DEV_SM_CLK_0)
+    {
+        status = SM_ERR_NOT_SUPPORTED;
+    }
+    else
+    {
+        status = DEV_SM_ClockDescribe(clockId, &range);
+    }
+
+    if (status == SM_ERR_SUCCESS)
+    {
+        uint32_t total = 0U;
+        uint32_t num = 0U;
+
+        /* Model a divided source, return ascending rates within range */
+        for (uint32_t div = DEV_SM_CLOCK_DIV_MAX; div > 0U; div--)
+        {
+            uint64_t rate = srcRate / ((uint64_t) div);
+
+            if ((rate >= range.lowestRate) && (rate <= range.highestRate))
+            {
+                if ((total >= idx) && (num < *numRates))
+                {
+                    rates[num] = rate;
+                    num++;
+                }
+                total++;
+            }
+        }
+
+        /* Check index */
+        if (idx >= total)
+        {
+            status = SM_ERR_OUT_OF_RANGE;
+        }
+        else
+        {
+            *numRates = num;
+            *remaining = total - idx - num;
+        }
+    }
+
+    /* Return status */
+    return status;
+}
+
 /*--------------------------------------------------------------------------*/
 /* Set clock rate                                                           */
 /*--------------------------------------------------------------------------*/
@@ -166,7 +236,13 @@ int32_t DEV_SM_ClockRateSet(uint32_t clockId, uint64_t rate,
     {
         if (roundSel <= 2U)
         {
-            s_clockFreq[clockId] = rate;
+            /* Report rate change */
+            if (s_clockFreq[clockId] != rate)
+            {
+                s_clockFreq[clockId] = rate;
+                DEV_SM_ClockRateInvalidate(clockId);
+                LMM_ClockRateEvent(clockId, rate);
+            }
         }
         else
         {
@@ -192,7 +268,13 @@ int32_t DEV_SM_ClockRateGet(uint32_t clockId, uint64_t *rate)
     /* Check clock */
     if (clockId < DEV_SM_NUM_CLOCK)
     {
-        *rate = s_clockFreq[clockId];
+        /* Fill cache on miss */
+        if (BITARRAY_GET(s_clockRateValid, clockId) == 0U)
+        {
+            s_clockRate[clockId] = s_clockFreq[clockId];
+            BITARRAY_SET(s_clockRateValid, clockId);
+        }
+        *rate = s_clockRate[clockId];
     }
     else
     {
@@ -256,6 +338,7 @@ int32_t DEV_SM_ClockParentSet(uint32_t clockId, uint32_t parent)
     if (clockId < DEV_SM_NUM_CLOCK)
     {
         s_clockParent[clockId] = parent;
+        DEV_SM_ClockRateInvalidate(clockId);
     }
     else
     {
@@ -351,3 +434,54 @@ int32_t DEV_SM_ClockExtendedGet(uint32_t clockId, uint32_t extId,
     return status;
 }
 
+/*--------------------------------------------------------------------------*/
+/* Return if clock rate is cached                                           */
+/*--------------------------------------------------------------------------*/
+bool DEV_SM_ClockRateIsCached(uint32_t clockId)
+{
+    return (clockId < DEV_SM_NUM_CLOCK)
+        && (BITARRAY_GET(s_clockRateValid, clockId) != 0U);
+}
+
+/*--------------------------------------------------------------------------*/
+/* Invalidate cached clock rates                                            */
+/*--------------------------------------------------------------------------*/
+void DEV_SM_ClockRateInvalidate(uint32_t clockId)
+{
+    if (clockId < DEV_SM_NUM_CLOCK)
+    {
+        BITARRAY_DEC(dirty, DEV_SM_NUM_CLOCK) = { 0U };
+        bool changed = true;
+
+        BITARRAY_SET(dirty, clockId);
+        BITARRAY_CLR(s_clockRateValid, clockId);
+
+        /* Simulated parents are unordered, repeat until stable */
+        while (changed)
+        {
+            changed = false;
+            for (uint32_t child = 0U; child < DEV_SM_NUM_CLOCK; child++)
+            {
+                uint32_t parent = s_clockParent[child];
+
+                if ((BITARRAY_GET(dirty, child) == 0U)
+                    && (parent < DEV_SM_NUM_CLOCK)
+                    && (BITARRAY_GET(dirty, parent) != 0U))
+                {
+                    BITARRAY_SET(dirty, child);
+                    BITARRAY_CLR(s_clockRateValid, child);
+                    changed = true;
+                }
+            }
+        }
+    }
+    else
+    {
+        /* Invalidate all */
+        for (uint32_t idx = 0U; idx < BITARRAY_SIZE(DEV_SM_NUM_CLOCK);
+            idx++)
+        {
+            s_clockRateValid[idx] = 0U;
+        }
+    }
+}
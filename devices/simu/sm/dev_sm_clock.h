@@ -86,6 +86,26 @@
 
 /* Functions */
 
+/*!
+ * Invalidate cached clock rates.
+ *
+ * @param[in]     clockId     Clock that was modified, or
+ *                            ::DEV_SM_NUM_CLOCK for all clocks
+ *
+ * This function drops the cached rate of \a clockId and all clocks
+ * derived from it.
+ */
+void DEV_SM_ClockRateInvalidate(uint32_t clockId);
+
+/*!
+ * Check if a clock rate is cached.
+ *
+ * @param[in]     clockId     Clock to check
+ *
+ * @return True if the rate of \a clockId is held in the cache.
+ */
+bool DEV_SM_ClockRateIsCached(uint32_t clockId);
+
 /** @} */
 
 /* Include SM device API */
@@ -216,3 +216,10 @@ int32_t DEV_SM_StrLen(string str)
     return len;
 }
 
+/*--------------------------------------------------------------------------*/
+/* Memory barrier                                                           */
+/*--------------------------------------------------------------------------*/
+void DEV_SM_MemBarrier(void)
+{
+    __sync_synchronize();
+}
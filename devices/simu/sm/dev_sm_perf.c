@@ -40,6 +40,7 @@
 
 #include "sm.h"
 #include "dev_sm.h"
+#include "lmm.h"
 
 /* Local defines */
 
@@ -175,6 +176,7 @@ int32_t DEV_SM_PerfLevelSet(uint32_t domainId, uint32_t perfLevel)
     else
     {
         s_perfLevel[domainId] = perfLevel;
+        LMM_PerfLevelEvent(domainId, perfLevel);
     }
 
     /* Return status */
@@ -132,6 +132,7 @@ int32_t DEV_SM_SensorDescribe(uint32_t sensorId,
         desc->numTripPoints = 2U;
         desc->timestampSupport = false;
         desc->timestampExponent = 0;
+        desc->asyncReadSupport = false;
 
         if (sensorId == DEV_SM_SENSOR_1)
         {
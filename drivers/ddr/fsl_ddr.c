@@ -43,8 +43,18 @@
 
 /* Local Defines */
 
+#define DEBUG_19        (DDRC_BASE + 0xF48U)
 #define DEBUG_26        (DDRC_BASE + 0xF64U)
 
+/* DEBUG_19 self-refresh state of the DDRC */
+#define DEBUG_19_SR_MASK    0x3U
+
+/* Self-refresh entry timeout (us) */
+#define DDR_SR_TIMEOUT      1000U
+
+/* DFI init and frequency change handshake timeout (us) */
+#define DDR_DFI_TIMEOUT     10000U
+
 #define Dwc_Ddrphy_Apb_Wr(addr, data) \
     (*(uint32_t *)(DDR_PHY_BASE + Ddrphy_AddrRemap(addr)) = (data))
 
@@ -54,16 +64,24 @@
 /* Local Variables */
 
 static bool s_srFastWakeEn = false;
+static uint32_t s_pstate = 0U;
+static uint32_t s_txWwater = 0U;
 
 /* Local Functions */
 
 static uint32_t Ddrphy_AddrRemap(uint32_t paddr);
 static bool Check_DdrcIdle(uint32_t flag);
+static bool Check_DdrcSelfRefresh(void);
 static bool Ddrc_Mrs(uint32_t csSel, uint32_t opcode, uint32_t mr);
 static bool Mr_Write(uint32_t mr_Rank, uint32_t mr_Addr, uint32_t mr_Data);
 static bool Ddr_PhyInit(const struct ddr_info *ddrp);
 static bool Check_Dfi_Init_Complete(void);
+static bool Check_Dfi_Init_Clear(void);
 static bool Ddrc_Init(const struct ddr_info *ddrp);
+static void Ddrc_PstateLoad(const struct ddr_info *ddrp, uint32_t pstate);
+static void Ddrphy_ZcalTicksSet(const struct ddr_info *ddrp,
+    uint32_t pstate);
+static bool Ddrc_FreqChangeRelease(void);
 
 /*--------------------------------------------------------------------------*/
 /* DDR PHY address remap to 32-bit addressing                               */
@@ -87,6 +105,23 @@ static bool Check_DdrcIdle(uint32_t flag)
     return true;
 }
 
+/*--------------------------------------------------------------------------*/
+/* DDR Controller self-refresh status                                       */
+/*--------------------------------------------------------------------------*/
+static bool Check_DdrcSelfRefresh(void)
+{
+    uint32_t timeout = DDR_SR_TIMEOUT;
+
+    while (((Read32(DEBUG_19) & DEBUG_19_SR_MASK) == 0U) && (timeout > 0U))
+    {
+        SystemTimeDelay(1U);
+        timeout--;
+    }
+
+    /* Return status */
+    return ((Read32(DEBUG_19) & DEBUG_19_SR_MASK) != 0U);
+}
+
 /*--------------------------------------------------------------------------*/
 /* DDR MR write                                                             */
 /*--------------------------------------------------------------------------*/
@@ -320,23 +355,10 @@ static bool Ddr_PhyInit(const struct ddr_info *ddrp)
         /* write csrPwrOkDlyCtrl = 1*/
         Dwc_Ddrphy_Apb_Wr(0x20090U, 0x1U);
         /* write csrPstate that corresponds to DfiClk frequency */
-        Dwc_Ddrphy_Apb_Wr(0x2008bU, 0x0U);
-
-        if (ddrp->pstate_num > 2U)
-        {
-            uint32_t dficycle;
+        Dwc_Ddrphy_Apb_Wr(0x2008bU, s_pstate);
 
-            /* In case NumPState > 2, Host writes csrZcalDfiClkTicksPer1uS_p0[10:0] = DfiClk cycle
-             * count to make 1us at the PState during LP3 exit and csrPState = 0 should be kept */
-            dficycle = (ddrp->pstate_freq[0U] / 8U);
-            if ((ddrp->pstate_freq[0U] % 8U) != 0U)
-            {
-                dficycle++;
-            }
-
-            /* number of DfiClks in 1us */
-            Dwc_Ddrphy_Apb_Wr(0x20004U, dficycle);
-        }
+        /* Calibration timebase for the active pstate */
+        Ddrphy_ZcalTicksSet(ddrp, s_pstate);
 
         /* Reset the calibrator to its idle state */
         Dwc_Ddrphy_Apb_Wr(0x20310U, 0x0U);
@@ -365,20 +387,51 @@ static bool Ddr_PhyInit(const struct ddr_info *ddrp)
 /*--------------------------------------------------------------------------*/
 static bool Check_Dfi_Init_Complete(void)
 {
+    uint32_t timeout = DDR_DFI_TIMEOUT;
+    bool rc;
+
+    while (((Read32(&DDRC_CTRL->DDRDSR_2)
+        & DDRC_DDRDSR_2_PHY_INIT_CMPLT_MASK) == 0U) && (timeout > 0U))
+    {
+        SystemTimeDelay(1U);
+        timeout--;
+    }
+
+    rc = ((Read32(&DDRC_CTRL->DDRDSR_2)
+        & DDRC_DDRDSR_2_PHY_INIT_CMPLT_MASK) != 0U);
+
+    if (rc != false)
+    {
+        Write32(&DDRC_CTRL->DDRDSR_2,
+            DDRC_CTRL->DDRDSR_2 | DDRC_DDRDSR_2_PHY_INIT_CMPLT_MASK);
+    }
+
+    /* Return status */
+    return rc;
+}
+
+/*--------------------------------------------------------------------------*/
+/* Clear status of DFI Init                                                 */
+/*--------------------------------------------------------------------------*/
+static bool Check_Dfi_Init_Clear(void)
+{
+    uint32_t timeout = DDR_DFI_TIMEOUT;
+
+    /* Clear PHY INIT complete: BIT2 PHY_INIT_CMPLT W1C */
     do
     {
-        if ((Read32(&DDRC_CTRL->DDRDSR_2) &
-                DDRC_DDRDSR_2_PHY_INIT_CMPLT_MASK) != 0U)
+        DDRC_CTRL->DDRDSR_2 |= DDRC_DDRDSR_2_PHY_INIT_CMPLT_MASK;
+        if ((DDRC_CTRL->DDRDSR_2 & DDRC_DDRDSR_2_PHY_INIT_CMPLT_MASK) == 0U)
         {
             break;
         }
-    } while (true);
-
-    Write32(&DDRC_CTRL->DDRDSR_2,
-        DDRC_CTRL->DDRDSR_2 | DDRC_DDRDSR_2_PHY_INIT_CMPLT_MASK);
+        SystemTimeDelay(1U);
+        timeout--;
+    }
+    while (timeout > 0U);
 
     /* Return status */
-    return true;
+    return ((DDRC_CTRL->DDRDSR_2 & DDRC_DDRDSR_2_PHY_INIT_CMPLT_MASK) == 0U);
 }
 
 /*--------------------------------------------------------------------------*/
@@ -420,15 +473,8 @@ static bool Ddrc_Init(const struct ddr_info *ddrp)
             }
         }
 
-        /* Check pstate */
-        if (ddrp->pstate != NULL)
-        {
-            ddrc_cfg = ddrp->pstate[0].cfg;
-            for (i = 0;  i < ddrp->pstate[0].cfg_num; i++)
-            {
-                Write32(ddrc_cfg[i].reg, ddrc_cfg[i].val);
-            }
-        }
+        /* Load timing of the active pstate */
+        Ddrc_PstateLoad(ddrp, s_pstate);
 
         /* Check dfi init status */
         rc = Check_Dfi_Init_Complete();
@@ -477,3 +523,222 @@ bool DDR_ExitRetention(const struct ddr_info *ddrp)
     return rc;
 }
 
+/*--------------------------------------------------------------------------*/
+/* DDR Enter Frequency Change                                               */
+/*--------------------------------------------------------------------------*/
+bool DDR_FreqChangeEnter(const struct ddr_info *ddrp, uint32_t pstate)
+{
+    bool rc;
+
+    if ((ddrp != NULL) && (ddrp->pstate != NULL)
+        && (pstate < ddrp->pstate_num) && (pstate < 4U))
+    {
+        uint32_t waitFlag = DDRC_DDRDSR_2_IDLE_MASK;
+
+        /* Save TX_CFG_1 WWATER, cleared while ECC is enabled */
+        s_txWwater = DDRC_CTRL->TX_CFG_1 & DDRC_TX_CFG_1_WWATER_MASK;
+
+        /* Is ECC enabled? */
+        if ((DDRC_CTRL->ERR_EN & DDRC_ERR_EN_INLINE_ECC_EN_MASK) != 0U)
+        {
+            DDRC_CTRL->TX_CFG_1 &= ~DDRC_TX_CFG_1_WWATER_MASK;
+
+            /* Also wait for ECC complete */
+            waitFlag |= DDRC_DDRDSR_2_NML_MASK;
+        }
+        else
+        {
+            s_txWwater = 0U;
+        }
+
+        /* Polling for DDRDSR_2[IDLE] & ECC complete to be set */
+        rc = Check_DdrcIdle(waitFlag);
+
+        if (rc != false)
+        {
+            /* MEM HALT */
+            DDRC_CTRL->DDR_SDRAM_CFG |= DDRC_DDR_SDRAM_CFG_MEM_HALT_MASK;
+
+            /* Check if LPDDR5 */
+            if ((DDRC_CTRL->DDR_SDRAM_CFG
+                & DDRC_DDR_SDRAM_CFG_SDRAM_TYPE_MASK) != 0U)
+            {
+                /* STOP ZQCAL for two ranks */
+                rc = Mr_Write(3U, 28U, 2U);
+                /* Wait tZQSTOP(30ns) */
+                SystemTimeDelay(1U);
+            }
+        }
+
+        if (rc != false)
+        {
+            /* Target pstate for the DFI frequency change handshake */
+            DDRC_CTRL->DDR_SDRAM_CFG_4 = (DDRC_CTRL->DDR_SDRAM_CFG_4
+                & ~DDRC_DDR_SDRAM_CFG_4_FRQCH_RET_MASK)
+                | DDRC_DDR_SDRAM_CFG_4_FRQCH_RET(pstate);
+
+            /* Clear PHY INIT complete */
+            rc = Check_Dfi_Init_Clear();
+        }
+
+        if (rc != false)
+        {
+            /* Force the DDRC to enter self refresh */
+            DDRC_CTRL->DDR_SDRAM_CFG_2 |= DDRC_DDR_SDRAM_CFG_2_FRC_SR_MASK;
+
+            /* Wait for self refresh entry */
+            rc = Check_DdrcSelfRefresh();
+        }
+
+        /* Cancel the change and stay on the active pstate on failure */
+        if (rc == false)
+        {
+            DDRC_CTRL->DDR_SDRAM_CFG_4 = (DDRC_CTRL->DDR_SDRAM_CFG_4
+                & ~DDRC_DDR_SDRAM_CFG_4_FRQCH_RET_MASK)
+                | DDRC_DDR_SDRAM_CFG_4_FRQCH_RET(s_pstate);
+            DDRC_CTRL->DDR_SDRAM_CFG_2 &= ~DDRC_DDR_SDRAM_CFG_2_FRC_SR_MASK;
+
+            /* Undo MEM HALT and ZQCAL stop */
+            (void) Ddrc_FreqChangeRelease();
+        }
+    }
+    else
+    {
+        rc = false;
+    }
+
+    /* Return status */
+    return rc;
+}
+
+/*--------------------------------------------------------------------------*/
+/* DDR Exit Frequency Change                                                */
+/*--------------------------------------------------------------------------*/
+bool DDR_FreqChangeExit(const struct ddr_info *ddrp, uint32_t pstate)
+{
+    bool rc;
+
+    if ((ddrp != NULL) && (ddrp->pstate != NULL)
+        && (pstate < ddrp->pstate_num) && (pstate < 4U))
+    {
+        /* Load controller timing of the new pstate */
+        Ddrc_PstateLoad(ddrp, pstate);
+
+        /* APB access enable of CSR bus */
+        Dwc_Ddrphy_Apb_Wr(0xd0000U, 0x0U);
+
+        /* Calibration timebase for the new pstate */
+        Ddrphy_ZcalTicksSet(ddrp, pstate);
+
+        /* disable APB access to csr bus */
+        Dwc_Ddrphy_Apb_Wr(0xd0000U, 0x1U);
+
+        /* Target pstate, may differ from enter when recovering */
+        DDRC_CTRL->DDR_SDRAM_CFG_4 = (DDRC_CTRL->DDR_SDRAM_CFG_4
+            & ~DDRC_DDR_SDRAM_CFG_4_FRQCH_RET_MASK)
+            | DDRC_DDR_SDRAM_CFG_4_FRQCH_RET(pstate);
+
+        /* Exit self refresh, DDRC runs the DFI frequency handshake */
+        DDRC_CTRL->DDR_SDRAM_CFG_2 &= ~DDRC_DDR_SDRAM_CFG_2_FRC_SR_MASK;
+
+        /* Wait for PHY to lock to the new pstate */
+        rc = Check_Dfi_Init_Complete();
+
+        if (rc != false)
+        {
+            s_pstate = pstate;
+        }
+
+        /* Always release MEM HALT and restart ZQCAL */
+        if (!Ddrc_FreqChangeRelease())
+        {
+            rc = false;
+        }
+    }
+    else
+    {
+        rc = false;
+    }
+
+    /* Return status */
+    return rc;
+}
+
+/*--------------------------------------------------------------------------*/
+/* Return the active DDR pstate                                             */
+/*--------------------------------------------------------------------------*/
+uint32_t DDR_PstateGet(void)
+{
+    return s_pstate;
+}
+
+/*--------------------------------------------------------------------------*/
+/* Load DDR controller timing of a pstate                                   */
+/*--------------------------------------------------------------------------*/
+static void Ddrc_PstateLoad(const struct ddr_info *ddrp, uint32_t pstate)
+{
+    if ((ddrp->pstate != NULL) && (pstate < ddrp->pstate_num))
+    {
+        const struct ddrc *ddrc_cfg = ddrp->pstate[pstate].cfg;
+
+        for (uint32_t i = 0U; i < ddrp->pstate[pstate].cfg_num; i++)
+        {
+            Write32(ddrc_cfg[i].reg, ddrc_cfg[i].val);
+        }
+    }
+}
+
+/*--------------------------------------------------------------------------*/
+/* Set DDR PHY impedance calibration timebase of a pstate                   */
+/*--------------------------------------------------------------------------*/
+static void Ddrphy_ZcalTicksSet(const struct ddr_info *ddrp,
+    uint32_t pstate)
+{
+    if ((ddrp->pstate_num > 2U) && (pstate < 4U))
+    {
+        uint32_t dficycle;
+
+        /* In case NumPState > 2, Host writes
+         * csrZcalDfiClkTicksPer1uS_p0[10:0] = DfiClk cycle count to make
+         * 1us at the PState during LP3 exit */
+        dficycle = (ddrp->pstate_freq[pstate] / 8U);
+        if ((ddrp->pstate_freq[pstate] % 8U) != 0U)
+        {
+            dficycle++;
+        }
+
+        /* number of DfiClks in 1us */
+        Dwc_Ddrphy_Apb_Wr(0x20004U, dficycle);
+    }
+}
+
+/*--------------------------------------------------------------------------*/
+/* Release the DDRC after a frequency change                                */
+/*--------------------------------------------------------------------------*/
+static bool Ddrc_FreqChangeRelease(void)
+{
+    bool rc = true;
+
+    /* Check if LPDDR5 */
+    if ((DDRC_CTRL->DDR_SDRAM_CFG & DDRC_DDR_SDRAM_CFG_SDRAM_TYPE_MASK)
+        != 0U)
+    {
+        /* Restart ZQCAL for two ranks */
+        rc = Mr_Write(3U, 28U, 0U);
+    }
+
+    /* Release MEM HALT */
+    DDRC_CTRL->DDR_SDRAM_CFG &= ~DDRC_DDR_SDRAM_CFG_MEM_HALT_MASK;
+
+    /* Restore TX_CFG_1 WWATER */
+    DDRC_CTRL->TX_CFG_1 |= s_txWwater;
+    s_txWwater = 0U;
+
+    if (!Check_DdrcIdle(DDRC_DDRDSR_2_IDLE_MASK))
+    {
+        rc = false;
+    }
+
+    /* Return status */
+    return rc;
+}
@@ -123,6 +123,48 @@ bool DDR_EnterRetention(const struct ddr_info *ddrp);
  */
 bool DDR_ExitRetention(const struct ddr_info *ddrp);
 
+/*!
+ * Enter DRAM frequency change
+ *
+ * @param[in]     ddrp    DDR config info.
+ * @param[in]     pstate  Target pstate.
+ *
+ * Halts the DDRC, selects \a pstate for the DFI frequency change
+ * handshake and places the DRAM into self-refresh. The DRAM clock
+ * can then be changed before calling DDR_FreqChangeExit().
+ *
+ * On failure the DDRC is released again and stays on the active
+ * pstate.
+ *
+ * @return True if successful.
+ */
+bool DDR_FreqChangeEnter(const struct ddr_info *ddrp, uint32_t pstate);
+
+/*!
+ * Exit DRAM frequency change
+ *
+ * @param[in]     ddrp    DDR config info.
+ * @param[in]     pstate  Target pstate.
+ *
+ * Loads the precomputed DDRC timing of \a pstate, exits self-refresh
+ * and waits for the PHY to complete the frequency change. The PHY
+ * pstate registers are part of the trained CSRs and stay resident.
+ *
+ * Must follow a successful DDR_FreqChangeEnter(). To abort a change,
+ * restore the DRAM clock and pass the pstate from DDR_PstateGet().
+ * The DDRC is released even if the handshake fails.
+ *
+ * @return True if successful.
+ */
+bool DDR_FreqChangeExit(const struct ddr_info *ddrp, uint32_t pstate);
+
+/*!
+ * Get the active DRAM pstate
+ *
+ * @return The pstate last established by DDR_FreqChangeExit().
+ */
+uint32_t DDR_PstateGet(void);
+
 #if defined(__cplusplus)
 }
 #endif /*_cplusplus*/
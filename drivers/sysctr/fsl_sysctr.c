@@ -153,3 +153,41 @@ void SYSCTR_FreqMode(bool bLowFreq, bool bWaitAck)
         }
     }
 }
+
+/*--------------------------------------------------------------------------*/
+/* Get earliest armed compare value                                         */
+/*--------------------------------------------------------------------------*/
+bool SYSCTR_GetCompareNext(uint64_t *ticks)
+{
+    bool armed = false;
+    uint64_t cmp;
+
+    *ticks = UINT64_MAX;
+
+    /* Check compare frame 0 enabled and unmasked */
+    if ((SYS_CTR_COMPARE->CMPCR0 & (SYS_CTR_COMPARE_CMPCR0_EN_MASK
+        | SYS_CTR_COMPARE_CMPCR0_IMASK_MASK))
+        == SYS_CTR_COMPARE_CMPCR0_EN_MASK)
+    {
+        cmp = SYS_CTR_COMPARE->CMPCVH0;
+        cmp = (cmp << 32U) | SYS_CTR_COMPARE->CMPCVL0;
+        *ticks = cmp;
+        armed = true;
+    }
+
+    /* Check compare frame 1 enabled and unmasked */
+    if ((SYS_CTR_COMPARE->CMPCR1 & (SYS_CTR_COMPARE_CMPCR1_EN_MASK
+        | SYS_CTR_COMPARE_CMPCR1_IMASK_MASK))
+        == SYS_CTR_COMPARE_CMPCR1_EN_MASK)
+    {
+        cmp = SYS_CTR_COMPARE->CMPCVH1;
+        cmp = (cmp << 32U) | SYS_CTR_COMPARE->CMPCVL1;
+        if (cmp < *ticks)
+        {
+            *ticks = cmp;
+        }
+        armed = true;
+    }
+
+    return armed;
+}
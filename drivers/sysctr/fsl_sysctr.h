@@ -122,6 +122,16 @@ void SYSCTR_TimeDelay(uint32_t usec);
  */
 void SYSCTR_FreqMode(bool bLowFreq, bool bWaitAck);
 
+/*!
+ * This function returns the earliest compare value of the compare
+ * frames that are enabled with the interrupt unmasked.
+ *
+ * @param[out]    ticks       Return pointer to compare value
+ *
+ * @return Returns true if any compare frame is armed.
+ */
+bool SYSCTR_GetCompareNext(uint64_t *ticks);
+
 /** @} */
 
 #endif /* DRV_SYSCTR_H */
@@ -41,6 +41,7 @@
 #include "sm.h"
 #include "brd_sm.h"
 #include "lmm.h"
+#include "trace.h"
 #ifdef RUN_TEST
 #include "test.h"
 #endif
@@ -61,7 +62,7 @@ static bool s_lmmInited = false;
 
 /* Boot times */
 // coverity[misra_c_2012_rule_8_9_violation:FALSE]
-uint64_t g_bootTime[SM_BT_SUB + 1U];
+uint64_t g_bootTime[SM_BT_LMM + 1U];
 
 #ifdef HAS_SM_TEST_MODE
 uint32_t g_testMode = SM_TEST_MODE_OFF;
@@ -81,6 +82,9 @@ int main(int argc, const char * const argv[])
     /* Store boot start time */
     g_bootTime[SM_BT_START] = DEV_SM_Usec64Get();
 
+    /* Init the event trace */
+    TRACE_Init();
+
 #ifdef INC_LIBC
     /* Configure stdio for no buffering */
     (void) setvbuf(stdin, NULL, _IONBF, 0);
@@ -108,7 +112,9 @@ int main(int argc, const char * const argv[])
     /* Init LMM */
     if (status == SM_ERR_SUCCESS)
     {
+        delta = DEV_SM_Usec64Get();
         status = LMM_Init(&mSel, LMM_INIT_FLAGS);
+        g_bootTime[SM_BT_LMM] = DEV_SM_Usec64Get() - delta;
     }
 
     if (status == SM_ERR_SUCCESS)
@@ -111,6 +111,7 @@
 /** @{ */
 #define SM_XPORT_NONE  0U  /*!< None */
 #define SM_XPORT_SMT   1U  /*!< SMT */
+#define SM_XPORT_MRT   2U  /*!< MRT (MU registers) */
 /** @} */
 
 /*!
@@ -127,6 +128,7 @@
 /** @{ */
 #define SM_BT_START  0U  /*!< Start time */
 #define SM_BT_SUB    1U  /*!< Time to subtract */
+#define SM_BT_LMM    2U  /*!< LMM init time */
 /** @} */
 
 /*! Macro to get upper 32 bits of an unsigned 64-bit value */
@@ -154,7 +156,7 @@
 #define BIT64(X)  (((uint64_t) 1U) << (((uint32_t) (X)) % 64UL))
 
 /*! Macro to create word index */
-#define WORD8(X)  (((uint32_t) (X)) / 32UL)
+#define WORD8(X)  (((uint32_t) (X)) / 8UL)
 
 /*! Macro for bit array size */
 #define BITARRAY_SIZE(X)    ((((X) - 1U) / 8U) + 1U)
@@ -237,7 +239,7 @@ typedef const char *string;
 /* Global variables */
 
 /*! Boot times */
-extern uint64_t g_bootTime[SM_BT_SUB + 1U];
+extern uint64_t g_bootTime[SM_BT_LMM + 1U];
 
 /* Functions */
 
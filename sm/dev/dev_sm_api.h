@@ -300,6 +300,11 @@
 #define SM_CLOCKMUXGET          DEV_SM_ClockMuxGet
 #endif
 
+#ifndef SM_CLOCKRATESGET
+/*! Redirector (device/board) to get clock discrete rates */
+#define SM_CLOCKRATESGET        DEV_SM_ClockRatesGet
+#endif
+
 #ifndef SM_CLOCKRATESET
 /*! Redirector (device/board) to set a clock rate */
 #define SM_CLOCKRATESET         DEV_SM_ClockRateSet
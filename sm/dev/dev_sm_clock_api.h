@@ -125,6 +125,32 @@ int32_t DEV_SM_ClockDescribe(uint32_t clockId,
 int32_t DEV_SM_ClockMuxGet(uint32_t clockId, uint32_t idx, uint32_t *mux,
     uint32_t *numMuxes);
 
+/*!
+ * Get device clock discrete rates.
+ *
+ * @param[in]     clockId    Identifier for the clock device
+ * @param[in]     idx        Index of first rate to return
+ * @param[out]    rates      Pointer to array to return rates
+ * @param[in,out] numRates   In: size of \a rates, out: number returned
+ * @param[out]    remaining  Number of rates remaining after this page
+ *
+ * This function allows the caller to get the list of rates the clock
+ * can be set to exactly, in ascending order. The list can be read in
+ * pages by advancing \a idx. Setting a listed rate with round down or
+ * auto rounding results in that rate. The list is for the current
+ * parent and changes if the parent or its rate changes. Lists can be
+ * long, callers must check the length before reporting them.
+ *
+ * @return Returns the status (::SM_ERR_SUCCESS = success).
+ *
+ * Return errors (see @ref STATUS "SM error codes"):
+ * - ::SM_ERR_NOT_FOUND: if \a clockId is invalid.
+ * - ::SM_ERR_OUT_OF_RANGE: if \a idx is invalid.
+ * - ::SM_ERR_NOT_SUPPORTED: if the clock only supports a range.
+ */
+int32_t DEV_SM_ClockRatesGet(uint32_t clockId, uint32_t idx,
+    uint64_t *rates, uint32_t *numRates, uint32_t *remaining);
+
 /*!
  * Set a device clock rate.
  *
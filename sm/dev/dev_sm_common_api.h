@@ -151,6 +151,14 @@ void DEV_SM_MaxStringGet(int32_t *len, int32_t *maxLen,
  */
 int32_t DEV_SM_StrLen(string str);
 
+/*!
+ * Memory barrier.
+ *
+ * Ensures all memory accesses before the barrier are observed by other
+ * bus masters before any access after the barrier.
+ */
+void DEV_SM_MemBarrier(void);
+
 #endif /* DEV_SM_COMMON_API_H */
 
 /** @} */
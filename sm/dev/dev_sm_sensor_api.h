@@ -68,6 +68,8 @@ typedef struct
     bool timestampSupport;
     /*! Timestamp power-of-10 multiplier */
     int8_t timestampExponent;
+    /*! Asynchronous read support */
+    bool asyncReadSupport;
 } dev_sm_sensor_desc_t;
 
 /* Functions */
@@ -52,6 +52,9 @@ static volatile uint32_t s_mSel;
 static volatile uint32_t s_lmmInitFlags;
 static volatile uint32_t s_bootLm;
 static volatile uint8_t s_bootSkip;
+static volatile bool s_bootPending;
+static volatile bool s_rpcDeferPending;
+static volatile bool s_stateRtcPending;
 static volatile int32_t s_bootStatus;
 static uint64_t s_lmStartTime[SM_NUM_LM];
 
@@ -126,6 +129,12 @@ int32_t LMM_Init(uint32_t *mSel, uint32_t lmmInitFlags)
         }
     }
 
+    /* Init LM shared state tables */
+    if (status == SM_ERR_SUCCESS)
+    {
+        status = LMM_StateInit();
+    }
+
     /* Record init parms */
     s_mSel = *mSel;
     s_lmmInitFlags = lmmInitFlags;
@@ -182,6 +191,7 @@ int32_t LMM_Boot(void)
                     /* Record calling parms */
                     s_bootLm = lmId;
                     s_bootSkip = g_lmmConfig[lmId].bootSkip[mSel];
+                    s_bootPending = true;
 
                     /* Trigger SWI handler */
                     SWI_Trigger();
@@ -233,22 +243,8 @@ int32_t LMM_LmNameGet(uint32_t lmId, uint32_t lm, string *lmNameAddr,
     /* Length requested? */
     if (len != NULL)
     {
-        static int32_t s_maxLen = 0;
-
-        /* Already known? */
-        if (s_maxLen == 0)
-        {
-            /* Loop over array */
-            for (uint32_t idx = 0U; idx < SM_NUM_LM; idx++)
-            {
-                /* Get max len */
-                s_maxLen = MAX(s_maxLen, (int32_t)
-                    DEV_SM_StrLen(g_lmmConfig[idx].name));
-            }
-        }
-
-        /* Return result */
-        *len = s_maxLen;
+        /* Return result (computed by configtool) */
+        *len = (int32_t) SM_LM_MAX_NAME_LEN;
     }
 
     /* Return pointer to name */
@@ -313,6 +309,37 @@ int32_t LMM_RpcNotificationTrigger(uint32_t lmId,
     return status;
 }
 
+/*--------------------------------------------------------------------------*/
+/* Trigger deferred RPC processing                                          */
+/*--------------------------------------------------------------------------*/
+void LMM_RpcDeferTrigger(void)
+{
+    /* Record request */
+    s_rpcDeferPending = true;
+
+    /* Trigger SWI handler */
+    SWI_Trigger();
+}
+
+/*--------------------------------------------------------------------------*/
+/* Timer tick                                                               */
+/*--------------------------------------------------------------------------*/
+void LMM_Tick(uint32_t msec)
+{
+    /* Tick RPC, trigger deferred work if due */
+    if (RPC_SCMI_Tick(msec))
+    {
+        LMM_RpcDeferTrigger();
+    }
+
+    /* Tick state table, refresh RTC time outside of the tick */
+    if (LMM_StateTick(msec))
+    {
+        s_stateRtcPending = true;
+        SWI_Trigger();
+    }
+}
+
 /*--------------------------------------------------------------------------*/
 /* Dump all collected errors                                                */
 /*--------------------------------------------------------------------------*/
@@ -345,33 +372,72 @@ void LMM_ErrorDump(void)
 /*--------------------------------------------------------------------------*/
 void LMM_Handler(void)
 {
-    int32_t status = SM_ERR_SUCCESS;
-
-    /* Not required to boot? */
-    if (s_bootSkip != 0U)
+    /* Boot requested? */
+    if (s_bootPending)
     {
-        /* Check if possible to boot? */
-        status = LMM_SystemLmCheck(s_bootLm);
-    }
+        int32_t status = SM_ERR_SUCCESS;
 
-    /* Okay to try to start? */
-    if (status == SM_ERR_SUCCESS)
-    {
-        lmm_rst_rec_t bootRec, shutdownRec;
+        s_bootPending = false;
+
+        /* Not required to boot? */
+        if (s_bootSkip != 0U)
+        {
+            /* Check if possible to boot? */
+            status = LMM_SystemLmCheck(s_bootLm);
+        }
+
+        /* Okay to try to start? */
+        if (status == SM_ERR_SUCCESS)
+        {
+            lmm_rst_rec_t bootRec, shutdownRec;
 
-        /* Get system reason info */
-        LM_SystemReason(0U, &bootRec, &shutdownRec);
+            /* Get system reason info */
+            LM_SystemReason(0U, &bootRec, &shutdownRec);
 
-        /* Boot LM and store status */
-        s_bootStatus = LMM_SystemLmBoot(0U, 0U, s_bootLm, &bootRec);
+            /* Boot LM and store status */
+            s_bootStatus = LMM_SystemLmBoot(0U, 0U, s_bootLm, &bootRec);
 
-        /* Store boot time */
-        s_lmStartTime[s_bootLm] = DEV_SM_Usec64Get();
+            /* Store boot time */
+            s_lmStartTime[s_bootLm] = DEV_SM_Usec64Get();
+        }
+        else
+        {
+            /* Report no error */
+            s_bootStatus = SM_ERR_SUCCESS;
+        }
     }
-    else
+
+    /* Deferred RPC work? */
+    if (s_rpcDeferPending)
     {
-        /* Report no error */
-        s_bootStatus = SM_ERR_SUCCESS;
+        s_rpcDeferPending = false;
+
+        /* Loop over LMs */
+        for (uint32_t lmId = 0U; lmId < SM_NUM_LM; lmId++)
+        {
+            /* Dispatch to RPC interface */
+            switch (g_lmmConfig[lmId].rpcType)
+            {
+                case SM_RPC_SCMI:
+                    RPC_SCMI_DeferredDispatch(g_lmmConfig[lmId].rpcInst);
+                    break;
+                default:
+                    ; /* Intentional empty default */
+                    break;
+            }
+        }
+    }
+
+    /* State table RTC refresh? */
+    if (s_stateRtcPending)
+    {
+        s_stateRtcPending = false;
+
+        /* Loop over RTCs */
+        for (uint32_t rtcId = 0U; rtcId < SM_NUM_RTC; rtcId++)
+        {
+            LMM_StateRtcUpdate(rtcId);
+        }
     }
 }
 
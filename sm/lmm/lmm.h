@@ -64,6 +64,7 @@
 #include "lmm_cpu.h"
 #include "lmm_misc.h"
 #include "lmm_fault.h"
+#include "lmm_state.h"
 #ifdef USES_FUSA
 #include "lmm_fusa.h"
 #endif
@@ -90,6 +91,8 @@
 #define LMM_TRIGGER_FUSA_SEENV  0x6U  /*!< FuSa S-EENV event */
 #define LMM_TRIGGER_FUSA_FAULT  0x7U  /*!< FuSa fault event */
 #define LMM_TRIGGER_CTRL        0x8U  /*!< Control event */
+#define LMM_TRIGGER_POWER       0x9U  /*!< Power state event */
+#define LMM_TRIGGER_CLOCK       0xAU  /*!< Clock rate event */
 /** @} */
 
 /* Types */
@@ -190,6 +193,24 @@ int32_t LMM_RpcReset(uint32_t lmId);
 int32_t LMM_RpcNotificationTrigger(uint32_t lmId,
     const lmm_rpc_trigger_t *trigger);
 
+/*!
+ * Trigger deferred RPC processing.
+ *
+ * Flags deferred RPC work as pending and triggers the SWI. The work is
+ * then run by LMM_Handler().
+ */
+void LMM_RpcDeferTrigger(void);
+
+/*!
+ * LMM timer tick.
+ *
+ * @param[in]     msec          Time elapsed since last tick
+ *
+ * Called from the SM timer tick. Advances RPC timers and triggers deferred
+ * RPC processing if work is due.
+ */
+void LMM_Tick(uint32_t msec);
+
 /*!
  * Dump LMM errors.
  *
@@ -200,7 +221,7 @@ void LMM_ErrorDump(void);
 /*!
  * LMM handler.
  *
- * Handler for SWI to do LM boot.
+ * Handler for SWI to do LM boot and deferred RPC processing.
  */
 void LMM_Handler(void);
 
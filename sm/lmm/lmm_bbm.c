@@ -114,6 +114,7 @@ int32_t LMM_BbmRtcTimeSet(uint32_t lmId, uint32_t rtcId, uint64_t val,
     /* Notify updated */
     if (status == SM_ERR_SUCCESS)
     {
+        LMM_StateRtcUpdate(rtcId);
         LMM_BbmRtcUpdateEvent(rtcId);
     }
 
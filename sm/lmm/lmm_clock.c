@@ -50,8 +50,13 @@
 /* Local variables */
 
 static bool s_clockState[SM_NUM_CLOCK][SM_NUM_LM];
-static uint32_t s_clockParent[DEV_SM_NUM_CLOCK];
-static uint64_t s_clockFreq[DEV_SM_NUM_CLOCK];
+static uint32_t s_clockParent[SM_NUM_CLOCK];
+static uint64_t s_clockFreq[SM_NUM_CLOCK];
+static BITARRAY_DEC(s_clockSaved, SM_NUM_CLOCK);
+
+/* Local functions */
+
+static void LMM_ClockSave(uint32_t clockId);
 
 /*--------------------------------------------------------------------------*/
 /* Init LMM clock management                                                */
@@ -66,14 +71,10 @@ int32_t LMM_ClockInit(uint32_t numClock, const uint32_t *clockList)
         s_clockState[clockList[idx]][0U] = true;
     }
 
-    /* Loop over clocks */
-    for (uint32_t clockId = 0U; clockId < SM_NUM_CLOCK; clockId++)
+    /* Boot parent and rate saved on first change, see LMM_ClockSave() */
+    for (uint32_t idx = 0U; idx < BITARRAY_SIZE(SM_NUM_CLOCK); idx++)
     {
-        /* Save parent */
-        (void) LMM_ClockParentGet(0U, clockId, &s_clockParent[clockId]);
-
-        /* Save clock rate */
-        (void) LMM_ClockRateGet(0U, clockId, &s_clockFreq[clockId]);
+        s_clockSaved[idx] = 0U;
     }
 
     /* Return status */
@@ -110,14 +111,32 @@ int32_t LMM_ClockMuxGet(uint32_t lmId, uint32_t clockId, uint32_t idx,
     return SM_CLOCKMUXGET(clockId, idx, mux, numMuxes);
 }
 
+/*--------------------------------------------------------------------------*/
+/* Return discrete clock rates                                              */
+/*--------------------------------------------------------------------------*/
+int32_t LMM_ClockRatesGet(uint32_t lmId, uint32_t clockId, uint32_t idx,
+    uint64_t *rates, uint32_t *numRates, uint32_t *remaining)
+{
+    /* Just passthru to device */
+    return SM_CLOCKRATESGET(clockId, idx, rates, numRates, remaining);
+}
+
 /*--------------------------------------------------------------------------*/
 /* Set clock rate                                                           */
 /*--------------------------------------------------------------------------*/
 int32_t LMM_ClockRateSet(uint32_t lmId, uint32_t clockId, uint64_t rate,
     uint32_t roundSel)
 {
-    /* Not shared, just passthru to device */
-    return SM_CLOCKRATESET(clockId, rate, roundSel);
+    int32_t status;
+
+    /* Save boot state before first change */
+    LMM_ClockSave(clockId);
+
+    /* Not shared, just passthru to device, shared state updated by event */
+    status = SM_CLOCKRATESET(clockId, rate, roundSel);
+
+    /* Return status */
+    return status;
 }
 
 /*--------------------------------------------------------------------------*/
@@ -148,7 +167,8 @@ int32_t LMM_ClockReset(uint32_t lmId, uint32_t clockId)
         {
             status = SM_ERR_BUSY;
         }
-        else
+        else if ((clockId < SM_NUM_CLOCK)
+            && (BITARRAY_GET(s_clockSaved, clockId) != 0U))
         {
             /* Restore parent */
             (void) LMM_ClockParentSet(lmId, clockId,
@@ -158,6 +178,10 @@ int32_t LMM_ClockReset(uint32_t lmId, uint32_t clockId)
             (void) LMM_ClockRateSet(lmId, clockId, s_clockFreq[clockId],
                 DEV_SM_CLOCK_ROUND_DOWN);
         }
+        else
+        {
+            ; /* Never changed, nothing to restore */
+        }
     }
 
     /* Return status */
@@ -201,6 +225,12 @@ int32_t LMM_ClockEnable(uint32_t lmId, uint32_t clockId, bool enable)
 
         /* Inform device of clock state, device will check if changed */
         status = SM_CLOCKENABLE(clockId, newEnable);
+
+        /* Update shared state */
+        if (status == SM_ERR_SUCCESS)
+        {
+            LMM_StateClockUpdate(clockId);
+        }
     }
 
     SM_TEST_MODE_ERR(SM_TEST_MODE_LMM_LVL1, SM_ERR_TEST)
@@ -223,8 +253,16 @@ int32_t LMM_ClockIsEnabled(uint32_t lmId, uint32_t clockId, bool *enabled)
 /*--------------------------------------------------------------------------*/
 int32_t LMM_ClockParentSet(uint32_t lmId, uint32_t clockId, uint32_t parent)
 {
-    /* Not shared, just passthru to device */
-    return SM_CLOCKPARENTSET(clockId, parent);
+    int32_t status;
+
+    /* Save boot state before first change */
+    LMM_ClockSave(clockId);
+
+    /* Not shared, just passthru to device, shared state updated by event */
+    status = SM_CLOCKPARENTSET(clockId, parent);
+
+    /* Return status */
+    return status;
 }
 
 /*--------------------------------------------------------------------------*/
@@ -288,3 +326,47 @@ int32_t LMM_ClockExtendedGet(uint32_t lmId, uint32_t clockId, uint32_t extId,
     return status;
 }
 
+/*--------------------------------------------------------------------------*/
+/* Report clock rate change event                                           */
+/*--------------------------------------------------------------------------*/
+void LMM_ClockRateEvent(uint32_t clockId, uint64_t rate)
+{
+    /* Update shared state */
+    LMM_StateClockUpdate(clockId);
+
+    /* Dispatch for all LM */
+    for (uint32_t dstLm = 0U; dstLm < SM_NUM_LM; dstLm++)
+    {
+        lmm_rpc_trigger_t trigger =
+        {
+            .event = LMM_TRIGGER_CLOCK,
+            .parm[0] = clockId,
+            .parm[1] = (uint32_t) (rate & 0xFFFFFFFFULL),
+            .parm[2] = (uint32_t) (rate >> 32U)
+        };
+
+        (void) LMM_RpcNotificationTrigger(dstLm, &trigger);
+    }
+}
+
+/*==========================================================================*/
+
+/*--------------------------------------------------------------------------*/
+/* Save clock parent and rate before the first change                       */
+/*--------------------------------------------------------------------------*/
+static void LMM_ClockSave(uint32_t clockId)
+{
+    /* Not yet saved? */
+    if ((clockId < SM_NUM_CLOCK)
+        && (BITARRAY_GET(s_clockSaved, clockId) == 0U))
+    {
+        /* Save parent */
+        (void) SM_CLOCKPARENTGET(clockId, &s_clockParent[clockId]);
+
+        /* Save clock rate */
+        (void) SM_CLOCKRATEGET(clockId, &s_clockFreq[clockId]);
+
+        BITARRAY_SET(s_clockSaved, clockId);
+    }
+}
+
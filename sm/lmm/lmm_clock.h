@@ -64,8 +64,9 @@
  * @param[in]     numClock       Number of clocks
  * @param[in]     clockList      List of clocks
  *
- * This function copies current clock state. This include is used when an
- * LM is rebooted.
+ * This function records the LM0 clock enable state. The clock parent and
+ * rate used when an LM is rebooted are captured lazily on the first
+ * change to each clock rather than here.
  *
  * @return Returns the status (::SM_ERR_SUCCESS = success).
  *
@@ -135,6 +136,28 @@ int32_t LMM_ClockDescribe(uint32_t lmId, uint32_t clockId,
 int32_t LMM_ClockMuxGet(uint32_t lmId, uint32_t clockId, uint32_t idx,
     uint32_t *mux, uint32_t *numMuxes);
 
+/*!
+ * Get LM clock discrete rates.
+ *
+ * @param[in]     lmId       LM call is for
+ * @param[in]     clockId    Identifier for the clock device
+ * @param[in]     idx        Index of first rate to return
+ * @param[out]    rates      Pointer to array to return rates
+ * @param[in,out] numRates   In: size of \a rates, out: number returned
+ * @param[out]    remaining  Number of rates remaining after this page
+ *
+ * This function allows the caller to get a page of the ascending list
+ * of rates the clock can be set to exactly.
+ *
+ * @return Returns the status (::SM_ERR_SUCCESS = success).
+ *
+ * Return errors (see @ref STATUS "SM error codes"):
+ * - ::SM_ERR_SUCCESS: if the rates are returned.
+ * - others returned by ::SM_CLOCKRATESGET
+ */
+int32_t LMM_ClockRatesGet(uint32_t lmId, uint32_t clockId, uint32_t idx,
+    uint64_t *rates, uint32_t *numRates, uint32_t *remaining);
+
 /*!
  * Set an LM clock rate.
  *
@@ -181,7 +204,8 @@ int32_t LMM_ClockRateGet(uint32_t lmId, uint32_t clockId,
  * @param[in]     clockId   Identifier for the clock device
  *
  * This function allows the caller to reset the clock rate and
- * parent back to those captured in LMM_ClockInit().
+ * parent back to those captured before the first LMM change to
+ * the clock. A clock never changed is left untouched.
  *
  * @return Returns the status (::SM_ERR_SUCCESS = success).
  *
@@ -308,6 +332,19 @@ int32_t LMM_ClockExtendedSet(uint32_t lmId, uint32_t clockId, uint32_t extId,
 int32_t LMM_ClockExtendedGet(uint32_t lmId, uint32_t clockId, uint32_t extId,
     uint32_t *extConfigValue);
 
+/*!
+ * Report clock rate change event.
+ *
+ * This function reports a clock rate change to the LMM. Called by the
+ * device for clocks set directly and for all clocks derived from them,
+ * including changes made by the performance level code. Updates the LM
+ * shared state tables and sends rate change notifications.
+ *
+ * @param[in]  clockId  Clock that changed rate
+ * @param[in]  rate     New clock rate (in Hz)
+ */
+void LMM_ClockRateEvent(uint32_t clockId, uint64_t rate);
+
 #endif /* LMM_CLOCK_H */
 
 /** @} */
@@ -102,6 +102,7 @@ typedef struct
     uint32_t start;                    /*!< Start index */
     uint32_t stop;                     /*!< Stop index */
     uint32_t rtime;                    /*!< Relative start time */
+    uint32_t stateAddr;                /*!< Shared state table, 0 = none */
     string name;                       /*!< Name of LM */
     uint8_t rpcType;                   /*!< RPC type */
     uint8_t rpcInst;                   /*!< RPC instance */
@@ -42,6 +42,7 @@
 #include "sm.h"
 #include "lmm.h"
 #include "dev_sm_api.h"
+#include "trace.h"
 
 /* Local defines */
 
@@ -141,7 +142,10 @@ int32_t LMM_PerfLevelSet(uint32_t lmId, uint32_t domainId,
         }
 
         /* Inform device of power state, device will check if changed */
+        SM_TRACE(SM_TRACE_CAT_PERF, SM_TRACE_PERF_START, domainId,
+            newPerfLevel);
         status = SM_PERFLEVELSET(domainId, newPerfLevel);
+        SM_TRACE(SM_TRACE_CAT_PERF, SM_TRACE_PERF_DONE, domainId, status);
     }
 
     SM_TEST_MODE_ERR(SM_TEST_MODE_LMM_LVL1, SM_ERR_TEST)
@@ -160,3 +164,12 @@ int32_t LMM_PerfLevelGet(uint32_t lmId, uint32_t domainId,
     return SM_PERFLEVELGET(domainId, performanceLevel);
 }
 
+/*--------------------------------------------------------------------------*/
+/* Report performance level change event                                    */
+/*--------------------------------------------------------------------------*/
+void LMM_PerfLevelEvent(uint32_t domainId, uint32_t perfLevel)
+{
+    /* Update shared state */
+    LMM_StatePerfUpdate(domainId, perfLevel);
+}
+
@@ -179,6 +179,18 @@ int32_t LMM_PerfLevelSet(uint32_t lmId, uint32_t domainId,
 int32_t LMM_PerfLevelGet(uint32_t lmId, uint32_t domainId,
     uint32_t *performanceLevel);
 
+/*!
+ * Report performance level change event.
+ *
+ * This function reports a performance level change to the LMM. Called by
+ * the device for the domain that was set and for any parent or
+ * sub-domains whose level changed with it.
+ *
+ * @param[in]  domainId   Performance domain that changed level
+ * @param[in]  perfLevel  New performance level
+ */
+void LMM_PerfLevelEvent(uint32_t domainId, uint32_t perfLevel);
+
 #endif /* LMM_PERF_H */
 
 /** @} */
@@ -93,6 +93,7 @@ int32_t LMM_PowerStateSet(uint32_t lmId, uint32_t domainId,
     {
         static uint8_t s_powerState[SM_NUM_POWER][SM_NUM_LM];
         uint8_t newPowerState = 0U;
+        uint8_t oldPowerState = DEV_SM_POWER_STATE_OFF;
 
         /* Record new state */
         s_powerState[domainId][lmId] = (uint8_t) (powerState & 0xFFU);
@@ -103,8 +104,20 @@ int32_t LMM_PowerStateSet(uint32_t lmId, uint32_t domainId,
             newPowerState = MAX(newPowerState, s_powerState[domainId][lm]);
         }
 
+        /* Get current state */
+        status = SM_POWERSTATEGET(domainId, &oldPowerState);
+
         /* Inform device of power state, device will check if changed */
-        status = SM_POWERSTATESET(domainId, newPowerState);
+        if (status == SM_ERR_SUCCESS)
+        {
+            status = SM_POWERSTATESET(domainId, newPowerState);
+        }
+
+        /* Report change */
+        if ((status == SM_ERR_SUCCESS) && (newPowerState != oldPowerState))
+        {
+            LMM_PowerEvent(domainId, newPowerState);
+        }
     }
 
     SM_TEST_MODE_ERR(SM_TEST_MODE_LMM_LVL1, SM_ERR_TEST)
@@ -123,3 +136,25 @@ int32_t LMM_PowerStateGet(uint32_t lmId, uint32_t domainId,
     return SM_POWERSTATEGET(domainId, powerState);
 }
 
+/*--------------------------------------------------------------------------*/
+/* Report power state change event                                          */
+/*--------------------------------------------------------------------------*/
+void LMM_PowerEvent(uint32_t domainId, uint8_t powerState)
+{
+    /* Update shared state */
+    LMM_StatePowerUpdate(domainId, powerState);
+
+    /* Dispatch for all LM */
+    for (uint32_t dstLm = 0U; dstLm < SM_NUM_LM; dstLm++)
+    {
+        lmm_rpc_trigger_t trigger =
+        {
+            .event = LMM_TRIGGER_POWER,
+            .parm[0] = domainId,
+            .parm[1] = (uint32_t) powerState
+        };
+
+        (void) LMM_RpcNotificationTrigger(dstLm, &trigger);
+    }
+}
+
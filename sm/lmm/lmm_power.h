@@ -144,6 +144,18 @@ int32_t LMM_PowerStateSet(uint32_t lmId, uint32_t domainId,
 int32_t LMM_PowerStateGet(uint32_t lmId, uint32_t domainId,
     uint8_t *powerState);
 
+/*!
+ * Report power state change event.
+ *
+ * This function reports a power domain state change to the LMM. Called
+ * for software requested changes and for hardware (GPC) handshake driven
+ * changes.
+ *
+ * @param[in]  domainId    Power domain that changed state
+ * @param[in]  powerState  New power state
+ */
+void LMM_PowerEvent(uint32_t domainId, uint8_t powerState);
+
 #endif /* LMM_POWER_H */
 
 /** @} */
@@ -75,8 +75,19 @@ int32_t LMM_SensorDescribe(uint32_t lmId, uint32_t sensorId,
 int32_t LMM_SensorReadingGet(uint32_t lmId, uint32_t sensorId,
     int64_t *sensorValue, uint64_t *sensorTimestamp)
 {
+    int32_t status;
+
     /* Just passthru to board/device */
-    return SM_SENSORREADINGGET(sensorId, sensorValue, sensorTimestamp);
+    status = SM_SENSORREADINGGET(sensorId, sensorValue, sensorTimestamp);
+
+    /* Update shared state */
+    if (status == SM_ERR_SUCCESS)
+    {
+        LMM_StateSensorUpdate(sensorId, *sensorValue);
+    }
+
+    /* Return status */
+    return status;
 }
 
 /*--------------------------------------------------------------------------*/
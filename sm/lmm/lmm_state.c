@@ -0,0 +1,449 @@
+/*
+** ###################################################################
+**
+** Copyright 2024 NXP
+**
+** Redistribution and use in source and binary forms, with or without modification,
+** are permitted provided that the following conditions are met:
+**
+** o Redistributions of source code must retain the above copyright notice, this list
+**   of conditions and the following disclaimer.
+**
+** o Redistributions in binary form must reproduce the above copyright notice, this
+**   list of conditions and the following disclaimer in the documentation and/or
+**   other materials provided with the distribution.
+**
+** o Neither the name of the copyright holder nor the names of its
+**   contributors may be used to endorse or promote products derived from this
+**   software without specific prior written permission.
+**
+** THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+** ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+** WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+** DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+** ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+** (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+** LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+** ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+** (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+** SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+**
+**
+** ###################################################################
+*/
+
+/*==========================================================================*/
+/* File containing the implementation of the Logical Machine Manager        */
+/* shared state table.                                                      */
+/*==========================================================================*/
+
+/* Includes */
+
+#include "sm.h"
+#include "lmm.h"
+#include "rpc_scmi.h"
+#include "dev_sm_api.h"
+
+/* Local defines */
+
+/*! Period of the RTC time refresh in msec */
+#define LMM_STATE_RTC_MSEC  1000U
+
+/* Local types */
+
+/* Local variables */
+
+static uint32_t s_stateDepth = 0U;
+static bool s_stateReady = false;
+static uint32_t s_stateRtcMsec = 0U;
+
+#ifdef SIMU
+static lmm_state_t s_stateSimu[SM_NUM_LM];
+#endif
+
+/* Local functions */
+
+static lmm_state_t *LMM_StateTable(uint32_t lmId);
+static bool LMM_StateVisible(uint32_t lmId, uint32_t protocolId,
+    uint32_t resourceId);
+static bool LMM_StateAnyVisible(uint32_t protocolId, uint32_t resourceId);
+static void LMM_StateBegin(void);
+static void LMM_StateEnd(void);
+
+/*--------------------------------------------------------------------------*/
+/* Init the LM shared state tables                                          */
+/*--------------------------------------------------------------------------*/
+int32_t LMM_StateInit(void)
+{
+    int32_t status = SM_ERR_SUCCESS;
+
+    /* Device events before this point are covered by the fill in below */
+    s_stateReady = true;
+
+    /* Loop over LMs */
+    for (uint32_t lmId = 0U; lmId < SM_NUM_LM; lmId++)
+    {
+        lmm_state_t *table = LMM_StateTable(lmId);
+
+        if (table != NULL)
+        {
+            /* Mark invalid during init */
+            table->seq = 1U;
+            DEV_SM_MemBarrier();
+
+            table->magic = LMM_STATE_MAGIC;
+            table->numPower = SM_NUM_POWER;
+            table->numPerf = SM_NUM_PERF;
+            table->numClock = SM_NUM_CLOCK;
+            table->numSensor = SM_NUM_SENSOR;
+            table->numRtc = SM_NUM_RTC;
+
+            /* No sensor values until first read */
+            for (uint32_t sensorId = 0U; sensorId < SM_NUM_SENSOR;
+                sensorId++)
+            {
+                table->sensorValue[sensorId] = 0;
+            }
+
+            /* Hide everything, filled in below */
+            for (uint32_t domainId = 0U; domainId < SM_NUM_POWER;
+                domainId++)
+            {
+                table->powerState[domainId] = LMM_STATE_NONE;
+            }
+            for (uint32_t domainId = 0U; domainId < SM_NUM_PERF;
+                domainId++)
+            {
+                table->perfLevel[domainId] = LMM_STATE_NONE;
+            }
+            for (uint32_t clockId = 0U; clockId < SM_NUM_CLOCK; clockId++)
+            {
+                table->clockRate[clockId] = 0ULL;
+                table->clockEnable[clockId] = LMM_STATE_NONE;
+            }
+            for (uint32_t rtcId = 0U; rtcId < SM_NUM_RTC; rtcId++)
+            {
+                table->rtcTime[rtcId] = 0ULL;
+            }
+
+            DEV_SM_MemBarrier();
+            table->seq = 2U;
+        }
+    }
+
+    /* Fill in current state */
+    for (uint32_t domainId = 0U; domainId < SM_NUM_POWER; domainId++)
+    {
+        uint8_t powerState = 0U;
+
+        /* Only query domains some table reports */
+        if (LMM_StateAnyVisible(SCMI_PROTOCOL_POWER, domainId)
+            && (SM_POWERSTATEGET(domainId, &powerState) == SM_ERR_SUCCESS))
+        {
+            LMM_StatePowerUpdate(domainId, powerState);
+        }
+    }
+    for (uint32_t domainId = 0U; domainId < SM_NUM_PERF; domainId++)
+    {
+        uint32_t perfLevel = 0U;
+
+        if (SM_PERFLEVELGET(domainId, &perfLevel) == SM_ERR_SUCCESS)
+        {
+            LMM_StatePerfUpdate(domainId, perfLevel);
+        }
+    }
+    for (uint32_t clockId = 0U; clockId < SM_NUM_CLOCK; clockId++)
+    {
+        LMM_StateClockUpdate(clockId);
+    }
+    for (uint32_t rtcId = 0U; rtcId < SM_NUM_RTC; rtcId++)
+    {
+        LMM_StateRtcUpdate(rtcId);
+    }
+
+    /* Return status */
+    return status;
+}
+
+/*--------------------------------------------------------------------------*/
+/* Get the state table of an LM                                             */
+/*--------------------------------------------------------------------------*/
+const lmm_state_t *LMM_StateTableGet(uint32_t lmId)
+{
+    const lmm_state_t *table = NULL;
+
+    /* Check LM */
+    if (lmId < SM_NUM_LM)
+    {
+        table = LMM_StateTable(lmId);
+    }
+
+    /* Return table */
+    return table;
+}
+
+/*--------------------------------------------------------------------------*/
+/* Update power domain state                                                */
+/*--------------------------------------------------------------------------*/
+void LMM_StatePowerUpdate(uint32_t domainId, uint8_t powerState)
+{
+    LMM_StateBegin();
+
+    /* Loop over LMs */
+    for (uint32_t lmId = 0U; lmId < SM_NUM_LM; lmId++)
+    {
+        lmm_state_t *table = LMM_StateTable(lmId);
+
+        if ((table != NULL) && LMM_StateVisible(lmId, SCMI_PROTOCOL_POWER,
+            domainId))
+        {
+            table->powerState[domainId] = (uint32_t) powerState;
+        }
+    }
+
+    LMM_StateEnd();
+}
+
+/*--------------------------------------------------------------------------*/
+/* Update perf level                                                        */
+/*--------------------------------------------------------------------------*/
+void LMM_StatePerfUpdate(uint32_t domainId, uint32_t perfLevel)
+{
+    if (domainId < SM_NUM_PERF)
+    {
+        LMM_StateBegin();
+
+        /* Loop over LMs */
+        for (uint32_t lmId = 0U; lmId < SM_NUM_LM; lmId++)
+        {
+            lmm_state_t *table = LMM_StateTable(lmId);
+
+            if ((table != NULL) && LMM_StateVisible(lmId,
+                SCMI_PROTOCOL_PERF, domainId))
+            {
+                table->perfLevel[domainId] = perfLevel;
+            }
+        }
+
+        LMM_StateEnd();
+    }
+}
+
+/*--------------------------------------------------------------------------*/
+/* Update clock state                                                       */
+/*--------------------------------------------------------------------------*/
+void LMM_StateClockUpdate(uint32_t clockId)
+{
+    uint64_t rate = 0ULL;
+    bool enabled = false;
+
+    /* Get state, only if some table reports the clock */
+    if ((clockId < SM_NUM_CLOCK)
+        && LMM_StateAnyVisible(SCMI_PROTOCOL_CLOCK, clockId)
+        && (SM_CLOCKRATEGET(clockId, &rate) == SM_ERR_SUCCESS)
+        && (SM_CLOCKISENABLED(clockId, &enabled) == SM_ERR_SUCCESS))
+    {
+        LMM_StateBegin();
+
+        /* Loop over LMs */
+        for (uint32_t lmId = 0U; lmId < SM_NUM_LM; lmId++)
+        {
+            lmm_state_t *table = LMM_StateTable(lmId);
+
+            if ((table != NULL) && LMM_StateVisible(lmId,
+                SCMI_PROTOCOL_CLOCK, clockId))
+            {
+                table->clockRate[clockId] = rate;
+                table->clockEnable[clockId] = enabled ? 1U : 0U;
+            }
+        }
+
+        LMM_StateEnd();
+    }
+}
+
+/*--------------------------------------------------------------------------*/
+/* Update sensor value                                                      */
+/*--------------------------------------------------------------------------*/
+void LMM_StateSensorUpdate(uint32_t sensorId, int64_t sensorValue)
+{
+    LMM_StateBegin();
+
+    /* Loop over LMs */
+    for (uint32_t lmId = 0U; lmId < SM_NUM_LM; lmId++)
+    {
+        lmm_state_t *table = LMM_StateTable(lmId);
+
+        if ((table != NULL) && LMM_StateVisible(lmId, SCMI_PROTOCOL_SENSOR,
+            sensorId))
+        {
+            table->sensorValue[sensorId] = sensorValue;
+        }
+    }
+
+    LMM_StateEnd();
+}
+
+/*--------------------------------------------------------------------------*/
+/* Update RTC time                                                          */
+/*--------------------------------------------------------------------------*/
+void LMM_StateRtcUpdate(uint32_t rtcId)
+{
+    uint64_t rtcTime = 0ULL;
+
+    /* Get time, only if some table reports the RTC */
+    if ((rtcId < SM_NUM_RTC)
+        && LMM_StateAnyVisible(SCMI_PROTOCOL_BBM, rtcId)
+        && (SM_BBMRTCTIMEGET(rtcId, &rtcTime, false) == SM_ERR_SUCCESS))
+    {
+        LMM_StateBegin();
+
+        /* Loop over LMs */
+        for (uint32_t lmId = 0U; lmId < SM_NUM_LM; lmId++)
+        {
+            lmm_state_t *table = LMM_StateTable(lmId);
+
+            if ((table != NULL) && LMM_StateVisible(lmId,
+                SCMI_PROTOCOL_BBM, rtcId))
+            {
+                table->rtcTime[rtcId] = rtcTime;
+            }
+        }
+
+        LMM_StateEnd();
+    }
+}
+
+/*--------------------------------------------------------------------------*/
+/* Tick the RTC refresh timer                                               */
+/*--------------------------------------------------------------------------*/
+bool LMM_StateTick(uint32_t msec)
+{
+    bool due = false;
+
+    /* Only count once tables exist */
+    if (s_stateReady)
+    {
+        s_stateRtcMsec += msec;
+
+        /* Refresh due? */
+        if (s_stateRtcMsec >= LMM_STATE_RTC_MSEC)
+        {
+            s_stateRtcMsec = 0U;
+            due = true;
+        }
+    }
+
+    /* Return result */
+    return due;
+}
+
+/*==========================================================================*/
+
+/*--------------------------------------------------------------------------*/
+/* Return the writable state table of an LM                                 */
+/*--------------------------------------------------------------------------*/
+static lmm_state_t *LMM_StateTable(uint32_t lmId)
+{
+    lmm_state_t *table = NULL;
+
+    /* Table configured and initialized? */
+    if (s_stateReady && (g_lmmConfig[lmId].stateAddr != 0U))
+    {
+#ifdef SIMU
+        table = &s_stateSimu[lmId];
+#else
+        table = (lmm_state_t*) g_lmmConfig[lmId].stateAddr;
+#endif
+    }
+
+    /* Return table */
+    return table;
+}
+
+/*--------------------------------------------------------------------------*/
+/* Check if resource is visible to an LM                                    */
+/*--------------------------------------------------------------------------*/
+static bool LMM_StateVisible(uint32_t lmId, uint32_t protocolId,
+    uint32_t resourceId)
+{
+    bool visible = false;
+
+    /* Only SCMI defines resource permissions */
+    if (g_lmmConfig[lmId].rpcType == SM_RPC_SCMI)
+    {
+        visible = RPC_SCMI_ResourceVisible(g_lmmConfig[lmId].rpcInst,
+            protocolId, resourceId);
+    }
+
+    /* Return result */
+    return visible;
+}
+
+/*--------------------------------------------------------------------------*/
+/* Check if resource is visible to any LM with a table                      */
+/*--------------------------------------------------------------------------*/
+static bool LMM_StateAnyVisible(uint32_t protocolId, uint32_t resourceId)
+{
+    bool visible = false;
+
+    /* Loop over LMs */
+    for (uint32_t lmId = 0U; lmId < SM_NUM_LM; lmId++)
+    {
+        if ((LMM_StateTable(lmId) != NULL) && LMM_StateVisible(lmId,
+            protocolId, resourceId))
+        {
+            visible = true;
+            break;
+        }
+    }
+
+    /* Return result */
+    return visible;
+}
+
+/*--------------------------------------------------------------------------*/
+/* Start a table update                                                     */
+/*--------------------------------------------------------------------------*/
+static void LMM_StateBegin(void)
+{
+    /* Outermost update marks tables as changing (odd) */
+    if (s_stateDepth == 0U)
+    {
+        for (uint32_t lmId = 0U; lmId < SM_NUM_LM; lmId++)
+        {
+            lmm_state_t *table = LMM_StateTable(lmId);
+
+            if (table != NULL)
+            {
+                table->seq++;
+            }
+        }
+        DEV_SM_MemBarrier();
+    }
+    s_stateDepth++;
+}
+
+/*--------------------------------------------------------------------------*/
+/* End a table update                                                       */
+/*--------------------------------------------------------------------------*/
+static void LMM_StateEnd(void)
+{
+    s_stateDepth--;
+
+    /* Outermost update marks tables as stable (even) */
+    if (s_stateDepth == 0U)
+    {
+        DEV_SM_MemBarrier();
+        for (uint32_t lmId = 0U; lmId < SM_NUM_LM; lmId++)
+        {
+            lmm_state_t *table = LMM_StateTable(lmId);
+
+            if (table != NULL)
+            {
+                table->seq++;
+            }
+        }
+    }
+}
+
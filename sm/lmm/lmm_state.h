@@ -0,0 +1,167 @@
+/*
+** ###################################################################
+**
+** Copyright 2024 NXP
+**
+** Redistribution and use in source and binary forms, with or without modification,
+** are permitted provided that the following conditions are met:
+**
+** o Redistributions of source code must retain the above copyright notice, this list
+**   of conditions and the following disclaimer.
+**
+** o Redistributions in binary form must reproduce the above copyright notice, this
+**   list of conditions and the following disclaimer in the documentation and/or
+**   other materials provided with the distribution.
+**
+** o Neither the name of the copyright holder nor the names of its
+**   contributors may be used to endorse or promote products derived from this
+**   software without specific prior written permission.
+**
+** THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+** ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+** WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+** DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+** ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+** (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+** LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+** ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+** (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+** SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+**
+**
+** ###################################################################
+*/
+
+/*==========================================================================*/
+/*!
+ * @addtogroup LMM_STATE
+ * @{
+ *
+ * @file
+ * @brief
+ *
+ * Header file containing the API for the Logical Machine Manager shared
+ * state table.
+ */
+/*==========================================================================*/
+
+#ifndef LMM_STATE_H
+#define LMM_STATE_H
+
+/* Includes */
+
+#include "sm.h"
+#include "dev_sm_api.h"
+
+/* Defines */
+
+/*! State table magic ("SMST") */
+#define LMM_STATE_MAGIC  0x534D5354U
+
+/*! Value of a 32-bit state entry not visible to the LM */
+#define LMM_STATE_NONE   0xFFFFFFFFU
+
+/* Types */
+
+/*!
+ * LMM shared state table
+ *
+ * One table per LM, located at the address configured with the LM *state*
+ * parameter. The SM is the only writer. Agents read with plain loads using
+ * the sequence count: read \a seq, read the entries, read \a seq again and
+ * retry if it changed or was odd. Entries for resources the LM has no read
+ * access to are ::LMM_STATE_NONE (32-bit) or 0 (64-bit). RTC times are
+ * refreshed once a second and when an RTC is set.
+ */
+typedef struct
+{
+    uint32_t magic;                          /*!< Magic, ::LMM_STATE_MAGIC */
+    volatile uint32_t seq;                   /*!< Sequence, odd while updating */
+    uint32_t numPower;                       /*!< Number of power domains */
+    uint32_t numPerf;                        /*!< Number of perf domains */
+    uint32_t numClock;                       /*!< Number of clocks */
+    uint32_t numSensor;                      /*!< Number of sensors */
+    uint32_t numRtc;                         /*!< Number of RTCs */
+    uint64_t clockRate[SM_NUM_CLOCK];        /*!< Clock rates in Hz */
+    int64_t sensorValue[SM_NUM_SENSOR];      /*!< Last sensor values */
+    uint64_t rtcTime[SM_NUM_RTC];            /*!< RTC time in seconds */
+    uint32_t powerState[SM_NUM_POWER];       /*!< Power domain states */
+    uint32_t perfLevel[SM_NUM_PERF];         /*!< Perf domain levels */
+    uint32_t clockEnable[SM_NUM_CLOCK];      /*!< Clock enable (0/1) */
+} lmm_state_t;
+
+/* Functions */
+
+/*!
+ * Init the LM shared state tables.
+ *
+ * This function fills in the state table of every LM that has one
+ * configured. Called from LMM_Init().
+ *
+ * @return Returns the status (::SM_ERR_SUCCESS = success).
+ */
+int32_t LMM_StateInit(void);
+
+/*!
+ * Get the state table of an LM.
+ *
+ * @param[in]     lmId  LM to get table for
+ *
+ * @return Returns a pointer to the table or NULL if the LM has none.
+ */
+const lmm_state_t *LMM_StateTableGet(uint32_t lmId);
+
+/*!
+ * Update power domain state in the state tables.
+ *
+ * @param[in]     domainId    Power domain
+ * @param[in]     powerState  New power state
+ */
+void LMM_StatePowerUpdate(uint32_t domainId, uint8_t powerState);
+
+/*!
+ * Update perf level in the state tables.
+ *
+ * @param[in]     domainId   Performance domain
+ * @param[in]     perfLevel  New performance level
+ */
+void LMM_StatePerfUpdate(uint32_t domainId, uint32_t perfLevel);
+
+/*!
+ * Update clock state in the state tables.
+ *
+ * @param[in]     clockId  Clock to update
+ */
+void LMM_StateClockUpdate(uint32_t clockId);
+
+/*!
+ * Update sensor value in the state tables.
+ *
+ * @param[in]     sensorId     Sensor to update
+ * @param[in]     sensorValue  Last value read
+ */
+void LMM_StateSensorUpdate(uint32_t sensorId, int64_t sensorValue);
+
+/*!
+ * Update RTC time in the state tables.
+ *
+ * @param[in]     rtcId  RTC to update
+ *
+ * Reads the current time of the RTC. Must not be called from an
+ * interrupt handler that can preempt other table updates.
+ */
+void LMM_StateRtcUpdate(uint32_t rtcId);
+
+/*!
+ * Tick the state table RTC refresh timer.
+ *
+ * @param[in]     msec  Time elapsed since last tick in msec
+ *
+ * @return Returns true if an RTC refresh via LMM_StateRtcUpdate() is due.
+ */
+bool LMM_StateTick(uint32_t msec);
+
+#endif /* LMM_STATE_H */
+
+/** @} */
+
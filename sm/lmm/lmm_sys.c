@@ -42,6 +42,7 @@
 #include "sm.h"
 #include "lmm.h"
 #include "dev_sm_api.h"
+#include "trace.h"
 
 /* Local defines */
 
@@ -488,6 +489,7 @@ int32_t LMM_SystemLmPowerOn(uint32_t lmId, uint32_t agentId, uint32_t pwrLm)
 
         /* Record status */
         s_lmError[pwrLm] = status;
+        SM_TRACE(SM_TRACE_CAT_LMM, SM_TRACE_LMM_POWER, pwrLm, status);
     }
 
     SM_TEST_MODE_ERR(SM_TEST_MODE_LMM_LVL1, SM_ERR_TEST)
@@ -660,6 +662,8 @@ int32_t LMM_SystemLmSuspend(uint32_t lmId, uint32_t agentId,
 
         /* Notify LM via system */
         (void) LMM_RpcNotificationTrigger(suspendLm, &trigger);
+
+        SM_TRACE(SM_TRACE_CAT_LMM, SM_TRACE_LMM_SUSPEND, suspendLm, agentId);
     }
 
     SM_TEST_MODE_ERR(SM_TEST_MODE_LMM_LVL1, SM_ERR_TEST)
@@ -693,6 +697,8 @@ int32_t LMM_SystemLmWake(uint32_t lmId, uint32_t agentId, uint32_t wakeLm)
 
         /* Notify LM via system */
         (void) LMM_RpcNotificationTrigger(wakeLm, &trigger);
+
+        SM_TRACE(SM_TRACE_CAT_LMM, SM_TRACE_LMM_WAKE, wakeLm, agentId);
     }
 
     SM_TEST_MODE_ERR(SM_TEST_MODE_LMM_LVL1, SM_ERR_TEST)
@@ -888,6 +894,7 @@ static int32_t LMM_DoBoot(lmm_rpc_trigger_t *trigger,
 
         /* Record status */
         s_lmError[bootLm] = status;
+        SM_TRACE(SM_TRACE_CAT_LMM, SM_TRACE_LMM_BOOT, bootLm, status);
     }
 
     /* Return status */
@@ -949,6 +956,7 @@ static int32_t LMM_DoShutdown(lmm_rpc_trigger_t *trigger,
 
         /* Record status */
         s_lmError[shutdownLm] = status;
+        SM_TRACE(SM_TRACE_CAT_LMM, SM_TRACE_LMM_SHUTDOWN, shutdownLm, status);
     }
 
     /* Return status */
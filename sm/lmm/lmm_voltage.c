@@ -42,6 +42,7 @@
 #include "sm.h"
 #include "lmm.h"
 #include "dev_sm_api.h"
+#include "trace.h"
 
 /* Local defines */
 
@@ -117,7 +118,10 @@ int32_t LMM_VoltageModeSet(uint32_t lmId, uint32_t domainId,
         }
 
         /* Inform device of voltage mode, device will check if changed */
+        SM_TRACE(SM_TRACE_CAT_VOLT, SM_TRACE_VOLT_MODE, domainId,
+            newVoltMode);
         status = SM_VOLTAGEMODESET(domainId, newVoltMode);
+        SM_TRACE(SM_TRACE_CAT_VOLT, SM_TRACE_VOLT_DONE, domainId, status);
     }
 
     SM_TEST_MODE_ERR(SM_TEST_MODE_LMM_LVL1, SM_ERR_TEST)
@@ -142,8 +146,16 @@ int32_t LMM_VoltageModeGet(uint32_t lmId, uint32_t domainId,
 int32_t LMM_VoltageLevelSet(uint32_t lmId, uint32_t domainId,
     int32_t voltageLevel)
 {
+    int32_t status;
+
     /* Not shared, just passthru to device */
-    return SM_VOLTAGELEVELSET(domainId, voltageLevel);
+    SM_TRACE(SM_TRACE_CAT_VOLT, SM_TRACE_VOLT_LEVEL, domainId,
+        voltageLevel);
+    status = SM_VOLTAGELEVELSET(domainId, voltageLevel);
+    SM_TRACE(SM_TRACE_CAT_VOLT, SM_TRACE_VOLT_DONE, domainId, status);
+
+    /* Return status */
+    return status;
 }
 
 /*--------------------------------------------------------------------------*/
@@ -44,10 +44,17 @@
 #include "mb_mu.h"
 #include "config_mb_mu.h"
 #include "rpc_smt.h"
+#ifdef USES_XPORT_MRT
+#include "rpc_mrt.h"
+#endif
 #include "fsl_mu.h"
+#include "trace.h"
 
 /* Local defines */
 
+/*! Last data register full, signals a register transport message */
+#define MB_MU_DATA_FULL  MU_RX_FLAG(1UL << (SM_NUM_MB_MU_DATA - 1U))
+
 /* Local types */
 
 /* Local variables */
@@ -98,9 +105,18 @@ int32_t MB_MU_Init(uint8_t inst, uint8_t db, bool noIrq, uint32_t initCount)
     {
         MU_Type *base = s_muBases[s_mbMuConfig[inst].mu];
 
-        /* Enable GI interrupt */
-        MU_EnableInterrupts(base, ((uint32_t) kMU_GenInt0InterruptEnable)
-                << db);
+        if (s_mbMuConfig[inst].xportType[db] == SM_XPORT_MRT)
+        {
+            /* Enable last data register full interrupt */
+            MU_EnableInterrupts(base, ((uint32_t)
+                kMU_Rx0FullInterruptEnable) << (SM_NUM_MB_MU_DATA - 1U));
+        }
+        else
+        {
+            /* Enable GI interrupt */
+            MU_EnableInterrupts(base, ((uint32_t)
+                kMU_GenInt0InterruptEnable) << db);
+        }
     }
 
     /* Return status */
@@ -217,6 +233,80 @@ int32_t MB_MU_IsAborted(uint8_t inst, uint8_t db)
     return status;
 }
 
+/*--------------------------------------------------------------------------*/
+/* Send data words                                                          */
+/*--------------------------------------------------------------------------*/
+int32_t MB_MU_DataTx(uint8_t inst, const uint32_t *data, uint32_t num)
+{
+    int32_t status = SM_ERR_SUCCESS;
+
+    /* Check mu and num */
+    if ((inst >= SM_NUM_MB_MU) || (num > SM_NUM_MB_MU_DATA))
+    {
+        status = SM_ERR_OUT_OF_RANGE;
+    }
+
+    if (status == SM_ERR_SUCCESS)
+    {
+        MU_Type *base = s_muBases[s_mbMuConfig[inst].mu];
+        uint32_t mask = MU_TX_FLAG((1UL << num) - 1UL);
+
+        /* Previous data must have been read */
+        if ((MU_GetStatusFlags(base) & mask) != mask)
+        {
+            status = SM_ERR_BUSY;
+        }
+        else
+        {
+            /* Write data, last register signals the other side */
+            for (uint32_t idx = 0U; idx < num; idx++)
+            {
+                MU_SendMsgNonBlocking(base, idx, data[idx]);
+            }
+        }
+    }
+
+    /* Return status */
+    return status;
+}
+
+/*--------------------------------------------------------------------------*/
+/* Receive data words                                                       */
+/*--------------------------------------------------------------------------*/
+int32_t MB_MU_DataRx(uint8_t inst, uint32_t *data, uint32_t num)
+{
+    int32_t status = SM_ERR_SUCCESS;
+
+    /* Check mu and num */
+    if ((inst >= SM_NUM_MB_MU) || (num > SM_NUM_MB_MU_DATA))
+    {
+        status = SM_ERR_OUT_OF_RANGE;
+    }
+
+    if (status == SM_ERR_SUCCESS)
+    {
+        MU_Type *base = s_muBases[s_mbMuConfig[inst].mu];
+        uint32_t mask = MU_RX_FLAG((1UL << num) - 1UL);
+
+        /* All data must be present */
+        if ((MU_GetStatusFlags(base) & mask) != mask)
+        {
+            status = SM_ERR_PROTOCOL_ERROR;
+        }
+        else
+        {
+            /* Read data, this clears the full flags */
+            for (uint32_t idx = 0U; idx < num; idx++)
+            {
+                data[idx] = MU_ReceiveMsgNonBlocking(base, idx);
+            }
+        }
+    }
+
+    /* Return status */
+    return status;
+}
+
 /*--------------------------------------------------------------------------*/
 /* Common MU IRQ handler                                                    */
 /*--------------------------------------------------------------------------*/
@@ -229,6 +319,9 @@ void MB_MU_Handler(uint32_t mu)
     /* Get interrupt status flags */
     flags = MU_GetStatusFlags(base);
 
+    /* Trace IRQ */
+    SM_TRACE(SM_TRACE_CAT_IRQ, SM_TRACE_IRQ_MU, mu, flags);
+
     /* Clear interrupts */
     MU_ClearStatusFlags(base, flags);
 
@@ -243,6 +336,12 @@ void MB_MU_Handler(uint32_t mu)
             {
                 uint32_t mask = ((uint32_t) kMU_GenInt0Flag) << gi;
 
+                /* Register transport signals with data instead of GI */
+                if (s_mbMuConfig[mb].xportType[gi] == SM_XPORT_MRT)
+                {
+                    mask = MB_MU_DATA_FULL;
+                }
+
                 if ((flags & mask) != 0U)
                 {
                     /* Call transport */
@@ -252,6 +351,12 @@ void MB_MU_Handler(uint32_t mu)
                             RPC_SMT_Dispatch(
                                 s_mbMuConfig[mb].xportChannel[gi]);
                             break;
+#ifdef USES_XPORT_MRT
+                        case SM_XPORT_MRT:
+                            RPC_MRT_Dispatch(
+                                s_mbMuConfig[mb].xportChannel[gi]);
+                            break;
+#endif
                         default:
                             ; /* Intentional empty default */
                             break;
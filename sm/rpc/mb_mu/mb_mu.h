@@ -127,6 +127,43 @@ bool MB_MU_DoorbellState(uint8_t inst, uint8_t db);
  */
 int32_t MB_MU_IsAborted(uint8_t inst, uint8_t db);
 
+/*!
+ * Send data words.
+ *
+ * @param[in]     inst        Instance to send on
+ * @param[in]     data        Pointer to words to send
+ * @param[in]     num         Number of words, max ::SM_NUM_MB_MU_DATA
+ *
+ * This writes \a num words to the MU transmit data registers in order.
+ * Writing the last register signals the other side. Used by register
+ * transports such as @ref RPC_MRT.
+ *
+ * @return Returns the status (::SM_ERR_SUCCESS = success).
+ *
+ * Return errors (see @ref STATUS "SM error codes"):
+ * - ::SM_ERR_BUSY: if the other side has not read the previous data.
+ * - ::SM_ERR_OUT_OF_RANGE: if calling parameters invalid.
+ */
+int32_t MB_MU_DataTx(uint8_t inst, const uint32_t *data, uint32_t num);
+
+/*!
+ * Receive data words.
+ *
+ * @param[in]     inst        Instance to read
+ * @param[out]    data        Pointer to return words
+ * @param[in]     num         Number of words, max ::SM_NUM_MB_MU_DATA
+ *
+ * This reads \a num words from the MU receive data registers. Reading
+ * frees the registers for the other side to send again.
+ *
+ * @return Returns the status (::SM_ERR_SUCCESS = success).
+ *
+ * Return errors (see @ref STATUS "SM error codes"):
+ * - ::SM_ERR_PROTOCOL_ERROR: if not all registers are full.
+ * - ::SM_ERR_OUT_OF_RANGE: if calling parameters invalid.
+ */
+int32_t MB_MU_DataRx(uint8_t inst, uint32_t *data, uint32_t num);
+
 /*!
  * Handle MU interrupt.
  *
@@ -60,6 +60,9 @@
 /*! Number of general purpose interrupts for doorbells */
 #define SM_NUM_MB_MU_DB    4U
 
+/*! Number of data registers used by register transports */
+#define SM_NUM_MB_MU_DATA  4U
+
 /*!
  * Mailbox-MU config structure
  *
@@ -0,0 +1,297 @@
+/*
+** ###################################################################
+**
+** Copyright 2024 NXP
+**
+** Redistribution and use in source and binary forms, with or without modification,
+** are permitted provided that the following conditions are met:
+**
+** o Redistributions of source code must retain the above copyright notice, this list
+**   of conditions and the following disclaimer.
+**
+** o Redistributions in binary form must reproduce the above copyright notice, this
+**   list of conditions and the following disclaimer in the documentation and/or
+**   other materials provided with the distribution.
+**
+** o Neither the name of the copyright holder nor the names of its
+**   contributors may be used to endorse or promote products derived from this
+**   software without specific prior written permission.
+**
+** THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+** ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+** WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+** DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+** ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+** (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+** LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+** ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+** (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+** SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+**
+**
+** ###################################################################
+*/
+
+/*==========================================================================*/
+/* File containing the implementation of the MU Register Transport (MRT).   */
+/*==========================================================================*/
+
+/* Includes */
+
+#include <stdint.h>
+#include "sm.h"
+#include "rpc_mrt.h"
+#include "config_mrt.h"
+#include "rpc_scmi.h"
+#ifdef USES_MB_MU
+#include "mb_mu.h"
+#endif
+
+/* Local defines */
+
+/* Local types */
+
+/* Local variables */
+
+static const rpc_mrt_chn_config_t s_mrtConfig[SM_NUM_MRT_CHN] =
+{
+    SM_MRT_CHN_CONFIG_DATA
+};
+
+static uint32_t s_mrtBuf[SM_NUM_MRT_CHN][MRT_BUFFER_SIZE / 4U];
+
+static bool s_mrtInProgress[SM_NUM_MRT_CHN];
+
+/* Local functions */
+
+/*--------------------------------------------------------------------------*/
+/* Init MRT channel                                                         */
+/*--------------------------------------------------------------------------*/
+int32_t RPC_MRT_Init(uint32_t mrtChannel, bool noIrq, uint32_t initCount)
+{
+    int32_t status = SM_ERR_SUCCESS;
+
+    /* Check channel */
+    if (mrtChannel >= SM_NUM_MRT_CHN)
+    {
+        status = SM_ERR_OUT_OF_RANGE;
+    }
+
+    /* Check for error? */
+    if (status == SM_ERR_SUCCESS)
+    {
+        /* Init mailbox */
+        switch (s_mrtConfig[mrtChannel].mbType)
+        {
+#ifdef USES_MB_MU
+            case SM_MB_MU:
+                status = MB_MU_Init(s_mrtConfig[mrtChannel].mbInst,
+                    s_mrtConfig[mrtChannel].mbDoorbell, noIrq, initCount);
+                break;
+#endif
+            default:
+                status = SM_ERR_INVALID_PARAMETERS;
+                break;
+        }
+    }
+
+    /* Init the local buffer */
+    if (status == SM_ERR_SUCCESS)
+    {
+        for (uint32_t word = 0U; word < (MRT_BUFFER_SIZE / 4U); word++)
+        {
+            s_mrtBuf[mrtChannel][word] = 0U;
+        }
+
+        /* Not in progress */
+        s_mrtInProgress[mrtChannel] = false;
+    }
+
+    /* Return status */
+    return status;
+}
+
+/*--------------------------------------------------------------------------*/
+/* Get MRT header address                                                   */
+/*--------------------------------------------------------------------------*/
+void *RPC_MRT_HdrAddrGet(uint32_t mrtChannel)
+{
+    void *rtn = NULL;
+
+    /* Get address of header */
+    if (mrtChannel < SM_NUM_MRT_CHN)
+    {
+        rtn = (void*) &s_mrtBuf[mrtChannel][0];
+    }
+
+    return rtn;
+}
+
+/*--------------------------------------------------------------------------*/
+/* Dispatch MRT message                                                     */
+/*--------------------------------------------------------------------------*/
+void RPC_MRT_Dispatch(uint32_t mrtChannel)
+{
+    int32_t status;
+    uint32_t header = 0U;
+
+    /* Read frame, this frees the registers for the next request */
+    switch (s_mrtConfig[mrtChannel].mbType)
+    {
+#ifdef USES_MB_MU
+        case SM_MB_MU:
+            status = MB_MU_DataRx(s_mrtConfig[mrtChannel].mbInst,
+                s_mrtBuf[mrtChannel], MRT_MSG_WORDS);
+            break;
+#endif
+        default:
+            status = SM_ERR_INVALID_PARAMETERS;
+            break;
+    }
+
+    /* Call RPC-specific dispatcher */
+    if (status == SM_ERR_SUCCESS)
+    {
+        /* Save request header for forced completion */
+        header = s_mrtBuf[mrtChannel][0];
+
+        /* Mark in progress */
+        s_mrtInProgress[mrtChannel] = true;
+
+        switch (s_mrtConfig[mrtChannel].rpcType)
+        {
+            case SM_RPC_SCMI:
+                RPC_SCMI_Dispatch(s_mrtConfig[mrtChannel].rpcChannel);
+                break;
+            default:
+                ; /* Intentional empty default */
+                break;
+        }
+    }
+
+    /* Not completed? */
+    if (s_mrtInProgress[mrtChannel])
+    {
+        /* Force completion with request header and error status */
+        s_mrtBuf[mrtChannel][0] = header;
+        s_mrtBuf[mrtChannel][1] = (uint32_t) SM_ERR_PROTOCOL_ERROR;
+        (void) RPC_MRT_Tx(mrtChannel, 2U * sizeof(uint32_t));
+    }
+}
+
+/*--------------------------------------------------------------------------*/
+/* Get abort status                                                         */
+/*--------------------------------------------------------------------------*/
+int32_t RPC_MRT_IsAborted(uint32_t mrtChannel)
+{
+    int32_t status = SM_ERR_SUCCESS;
+
+    /* Check channel */
+    if (mrtChannel >= SM_NUM_MRT_CHN)
+    {
+        status = SM_ERR_OUT_OF_RANGE;
+    }
+
+    /* Check for error? */
+    if (status == SM_ERR_SUCCESS)
+    {
+        switch (s_mrtConfig[mrtChannel].mbType)
+        {
+#ifdef USES_MB_MU
+            case SM_MB_MU:
+                status = MB_MU_IsAborted(s_mrtConfig[mrtChannel].mbInst,
+                    s_mrtConfig[mrtChannel].mbDoorbell);
+                break;
+#endif
+            default:
+                status = SM_ERR_INVALID_PARAMETERS;
+                break;
+        }
+    }
+
+    /* Return status */
+    return status;
+}
+
+/*--------------------------------------------------------------------------*/
+/* MRT send                                                                 */
+/*--------------------------------------------------------------------------*/
+int32_t RPC_MRT_Tx(uint32_t mrtChannel, uint32_t len)
+{
+    int32_t status = SM_ERR_SUCCESS;
+
+    /* Check channel */
+    if (mrtChannel >= SM_NUM_MRT_CHN)
+    {
+        status = SM_ERR_OUT_OF_RANGE;
+    }
+
+    /* Check length */
+    if ((status == SM_ERR_SUCCESS) && (len > MRT_MSG_SIZE))
+    {
+        status = SM_ERR_PROTOCOL_ERROR;
+    }
+
+    if (status == SM_ERR_SUCCESS)
+    {
+        uint32_t *buf = s_mrtBuf[mrtChannel];
+
+        /* Zero unused words of the frame */
+        for (uint32_t word = (len + 3U) / 4U; word < MRT_MSG_WORDS; word++)
+        {
+            buf[word] = 0U;
+        }
+
+        /* Send frame */
+        switch (s_mrtConfig[mrtChannel].mbType)
+        {
+#ifdef USES_MB_MU
+            case SM_MB_MU:
+                status = MB_MU_DataTx(s_mrtConfig[mrtChannel].mbInst, buf,
+                    MRT_MSG_WORDS);
+                break;
+#endif
+            default:
+                status = SM_ERR_INVALID_PARAMETERS;
+                break;
+        }
+
+        /* Mark as complete */
+        s_mrtInProgress[mrtChannel] = false;
+    }
+
+    /* Return status */
+    return status;
+}
+
+/*--------------------------------------------------------------------------*/
+/* MRT receive                                                              */
+/*--------------------------------------------------------------------------*/
+int32_t RPC_MRT_Rx(uint32_t mrtChannel, void* msgRx, uint32_t *len)
+{
+    int32_t status = SM_ERR_SUCCESS;
+
+    /* Check channel */
+    if (mrtChannel >= SM_NUM_MRT_CHN)
+    {
+        status = SM_ERR_OUT_OF_RANGE;
+    }
+
+    /* Check length */
+    if ((status == SM_ERR_SUCCESS) && (MRT_MSG_SIZE > *len))
+    {
+        status = SM_ERR_PROTOCOL_ERROR;
+    }
+
+    /* Copy frame read by RPC_MRT_Dispatch() */
+    if (status == SM_ERR_SUCCESS)
+    {
+        *len = MRT_MSG_SIZE;
+        (void) memcpy(msgRx, (const void*) s_mrtBuf[mrtChannel],
+            MRT_MSG_SIZE);
+    }
+
+    /* Return status */
+    return status;
+}
+
@@ -0,0 +1,172 @@
+/*
+** ###################################################################
+**
+** Copyright 2024 NXP
+**
+** Redistribution and use in source and binary forms, with or without modification,
+** are permitted provided that the following conditions are met:
+**
+** o Redistributions of source code must retain the above copyright notice, this list
+**   of conditions and the following disclaimer.
+**
+** o Redistributions in binary form must reproduce the above copyright notice, this
+**   list of conditions and the following disclaimer in the documentation and/or
+**   other materials provided with the distribution.
+**
+** o Neither the name of the copyright holder nor the names of its
+**   contributors may be used to endorse or promote products derived from this
+**   software without specific prior written permission.
+**
+** THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+** ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+** WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+** DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+** ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+** (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+** LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+** ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+** (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+** SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+**
+**
+** ###################################################################
+*/
+
+/*==========================================================================*/
+/*!
+ * @addtogroup RPC_MRT
+ * @{
+ *
+ * @file
+ * @brief
+ *
+ * Header file containing the public API for the MU Register Transport
+ * (MRT).
+ *
+ * An MRT message is a fixed frame of ::MRT_MSG_WORDS words, the RPC header
+ * followed by the payload, carried in the mailbox data registers. The agent
+ * writes the request frame to its transmit registers, last register last,
+ * which interrupts the SM. The SM writes the response frame to its transmit
+ * registers which the agent polls (or takes an interrupt on) for the last
+ * register full. Unused words are zero. Messages that do not fit in a frame
+ * must use another transport channel.
+ */
+/*==========================================================================*/
+
+#ifndef RPC_MRT_H
+#define RPC_MRT_H
+
+/* Includes */
+
+#include "sm.h"
+
+/* Defines */
+
+/*! MRT frame size in words */
+#define MRT_MSG_WORDS    4U
+/*! MRT frame size in bytes (header + payload) */
+#define MRT_MSG_SIZE     (MRT_MSG_WORDS * 4U)
+/*! MRT local buffer size */
+#define MRT_BUFFER_SIZE  128U
+
+/* Functions */
+
+/*!
+ * Initialize the MRT channel.
+ *
+ * @param[in]     mrtChannel  MRT channel
+ * @param[in]     noIrq       true then don't enable the interrupt
+ * @param[in]     initCount   Init count for agent channels
+ *
+ * This function clears the local message buffer and calls the mailbox
+ * driver to initialize the mailbox data registers.
+ *
+ * @return Returns the status (::SM_ERR_SUCCESS = success).
+ */
+int32_t RPC_MRT_Init(uint32_t mrtChannel, bool noIrq, uint32_t initCount);
+
+/*!
+ * Get MRT payload address.
+ *
+ * @param[in]     mrtChannel  MRT channel
+ *
+ * This function gets the address of the header/payload in the local
+ * message buffer. Data to be sent with RPC_MRT_Tx() must be written
+ * here. The buffer is filled from the mailbox registers by RPC_MRT_Rx().
+ *
+ * @return Returns the buffer address.
+ */
+void *RPC_MRT_HdrAddrGet(uint32_t mrtChannel);
+
+/*!
+ * Dispatch MRT message.
+ *
+ * @param[in]     mrtChannel  MRT channel
+ *
+ * This function dispatches an MRT receive interrupt. It reads the frame
+ * from the mailbox data registers into the local buffer. The \a mrtChannel
+ * parameter is used to index into the local const MRT config structure
+ * to find the linked RPC type and RPC channel. The RPC dispatch function
+ * is then called. If the RPC did not send a response then an all-zero
+ * frame is sent to complete the exchange.
+ */
+void RPC_MRT_Dispatch(uint32_t mrtChannel);
+
+/*!
+ * Get abort status.
+ *
+ * @param[in]     mrtChannel  MRT channel
+ *
+ * Returns if the MRT channel is in an aborted state.
+ *
+ * @return Returns the status (::SM_ERR_SUCCESS = success).
+ *
+ * Return errors (see @ref STATUS "SM error codes"):
+ * - ::SM_ERR_SUCCESS: if not aborted.
+ * - ::SM_ERR_ABORT_ERROR: if aborted.
+ * - ::SM_ERR_OUT_OF_RANGE: if \a mrtChannel is invalid.
+ */
+int32_t RPC_MRT_IsAborted(uint32_t mrtChannel);
+
+/*!
+ * Transmit MRT response.
+ *
+ * @param[in]     mrtChannel  MRT channel to send
+ * @param[in]     len         Size of payload to transmit
+ *
+ * This function transmits the response in the local buffer obtained via
+ * RPC_MRT_HdrAddrGet() as one frame through the mailbox data registers.
+ *
+ * @return Returns the status (::SM_ERR_SUCCESS = success).
+ *
+ * Return errors (see @ref STATUS "SM error codes"):
+ * - ::SM_ERR_PROTOCOL_ERROR: if \a len is greater than ::MRT_MSG_SIZE
+ * - ::SM_ERR_OUT_OF_RANGE: if \a mrtChannel is invalid
+ * - others returned by the mailbox (e.g. MB_MU_DataTx())
+ */
+int32_t RPC_MRT_Tx(uint32_t mrtChannel, uint32_t len);
+
+/*!
+ * Receive MRT request.
+ *
+ * @param[in]     mrtChannel  MRT channel to read
+ * @param[out]    msgRx       Pointer to the destination buffer
+ * @param[inout]  len         Pointer to destination buffer size
+ *
+ * This function copies the frame read by RPC_MRT_Dispatch() to
+ * \a msgRx. The \a len parameter is
+ * passed in as the max size of the destination buffer and returns the
+ * frame size (::MRT_MSG_SIZE).
+ *
+ * @return Returns the status (::SM_ERR_SUCCESS = success).
+ *
+ * Return errors (see @ref STATUS "SM error codes"):
+ * - ::SM_ERR_PROTOCOL_ERROR: if the destination buffer is too small
+ * - ::SM_ERR_OUT_OF_RANGE: if \a mrtChannel is invalid
+ */
+int32_t RPC_MRT_Rx(uint32_t mrtChannel, void* msgRx, uint32_t *len);
+
+#endif /* RPC_MRT_H */
+
+/** @} */
+
@@ -41,14 +41,34 @@
 
 #include "sm.h"
 #include "rpc_smt.h"
+#ifdef USES_XPORT_MRT
+#include "rpc_mrt.h"
+#endif
 #include "config_scmi.h"
 #include "rpc_scmi_internal.h"
 #include "lmm.h"
+#include "trace.h"
 
 /* Local defines */
 
 #define SCMI_NUM_Q  2U
 
+/* Quota bucket units per message or per uS of CPU time */
+#define SCMI_QUOTA_SCALE  1000000ULL
+
+/* Response images: max payload words, base discover messages 0x3-0x5 */
+#define SCMI_IMAGE_MAX_WORDS  6U
+#define SCMI_IMAGE_BASE_MSG   3U
+#define SCMI_IMAGE_NUM_BASE   3U
+#define SCMI_NUM_IMAGE        ((2U * sizeof(s_protocolList)) \
+    + SCMI_IMAGE_NUM_BASE)
+
+/* Keyed response images for name/attribute queries */
+#define SCMI_IMAGE_NUM_KEYED  16U
+#define SCMI_IMAGE_MSG_ATTR   2U
+#define SCMI_IMAGE_DOM_ATTR   3U
+#define SCMI_IMAGE_AGENT      7U
+
 /* Local macros */
 
 /* SCMI header creation */
@@ -77,9 +97,24 @@ typedef struct
     uint32_t head;
     uint32_t tail;
     uint32_t count;
+    uint32_t reserved;
     uint32_t data[SM_SCMI_MAX_NOTIFY];
 } notify_queue_t;
 
+typedef struct
+{
+    uint64_t lastTime;
+    uint64_t msgTokens;
+    int64_t cpuCredit;
+} agent_quota_t;
+
+typedef struct
+{
+    uint32_t len;
+    uint32_t key;
+    uint32_t data[SCMI_IMAGE_MAX_WORDS];
+} response_image_t;
+
 /* Local variables */
 
 static const uint8_t s_protocolList[] =
@@ -106,6 +141,11 @@ static uint32_t s_token[SM_SCMI_NUM_CHN];
 static uint32_t s_channel2queue[SM_SCMI_NUM_CHN];
 static uint32_t s_agent2channel[SM_SCMI_NUM_AGNT][SCMI_NUM_Q];
 static notify_queue_t s_queue[SM_SCMI_NUM_AGNT][SCMI_NUM_Q];
+static bool s_deferPending;
+static agent_quota_t s_quota[SM_SCMI_NUM_AGNT];
+static scmi_agent_stats_t s_agentStats[SM_SCMI_NUM_AGNT];
+static response_image_t s_image[SM_NUM_SCMI][SCMI_NUM_IMAGE];
+static response_image_t s_imageKeyed[SM_NUM_SCMI][SCMI_IMAGE_NUM_KEYED];
 #ifdef MONITOR
 static channel_err_t s_channelErr[SM_SCMI_NUM_CHN];
 #endif
@@ -118,7 +158,20 @@ static int32_t RPC_SCMI_IsAborted(uint32_t scmiChannel);
 static void RPC_SCMI_A2pDispatch(uint32_t scmiChannel);
 static int32_t RPC_SCMI_A2pSubDispatch(scmi_caller_t *caller,
     uint32_t protocolId, uint32_t messageId);
+static int32_t RPC_SCMI_ImageDispatch(scmi_caller_t *caller,
+    uint32_t protocolId, uint32_t messageId);
+static uint32_t RPC_SCMI_ImageIdx(const scmi_caller_t *caller,
+    uint32_t protocolId, uint32_t messageId);
+static response_image_t *RPC_SCMI_ImageGet(const scmi_caller_t *caller,
+    uint32_t protocolId, uint32_t messageId, uint32_t *key);
+static void RPC_SCMI_QuotaInit(uint32_t agentId);
+static int32_t RPC_SCMI_QuotaCheck(uint32_t agentId);
+static void RPC_SCMI_QuotaCharge(uint32_t agentId, uint64_t cpuTime);
 static void RPC_SCMI_P2aDispatch(uint32_t scmiChannel);
+static bool RPC_SCMI_P2aQValid(uint32_t agentId, uint32_t queue);
+static int32_t RPC_SCMI_P2aXportTx(uint32_t scmiChannel, uint32_t len,
+    bool compInt);
+static uint32_t RPC_SCMI_P2aQPop(uint32_t agentId, uint32_t queue);
 static int32_t RPC_SCMI_A2pRx(scmi_caller_t *caller, void* msgRx,
     uint32_t len);
 static int32_t RPC_SCMI_A2pTx(const scmi_caller_t *caller, uint32_t len,
@@ -170,6 +223,9 @@ int32_t RPC_SCMI_AgentInit(uint32_t agentId)
     {
         uint32_t initCount = 0U;
 
+        /* Reset load quotas */
+        RPC_SCMI_QuotaInit(agentId);
+
         /* Init transport for each agent channel */
         for (uint32_t scmiChannel = 0U; scmiChannel < SM_SCMI_NUM_CHN;
             scmiChannel++)
@@ -205,9 +261,11 @@ int32_t RPC_SCMI_AgentInit(uint32_t agentId)
                     s_queue[agentId][SCMI_NOTIFY_Q].head = 0U;
                     s_queue[agentId][SCMI_NOTIFY_Q].tail = 0U;
                     s_queue[agentId][SCMI_NOTIFY_Q].count = 0U;
+                    s_queue[agentId][SCMI_NOTIFY_Q].reserved = 0U;
                     s_queue[agentId][SCMI_PRIORITY_Q].head = 0U;
                     s_queue[agentId][SCMI_PRIORITY_Q].tail = 0U;
                     s_queue[agentId][SCMI_PRIORITY_Q].count = 0U;
+                    s_queue[agentId][SCMI_PRIORITY_Q].reserved = 0U;
                 }
 
                 /* Reset token */
@@ -222,6 +280,14 @@ int32_t RPC_SCMI_AgentInit(uint32_t agentId)
                             g_scmiChannelConfig[scmiChannel].xportChannel,
                             noIrq, initCount);
                         break;
+#ifdef USES_XPORT_MRT
+                    case SM_XPORT_MRT:
+                        /* Init MRT channel */
+                        status = RPC_MRT_Init(
+                            g_scmiChannelConfig[scmiChannel].xportChannel,
+                            noIrq, initCount);
+                        break;
+#endif
                     default:
                         status = SM_ERR_INVALID_PARAMETERS;
                         break;
@@ -288,17 +354,7 @@ int32_t RPC_SCMI_P2aTx(uint32_t scmiChannel, uint32_t protocolId,
         s_token[scmiChannel] &= SCMI_HEADER_TOKEN_MASK;
 
         /* Send message via transport */
-        switch (g_scmiChannelConfig[scmiChannel].xportType)
-        {
-            case SM_XPORT_SMT:
-                status = RPC_SMT_Tx(
-                    g_scmiChannelConfig[scmiChannel].xportChannel, len,
-                    false, notify);
-                break;
-            default:
-                status = SM_ERR_NOT_SUPPORTED;
-                break;
-        }
+        status = RPC_SCMI_P2aXportTx(scmiChannel, len, notify);
     }
     else
     {
@@ -326,7 +382,15 @@ bool RPC_SCMI_P2aTxQFull(uint32_t agentId, uint32_t len, uint32_t queue)
 {
     bool rtn = false;
 
-    if ((len / 4U) > (SM_SCMI_MAX_NOTIFY - s_queue[agentId][queue].count))
+    /* No channel to deliver on? */
+    if (!RPC_SCMI_P2aQValid(agentId, queue))
+    {
+        rtn = true;
+    }
+
+    /* Space left after reserved delayed responses? */
+    if ((len / 4U) > (SM_SCMI_MAX_NOTIFY - s_queue[agentId][queue].count
+        - s_queue[agentId][queue].reserved))
     {
         rtn = true;
     }
@@ -366,6 +430,98 @@ void RPC_SCMI_P2aTxQ(uint32_t agentId, scmi_msg_id_t msgId, uint32_t *msg,
     }
 }
 
+/*--------------------------------------------------------------------------*/
+/* Reserve space for a delayed response                                     */
+/*--------------------------------------------------------------------------*/
+int32_t RPC_SCMI_P2aDelayedReserve(uint32_t agentId, uint32_t len)
+{
+    int32_t status = SM_ERR_SUCCESS;
+
+    /* Check agent has a notification channel */
+    if (!RPC_SCMI_P2aQValid(agentId, SCMI_NOTIFY_Q))
+    {
+        status = SM_ERR_NOT_SUPPORTED;
+    }
+
+    /* Check space in queue, including the token word */
+    if ((status == SM_ERR_SUCCESS) && RPC_SCMI_P2aTxQFull(agentId,
+        len + sizeof(uint32_t), SCMI_NOTIFY_Q))
+    {
+        status = SM_ERR_BUSY;
+    }
+
+    /* Reserve space */
+    if (status == SM_ERR_SUCCESS)
+    {
+        s_queue[agentId][SCMI_NOTIFY_Q].reserved += (len / 4U) + 1U;
+    }
+
+    /* Return status */
+    return status;
+}
+
+/*--------------------------------------------------------------------------*/
+/* Release space reserved for a delayed response                            */
+/*--------------------------------------------------------------------------*/
+void RPC_SCMI_P2aDelayedRelease(uint32_t agentId, uint32_t len)
+{
+    notify_queue_t *q = &s_queue[agentId][SCMI_NOTIFY_Q];
+    uint32_t words = (len / 4U) + 1U;
+
+    /* Queue may have been reset since the reservation */
+    q->reserved = (q->reserved > words) ? (q->reserved - words) : 0U;
+}
+
+/*--------------------------------------------------------------------------*/
+/* Queue delayed response to send on P2A channel                            */
+/*--------------------------------------------------------------------------*/
+void RPC_SCMI_P2aDelayedTxQ(uint32_t agentId, uint32_t header,
+    uint32_t *msg, uint32_t len)
+{
+    /* Check space in queue, including the token word */
+    if (!RPC_SCMI_P2aTxQFull(agentId, len + sizeof(uint32_t),
+        SCMI_NOTIFY_Q))
+    {
+        notify_queue_t *q = &s_queue[agentId][SCMI_NOTIFY_Q];
+
+        /* Generate header, length goes in token field */
+        msg[0] = SCMI_HEADER_MSG(SCMI_HEADER_MSG_EX(header))
+            | SCMI_HEADER_PROTOCOL(SCMI_HEADER_PROTOCOL_EX(header))
+            | SCMI_HEADER_TYPE(2UL)
+            | SCMI_HEADER_TOKEN(len);
+
+        /* Queue header */
+        q->data[q->head] = msg[0];
+        q->head = (q->head + 1U) % SM_SCMI_MAX_NOTIFY;
+        q->count++;
+
+        /* Queue token of the original command */
+        q->data[q->head] = SCMI_HEADER_TOKEN_EX(header);
+        q->head = (q->head + 1U) % SM_SCMI_MAX_NOTIFY;
+        q->count++;
+
+        /* Queue message data */
+        for (uint32_t idx = 1U; idx < (len / 4U); idx++)
+        {
+            q->data[q->head] = msg[idx];
+            q->head = (q->head + 1U) % SM_SCMI_MAX_NOTIFY;
+            q->count++;
+        }
+
+        /* Trigger xmit */
+        RPC_SCMI_P2aDispatch(s_agent2channel[agentId][SCMI_NOTIFY_Q]);
+    }
+}
+
+/*--------------------------------------------------------------------------*/
+/* Request deferred processing                                              */
+/*--------------------------------------------------------------------------*/
+void RPC_SCMI_DeferRequest(void)
+{
+    /* Triggered once the current response is sent */
+    s_deferPending = true;
+}
+
 /*--------------------------------------------------------------------------*/
 /* Bounded string copy                                                      */
 /*--------------------------------------------------------------------------*/
@@ -437,6 +593,133 @@ int32_t RPC_SCMI_ProtocolListGet(uint32_t skip, uint32_t numWords,
     return status;
 }
 
+/*--------------------------------------------------------------------------*/
+/* Get number of resources of a protocol                                    */
+/*--------------------------------------------------------------------------*/
+int32_t RPC_SCMI_ResourceNumGet(uint32_t protocolId, uint32_t *numResources)
+{
+    int32_t status = SM_ERR_SUCCESS;
+
+    /* Get number of resources */
+    switch (protocolId)
+    {
+        case SCMI_PROTOCOL_POWER:
+            *numResources = SM_NUM_POWER;
+            break;
+        case SCMI_PROTOCOL_PERF:
+            *numResources = SM_NUM_PERF;
+            break;
+        case SCMI_PROTOCOL_CLOCK:
+            *numResources = SM_NUM_CLOCK;
+            break;
+        case SCMI_PROTOCOL_SENSOR:
+            *numResources = SM_NUM_SENSOR;
+            break;
+        case SCMI_PROTOCOL_RESET:
+            *numResources = SM_NUM_RESET;
+            break;
+        case SCMI_PROTOCOL_VOLTAGE:
+            *numResources = SM_NUM_VOLT;
+            break;
+        case SCMI_PROTOCOL_PINCTRL:
+            *numResources = SM_NUM_PIN;
+            break;
+        default:
+            *numResources = 0U;
+            status = SM_ERR_NOT_SUPPORTED;
+            break;
+    }
+
+    /* Return status */
+    return status;
+}
+
+/*--------------------------------------------------------------------------*/
+/* Get agent permission for a resource                                      */
+/*--------------------------------------------------------------------------*/
+int32_t RPC_SCMI_ResourcePermGet(uint32_t agentId, uint32_t protocolId,
+    uint32_t resourceId, uint8_t *perm)
+{
+    int32_t status;
+    const scmi_agnt_config_t *cfg = &g_scmiAgentConfig[agentId];
+    uint32_t num;
+    const uint8_t *perms = NULL;
+
+    /* Get number of resources */
+    status = RPC_SCMI_ResourceNumGet(protocolId, &num);
+
+    /* Check resource */
+    if ((status == SM_ERR_SUCCESS) && (resourceId >= num))
+    {
+        status = SM_ERR_NOT_FOUND;
+    }
+
+    /* Get permission array */
+    if (status == SM_ERR_SUCCESS)
+    {
+        switch (protocolId)
+        {
+            case SCMI_PROTOCOL_POWER:
+                perms = cfg->pdPerms;
+                break;
+            case SCMI_PROTOCOL_PERF:
+                perms = cfg->perfPerms;
+                break;
+            case SCMI_PROTOCOL_CLOCK:
+                perms = cfg->clkPerms;
+                break;
+            case SCMI_PROTOCOL_SENSOR:
+                perms = cfg->sensorPerms;
+                break;
+            case SCMI_PROTOCOL_RESET:
+                perms = cfg->rstPerms;
+                break;
+            case SCMI_PROTOCOL_VOLTAGE:
+                perms = cfg->voltPerms;
+                break;
+            default:
+                perms = cfg->pinPerms;
+                break;
+        }
+
+        /* Return permission */
+        *perm = perms[resourceId];
+    }
+
+    /* Return status */
+    return status;
+}
+
+/*--------------------------------------------------------------------------*/
+/* Find next set bit in a bit array                                         */
+/*--------------------------------------------------------------------------*/
+uint32_t RPC_SCMI_BitArrayNext(const uint8_t *bits, uint32_t num,
+    uint32_t start)
+{
+    uint32_t idx = start;
+
+    /* Loop until a set bit or the end of the array */
+    while (idx < num)
+    {
+        /* Skip empty bytes */
+        if ((bits[idx / 8U] >> (idx % 8U)) == 0U)
+        {
+            idx = (idx + 8U) & ~7U;
+        }
+        else if (BITARRAY_GET(bits, idx) != 0U)
+        {
+            break;
+        }
+        else
+        {
+            idx++;
+        }
+    }
+
+    /* Return index, num if none found */
+    return (idx < num) ? idx : num;
+}
+
 /*--------------------------------------------------------------------------*/
 /* Reset SCMI instance                                                      */
 /*--------------------------------------------------------------------------*/
@@ -525,6 +808,16 @@ int32_t RPC_SCMI_Trigger(const lmm_rpc_trigger_t *trigger)
             msgId.messageId = RPC_SCMI_NOTIFY_MISC_CONTROL_EVENT;
             status = RPC_SCMI_MiscDispatchNotification(msgId, trigger);
             break;
+        case LMM_TRIGGER_POWER:
+            msgId.protocolId = SCMI_PROTOCOL_POWER;
+            msgId.messageId = RPC_SCMI_NOTIFY_POWER_STATE_CHANGED;
+            status = RPC_SCMI_PowerDispatchNotification(msgId, trigger);
+            break;
+        case LMM_TRIGGER_CLOCK:
+            msgId.protocolId = SCMI_PROTOCOL_CLOCK;
+            msgId.messageId = RPC_SCMI_NOTIFY_CLOCK_RATE_CHANGED;
+            status = RPC_SCMI_ClockDispatchNotification(msgId, trigger);
+            break;
         default:
             status = SM_ERR_INVALID_PARAMETERS;
             break;
@@ -534,6 +827,94 @@ int32_t RPC_SCMI_Trigger(const lmm_rpc_trigger_t *trigger)
     return status;
 }
 
+/*--------------------------------------------------------------------------*/
+/* Run deferred SCMI work                                                   */
+/*--------------------------------------------------------------------------*/
+void RPC_SCMI_DeferredDispatch(uint8_t scmiInst)
+{
+    /* Complete async power state changes */
+    RPC_SCMI_PowerDispatchDeferred(scmiInst);
+
+    /* Complete async resets */
+    RPC_SCMI_ResetDispatchDeferred(scmiInst);
+
+    /* Complete async sensor reads */
+    RPC_SCMI_SensorDispatchDeferred(scmiInst);
+}
+
+/*--------------------------------------------------------------------------*/
+/* Tick SCMI timers                                                         */
+/*--------------------------------------------------------------------------*/
+bool RPC_SCMI_Tick(uint32_t msec)
+{
+    /* Tick sensor update timers */
+    return RPC_SCMI_SensorTick(msec);
+}
+
+/*--------------------------------------------------------------------------*/
+/* Check if a resource is readable by any agent of an instance              */
+/*--------------------------------------------------------------------------*/
+bool RPC_SCMI_ResourceVisible(uint8_t scmiInst, uint32_t protocolId,
+    uint32_t resourceId)
+{
+    bool visible = false;
+    uint32_t firstAgent = g_scmiConfig[scmiInst].firstAgent;
+    uint32_t numAgents = g_scmiConfig[scmiInst].numAgents;
+
+    /* Loop over agents of the instance */
+    for (uint32_t agentId = firstAgent; agentId < (firstAgent + numAgents);
+        agentId++)
+    {
+        uint8_t perm = SM_SCMI_PERM_NONE;
+
+        /* RTC permissions are not part of the resource discovery */
+        if (protocolId == SCMI_PROTOCOL_BBM)
+        {
+            if (resourceId < SM_NUM_RTC)
+            {
+                perm = g_scmiAgentConfig[agentId].rtcPerms[resourceId];
+            }
+        }
+        else
+        {
+            /* Left as none on error */
+            (void) RPC_SCMI_ResourcePermGet(agentId, protocolId, resourceId,
+                &perm);
+        }
+
+        /* Check for read access */
+        if (perm >= SM_SCMI_PERM_GET)
+        {
+            visible = true;
+            break;
+        }
+    }
+
+    /* Return result */
+    return visible;
+}
+
+/*--------------------------------------------------------------------------*/
+/* Get SCMI agent load statistics                                           */
+/*--------------------------------------------------------------------------*/
+int32_t RPC_SCMI_AgentStatsGet(uint32_t agentId, scmi_agent_stats_t *stats)
+{
+    int32_t status = SM_ERR_SUCCESS;
+
+    /* Check agent */
+    if (agentId >= SM_SCMI_NUM_AGNT)
+    {
+        status = SM_ERR_OUT_OF_RANGE;
+    }
+    else
+    {
+        *stats = s_agentStats[agentId];
+    }
+
+    /* Return status */
+    return status;
+}
+
 /*--------------------------------------------------------------------------*/
 /* Dump collected SCMI errors                                               */
 /*--------------------------------------------------------------------------*/
@@ -562,6 +943,39 @@ void RPC_SCMI_ErrorDump(uint8_t scmiInst)
                 /* Clear log */
                 err->status = SM_ERR_SUCCESS;
             }
+
+            /* Dump SMT adaptive poll stats */
+            if (g_scmiChannelConfig[scmiChannel].xportType == SM_XPORT_SMT)
+            {
+                rpc_smt_stats_t stats;
+
+                if ((RPC_SMT_StatsGet(
+                    g_scmiChannelConfig[scmiChannel].xportChannel, &stats)
+                    == SM_ERR_SUCCESS) && ((stats.pollHit
+                    + stats.pollMiss) != 0U))
+                {
+                    printf("SMT poll (chn=%u): ", scmiChannel);
+                    printf("dispatch=%u, hit=%u, miss=%u\n", stats.dispatch,
+                        stats.pollHit, stats.pollMiss);
+                }
+            }
+        }
+    }
+
+    /* Loop over agents */
+    for (uint32_t agentId = 0U; agentId < SM_SCMI_NUM_AGNT; agentId++)
+    {
+        const scmi_agent_stats_t *stats = &s_agentStats[agentId];
+
+        /* Dump agents that hit a load quota */
+        if ((g_scmiAgentConfig[agentId].scmiInst == scmiInst)
+            && ((stats->rateBusy + stats->cpuBusy) != 0U))
+        {
+            printf("SCMI quota (agent=%u): ", agentId);
+            printf("msgs=%u, rateBusy=%u", stats->msgCount,
+                stats->rateBusy);
+            printf(", cpuBusy=%u, cpuMax=%uus\n", stats->cpuBusy,
+                stats->cpuTimeMax);
         }
     }
 #endif
@@ -583,6 +997,12 @@ static void *RPC_SCMI_HdrAddrGet(uint32_t scmiChannel)
             addr = RPC_SMT_HdrAddrGet(
                 g_scmiChannelConfig[scmiChannel].xportChannel);
             break;
+#ifdef USES_XPORT_MRT
+        case SM_XPORT_MRT:
+            addr = RPC_MRT_HdrAddrGet(
+                g_scmiChannelConfig[scmiChannel].xportChannel);
+            break;
+#endif
         default:
             ; /* Intentional empty default */
             break;
@@ -637,6 +1057,12 @@ static int32_t RPC_SCMI_IsAborted(uint32_t scmiChannel)
             status = RPC_SMT_IsAborted(
                 g_scmiChannelConfig[scmiChannel].xportChannel);
             break;
+#ifdef USES_XPORT_MRT
+        case SM_XPORT_MRT:
+            status = RPC_MRT_IsAborted(
+                g_scmiChannelConfig[scmiChannel].xportChannel);
+            break;
+#endif
         default:
             status = SM_ERR_NOT_SUPPORTED;
             break;
@@ -706,6 +1132,10 @@ static void RPC_SCMI_A2pDispatch(uint32_t scmiChannel)
         {
             caller.header = s_msgCopy.header;
 
+            /* Trace request */
+            SM_TRACE(SM_TRACE_CAT_SCMI, SM_TRACE_SCMI_REQ, caller.agentId,
+                caller.header);
+
             /* Check message type */
             if (SCMI_HEADER_TYPE_EX(caller.header) != 0U)
             {
@@ -746,19 +1176,40 @@ static void RPC_SCMI_A2pDispatch(uint32_t scmiChannel)
             s_token[scmiChannel]++;
             s_token[scmiChannel] &= SCMI_HEADER_TOKEN_MASK;
 
+            /* Check agent load quotas */
+            if (status == SM_ERR_SUCCESS)
+            {
+                status = RPC_SCMI_QuotaCheck(caller.agentId);
+            }
+
             if (status == SM_ERR_SUCCESS)
             {
+                uint64_t startTime = DEV_SM_Usec64Get();
+
                 /* Dispatch subrequest */
-                status = RPC_SCMI_A2pSubDispatch(&caller, protocolId,
+                status = RPC_SCMI_ImageDispatch(&caller, protocolId,
                     messageId);
+
+                /* Charge CPU time */
+                RPC_SCMI_QuotaCharge(caller.agentId, DEV_SM_Usec64Get()
+                    - startTime);
             }
         }
 
         /* Send response */
         if (caller.lenMsg > 0U)
         {
+            SM_TRACE(SM_TRACE_CAT_SCMI, SM_TRACE_SCMI_RSP, caller.agentId,
+                status);
             (void) RPC_SCMI_A2pTx(&caller, caller.lenMsg, status);
         }
+
+        /* Kick deferred work after the response is sent */
+        if (s_deferPending)
+        {
+            s_deferPending = false;
+            LMM_RpcDeferTrigger();
+        }
     }
 }
 
@@ -825,6 +1276,150 @@ static int32_t RPC_SCMI_A2pSubDispatch(scmi_caller_t *caller,
     return status;
 }
 
+/*--------------------------------------------------------------------------*/
+/* Dispatch SCMI A2P subrequest using response images                       */
+/*                                                                          */
+/* Version, protocol attributes, base discover and static name/attribute    */
+/* responses never change. The images are a lazy cache filled at runtime:   */
+/* the first successful response of each is saved for the instance and      */
+/* later requests copy the image into the message buffer instead of         */
+/* running the handler.                                                     */
+/*--------------------------------------------------------------------------*/
+static int32_t RPC_SCMI_ImageDispatch(scmi_caller_t *caller,
+    uint32_t protocolId, uint32_t messageId)
+{
+    int32_t status;
+    uint32_t key = 0U;
+    response_image_t *image = RPC_SCMI_ImageGet(caller, protocolId,
+        messageId, &key);
+    uint32_t *payload = (uint32_t*) &caller->msg[1];
+
+    if ((image != NULL) && (image->len != 0U) && (image->key == key))
+    {
+        uint32_t numWords = (image->len - sizeof(scmi_msg_status_t)) / 4U;
+
+        /* Copy out image */
+        for (uint32_t word = 0U; word < numWords; word++)
+        {
+            payload[word] = image->data[word];
+        }
+        caller->lenMsg = image->len;
+        s_agentStats[caller->agentId].imageHit++;
+        status = SM_ERR_SUCCESS;
+    }
+    else
+    {
+        /* Run handler */
+        status = RPC_SCMI_A2pSubDispatch(caller, protocolId, messageId);
+
+        /* Save image */
+        if ((image != NULL) && (status == SM_ERR_SUCCESS)
+            && (caller->lenMsg >= sizeof(scmi_msg_status_t))
+            && (caller->lenMsg <= (sizeof(scmi_msg_status_t)
+            + (SCMI_IMAGE_MAX_WORDS * sizeof(uint32_t)))))
+        {
+            uint32_t numWords = (caller->lenMsg - sizeof(scmi_msg_status_t))
+                / 4U;
+
+            for (uint32_t word = 0U; word < numWords; word++)
+            {
+                image->data[word] = payload[word];
+            }
+            image->len = caller->lenMsg;
+            image->key = key;
+        }
+    }
+
+    /* Return status */
+    return status;
+}
+
+/*--------------------------------------------------------------------------*/
+/* Get response image for a message                                         */
+/*                                                                          */
+/* Fixed images need no key. Keyed images are direct mapped by agent,       */
+/* message and first parameter, and hit only if the key matches. Returns    */
+/* NULL if the message has no image.                                        */
+/*--------------------------------------------------------------------------*/
+static response_image_t *RPC_SCMI_ImageGet(const scmi_caller_t *caller,
+    uint32_t protocolId, uint32_t messageId, uint32_t *key)
+{
+    response_image_t *image = NULL;
+    uint32_t idx = RPC_SCMI_ImageIdx(caller, protocolId, messageId);
+
+    if (idx < SCMI_NUM_IMAGE)
+    {
+        image = &s_image[caller->scmiInst][idx];
+    }
+    else if (!caller->extension && (caller->lenCopy
+        >= (2U * sizeof(uint32_t))))
+    {
+        uint32_t param = caller->msgCopy->payload[0];
+
+        /* Message attributes, domain attributes and agent names */
+        if ((param <= 0xFFU) && ((messageId == SCMI_IMAGE_MSG_ATTR)
+            || ((messageId == SCMI_IMAGE_DOM_ATTR)
+            && ((protocolId == SCMI_PROTOCOL_POWER)
+            || (protocolId == SCMI_PROTOCOL_RESET)))
+            || ((messageId == SCMI_IMAGE_AGENT)
+            && (protocolId == SCMI_PROTOCOL_BASE))))
+        {
+            *key = (caller->agentId << 24U) | (protocolId << 16U)
+                | (messageId << 8U) | param;
+            image = &s_imageKeyed[caller->scmiInst][(caller->agentId
+                + protocolId + messageId + param) % SCMI_IMAGE_NUM_KEYED];
+        }
+    }
+    else
+    {
+        ; /* Intentional empty else */
+    }
+
+    /* Return image */
+    return image;
+}
+
+/*--------------------------------------------------------------------------*/
+/* Get response image index for a message                                   */
+/*                                                                          */
+/* Returns SCMI_NUM_IMAGE if the message has no image.                      */
+/*--------------------------------------------------------------------------*/
+static uint32_t RPC_SCMI_ImageIdx(const scmi_caller_t *caller,
+    uint32_t protocolId, uint32_t messageId)
+{
+    uint32_t idx = SCMI_NUM_IMAGE;
+
+    /* Extension protocols are handled differently */
+    if (!caller->extension)
+    {
+        /* Protocol version or attributes */
+        if (messageId <= 1U)
+        {
+            for (uint32_t proto = 0U; proto < sizeof(s_protocolList);
+                proto++)
+            {
+                if (protocolId == (uint32_t) s_protocolList[proto])
+                {
+                    idx = (2U * proto) + messageId;
+                    break;
+                }
+            }
+        }
+
+        /* Base discover vendor, sub-vendor and implementation version */
+        if ((protocolId == SCMI_PROTOCOL_BASE)
+            && (messageId >= SCMI_IMAGE_BASE_MSG)
+            && (messageId < (SCMI_IMAGE_BASE_MSG + SCMI_IMAGE_NUM_BASE)))
+        {
+            idx = (2U * sizeof(s_protocolList)) + messageId
+                - SCMI_IMAGE_BASE_MSG;
+        }
+    }
+
+    /* Return index */
+    return idx;
+}
+
 /*--------------------------------------------------------------------------*/
 /* Dispatch SCMI P2A request                                                */
 /*--------------------------------------------------------------------------*/
@@ -863,24 +1458,101 @@ static void RPC_SCMI_P2aDispatch(uint32_t scmiChannel)
     /* All clear to send a message */
     if (status == SM_ERR_SUCCESS)
     {
-        uint32_t header = s_queue[agentId][queue].data[
-            s_queue[agentId][queue].tail];
+        uint32_t header = RPC_SCMI_P2aQPop(agentId, queue);
         uint32_t len = SCMI_HEADER_TOKEN_EX(header);
+        uint32_t token = 0U;
+
+        /* Delayed response carries the token of the command */
+        if (SCMI_HEADER_TYPE_EX(header) == 2U)
+        {
+            token = RPC_SCMI_P2aQPop(agentId, queue);
+        }
 
         /* Copy out message data */
-        for (uint32_t idx = 0U; idx < (len / 4U); idx++)
+        for (uint32_t idx = 1U; idx < (len / 4U); idx++)
         {
-            msg[idx] = s_queue[agentId][queue].data[
-                s_queue[agentId][queue].tail];
-            s_queue[agentId][queue].tail = (s_queue[agentId][queue].tail
-                + 1U) % SM_SCMI_MAX_NOTIFY;
-            s_queue[agentId][queue].count--;
+            msg[idx] = RPC_SCMI_P2aQPop(agentId, queue);
         }
 
         /* Send message */
-        (void) RPC_SCMI_P2aTx(scmiChannel, SCMI_HEADER_PROTOCOL_EX(header),
-            SCMI_HEADER_MSG_EX(header), len, &header, true);
+        if (SCMI_HEADER_TYPE_EX(header) == 2U)
+        {
+            /* Delayed response, channel token not consumed */
+            msg[0] = SCMI_HEADER_MSG(SCMI_HEADER_MSG_EX(header))
+                | SCMI_HEADER_PROTOCOL(SCMI_HEADER_PROTOCOL_EX(header))
+                | SCMI_HEADER_TYPE(2UL)
+                | SCMI_HEADER_TOKEN(token);
+            (void) RPC_SCMI_P2aXportTx(scmiChannel, len, true);
+        }
+        else
+        {
+            (void) RPC_SCMI_P2aTx(scmiChannel,
+                SCMI_HEADER_PROTOCOL_EX(header), SCMI_HEADER_MSG_EX(header),
+                len, &header, true);
+        }
+    }
+}
+
+/*--------------------------------------------------------------------------*/
+/* Check agent has a channel for a P2A queue                                */
+/*--------------------------------------------------------------------------*/
+static bool RPC_SCMI_P2aQValid(uint32_t agentId, uint32_t queue)
+{
+    uint32_t scmiChannel = s_agent2channel[agentId][queue];
+    uint8_t type = (queue == SCMI_PRIORITY_Q) ? SM_SCMI_CHN_P2A_PRIORITY
+        : SM_SCMI_CHN_P2A_NOTIFY;
+
+    /* Return result */
+    return (scmiChannel < SM_SCMI_NUM_CHN)
+        && (g_scmiChannelConfig[scmiChannel].agentId == agentId)
+        && (g_scmiChannelConfig[scmiChannel].type == type);
+}
+
+/*--------------------------------------------------------------------------*/
+/* Send P2A message via transport                                           */
+/*                                                                          */
+/* Parameters:                                                              */
+/* - scmiChannel: SCMI channel                                              */
+/* - len: Size in bytes of the payload + header                             */
+/* - compInt: True to generate a completion interrupt                       */
+/*                                                                          */
+/* Return errors:                                                           */
+/* - SM_ERR_NOT_SUPPORTED: if the configured transport is not supported     */
+/* - others returned by the transport transmit function (e.g. RPC_SMT_Tx()) */
+/*--------------------------------------------------------------------------*/
+static int32_t RPC_SCMI_P2aXportTx(uint32_t scmiChannel, uint32_t len,
+    bool compInt)
+{
+    int32_t status;
+
+    switch (g_scmiChannelConfig[scmiChannel].xportType)
+    {
+        case SM_XPORT_SMT:
+            status = RPC_SMT_Tx(
+                g_scmiChannelConfig[scmiChannel].xportChannel, len,
+                false, compInt);
+            break;
+        default:
+            status = SM_ERR_NOT_SUPPORTED;
+            break;
     }
+
+    /* Return status */
+    return status;
+}
+
+/*--------------------------------------------------------------------------*/
+/* Pop word from P2A queue                                                  */
+/*--------------------------------------------------------------------------*/
+static uint32_t RPC_SCMI_P2aQPop(uint32_t agentId, uint32_t queue)
+{
+    notify_queue_t *q = &s_queue[agentId][queue];
+    uint32_t data = q->data[q->tail];
+
+    q->tail = (q->tail + 1U) % SM_SCMI_MAX_NOTIFY;
+    q->count--;
+
+    return data;
 }
 
 /*--------------------------------------------------------------------------*/
@@ -921,6 +1593,13 @@ static int32_t RPC_SCMI_A2pRx(scmi_caller_t *caller, void* msgRx,
                 g_scmiChannelConfig[scmiChannel].xportChannel,
                 msgRx, &size, true);
             break;
+#ifdef USES_XPORT_MRT
+        case SM_XPORT_MRT:
+            status = RPC_MRT_Rx(
+                g_scmiChannelConfig[scmiChannel].xportChannel,
+                msgRx, &size);
+            break;
+#endif
         default:
             status = SM_ERR_NOT_SUPPORTED;
             break;
@@ -991,6 +1670,18 @@ static int32_t RPC_SCMI_A2pTx(const scmi_caller_t *caller, uint32_t len,
             rtn = RPC_SMT_Tx(g_scmiChannelConfig[scmiChannel].xportChannel,
                 newLen, true, true);
             break;
+#ifdef USES_XPORT_MRT
+        case SM_XPORT_MRT:
+            /* Response must fit in one register frame */
+            if (newLen > MRT_MSG_SIZE)
+            {
+                caller->msg->status = SM_ERR_PROTOCOL_ERROR;
+                newLen = sizeof(scmi_msg_status_t);
+            }
+            rtn = RPC_MRT_Tx(g_scmiChannelConfig[scmiChannel].xportChannel,
+                newLen);
+            break;
+#endif
         default:
             rtn = SM_ERR_NOT_SUPPORTED;
             break;
@@ -999,3 +1690,127 @@ static int32_t RPC_SCMI_A2pTx(const scmi_caller_t *caller, uint32_t len,
     return rtn;
 }
 
+/*--------------------------------------------------------------------------*/
+/* Reset agent load quotas                                                  */
+/*--------------------------------------------------------------------------*/
+static void RPC_SCMI_QuotaInit(uint32_t agentId)
+{
+    const scmi_agnt_config_t *cfg = &g_scmiAgentConfig[agentId];
+    agent_quota_t *quota = &s_quota[agentId];
+    uint64_t burst = (cfg->msgBurst != 0U) ? cfg->msgBurst : cfg->msgRate;
+
+    /* Start with full buckets */
+    quota->lastTime = DEV_SM_Usec64Get();
+    quota->msgTokens = burst * SCMI_QUOTA_SCALE;
+    quota->cpuCredit = ((int64_t) cfg->cpuBudget)
+        * ((int64_t) SCMI_QUOTA_SCALE);
+
+    /* Reset stats */
+    s_agentStats[agentId].msgCount = 0U;
+    s_agentStats[agentId].rateBusy = 0U;
+    s_agentStats[agentId].cpuBusy = 0U;
+    s_agentStats[agentId].imageHit = 0U;
+    s_agentStats[agentId].cpuTimeMax = 0U;
+    s_agentStats[agentId].cpuTime = 0ULL;
+}
+
+/*--------------------------------------------------------------------------*/
+/* Refill and check agent load quotas                                       */
+/*--------------------------------------------------------------------------*/
+static int32_t RPC_SCMI_QuotaCheck(uint32_t agentId)
+{
+    int32_t status = SM_ERR_SUCCESS;
+    const scmi_agnt_config_t *cfg = &g_scmiAgentConfig[agentId];
+
+    /* Any quota configured? */
+    if ((cfg->msgRate != 0U) || (cfg->cpuBudget != 0U))
+    {
+        agent_quota_t *quota = &s_quota[agentId];
+        uint64_t now = DEV_SM_Usec64Get();
+        uint64_t elapsed = now - quota->lastTime;
+
+        /* Limit elapsed time to avoid overflow */
+        if (elapsed > UINT32_MAX)
+        {
+            elapsed = UINT32_MAX;
+        }
+        quota->lastTime = now;
+
+        /* Check CPU time budget */
+        if (cfg->cpuBudget != 0U)
+        {
+            int64_t maxCredit = ((int64_t) cfg->cpuBudget)
+                * ((int64_t) SCMI_QUOTA_SCALE);
+
+            /* Refill credit */
+            quota->cpuCredit += (int64_t) (elapsed * cfg->cpuBudget);
+            if (quota->cpuCredit > maxCredit)
+            {
+                quota->cpuCredit = maxCredit;
+            }
+
+            /* Budget exhausted? */
+            if (quota->cpuCredit <= 0)
+            {
+                s_agentStats[agentId].cpuBusy++;
+                status = SM_ERR_BUSY;
+            }
+        }
+
+        /* Check message rate */
+        if (cfg->msgRate != 0U)
+        {
+            uint64_t burst = (cfg->msgBurst != 0U) ? cfg->msgBurst
+                : cfg->msgRate;
+            uint64_t maxTokens = burst * SCMI_QUOTA_SCALE;
+
+            /* Refill bucket */
+            quota->msgTokens += elapsed * cfg->msgRate;
+            if (quota->msgTokens > maxTokens)
+            {
+                quota->msgTokens = maxTokens;
+            }
+
+            /* Take a token */
+            if (status == SM_ERR_SUCCESS)
+            {
+                if (quota->msgTokens < SCMI_QUOTA_SCALE)
+                {
+                    s_agentStats[agentId].rateBusy++;
+                    status = SM_ERR_BUSY;
+                }
+                else
+                {
+                    quota->msgTokens -= SCMI_QUOTA_SCALE;
+                }
+            }
+        }
+    }
+
+    /* Return status */
+    return status;
+}
+
+/*--------------------------------------------------------------------------*/
+/* Charge CPU time to agent                                                 */
+/*--------------------------------------------------------------------------*/
+static void RPC_SCMI_QuotaCharge(uint32_t agentId, uint64_t cpuTime)
+{
+    scmi_agent_stats_t *stats = &s_agentStats[agentId];
+
+    /* Update stats */
+    stats->msgCount++;
+    stats->cpuTime += cpuTime;
+    if (cpuTime > stats->cpuTimeMax)
+    {
+        stats->cpuTimeMax = (uint32_t) cpuTime;
+    }
+
+    /* Deduct from budget */
+    if (g_scmiAgentConfig[agentId].cpuBudget != 0U)
+    {
+        s_quota[agentId].cpuCredit -= ((int64_t) cpuTime)
+            * ((int64_t) SCMI_QUOTA_SCALE);
+    }
+}
+
@@ -133,6 +133,17 @@ typedef struct
     uint32_t messageId;   /*!< Message ID */
 } scmi_msg_id_t;
 
+/*! SCMI agent load statistics */
+typedef struct
+{
+    uint32_t msgCount;    /*!< Messages dispatched */
+    uint32_t rateBusy;    /*!< Messages rejected by the rate limit */
+    uint32_t cpuBusy;     /*!< Messages rejected by the CPU budget */
+    uint32_t imageHit;    /*!< Messages served from response images */
+    uint32_t cpuTimeMax;  /*!< Max dispatch time in uS */
+    uint64_t cpuTime;     /*!< Total dispatch time in uS */
+} scmi_agent_stats_t;
+
 /*!
  * SCMI caller structure
  *
@@ -279,6 +290,66 @@ int32_t RPC_SCMI_Reset(uint8_t scmiInst);
  */
 int32_t RPC_SCMI_Trigger(const lmm_rpc_trigger_t *trigger);
 
+/*!
+ * Run deferred SCMI work.
+ *
+ * @param[in]     scmiInst  SCMI instance
+ *
+ * This function completes asynchronous commands queued by agents of the
+ * SCMI instance and sends the delayed responses. Only called from
+ * LMM_Handler() in the deferred (SWI) context.
+ */
+void RPC_SCMI_DeferredDispatch(uint8_t scmiInst);
+
+/*!
+ * Tick SCMI timers.
+ *
+ * @param[in]     msec      Time elapsed since last tick
+ *
+ * This function advances the SCMI protocol timers (e.g. sensor update
+ * intervals). Only called from LMM_Tick() in the timer interrupt context.
+ * Work that is due is done later by RPC_SCMI_DeferredDispatch().
+ *
+ * @return Returns true if deferred work is due.
+ */
+bool RPC_SCMI_Tick(uint32_t msec);
+
+/*!
+ * Check if a resource is readable by an SCMI instance.
+ *
+ * @param[in]     scmiInst    SCMI instance
+ * @param[in]     protocolId  Protocol of the resource
+ * @param[in]     resourceId  Resource ID
+ *
+ * This function checks if any agent of the SCMI instance has at least GET
+ * permission for the resource. Used to limit the state an LM can see
+ * outside of SCMI (e.g. the shared state table). For the BBM protocol the
+ * resource is an RTC.
+ *
+ * @return Returns true if the resource is visible.
+ */
+bool RPC_SCMI_ResourceVisible(uint8_t scmiInst, uint32_t protocolId,
+    uint32_t resourceId);
+
+/*!
+ * Get SCMI agent load statistics.
+ *
+ * @param[in]     agentId  SCMI agent
+ * @param[out]    stats    Return pointer to the statistics
+ *
+ * This function returns the message count, the number of messages
+ * rejected by the rate limit or CPU budget, the number served from
+ * response images, and the CPU time spent dispatching messages for
+ * \a agentId.
+ *
+ * @return Returns the status (::SM_ERR_SUCCESS = success).
+ *
+ * Return errors (see @ref STATUS "SM error codes"):
+ * - ::SM_ERR_SUCCESS: if the stats were returned.
+ * - ::SM_ERR_OUT_OF_RANGE: if \a agentId is invalid.
+ */
+int32_t RPC_SCMI_AgentStatsGet(uint32_t agentId, scmi_agent_stats_t *stats);
+
 /*!
  * Dump collected SCMI errors.
  *
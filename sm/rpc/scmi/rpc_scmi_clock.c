@@ -56,19 +56,24 @@
 #define COMMAND_CLOCK_RATE_SET               0x5U
 #define COMMAND_CLOCK_RATE_GET               0x6U
 #define COMMAND_CLOCK_CONFIG_SET             0x7U
+#define COMMAND_CLOCK_RATE_NOTIFY            0x9U
+#define COMMAND_CLOCK_RATE_CHANGE_REQUESTED_NOTIFY  0xAU
 #define COMMAND_CLOCK_CONFIG_GET             0xBU
 #define COMMAND_CLOCK_POSSIBLE_PARENTS_GET   0xCU
 #define COMMAND_CLOCK_PARENT_SET             0xDU
 #define COMMAND_CLOCK_PARENT_GET             0xEU
 #define COMMAND_CLOCK_GET_PERMISSIONS        0xFU
 #define COMMAND_NEGOTIATE_PROTOCOL_VERSION   0x10U
-#define COMMAND_SUPPORTED_MASK               0x1F8FFULL
+#define COMMAND_SUPPORTED_MASK               0x1FEFFULL
 
 /* SCMI max clock argument lengths */
 #define CLOCK_MAX_NAME     16U
 #define CLOCK_MAX_RATES    SCMI_ARRAY(8U, clock_rate_t)
 #define CLOCK_MAX_PARENTS  SCMI_ARRAY(8U, uint32_t)
 
+/* Longest discrete rate list returned, agents (e.g. Linux) reject more */
+#define CLOCK_MAX_DISCRETE  16U
+
 /* SCMI clock round options */
 #define CLOCK_ROUND_DOWN  0U
 #define CLOCK_ROUND_UP    1U
@@ -130,6 +135,9 @@
 #define CLOCK_PERM_PARENT(x)  (((x) & 0x1U) << 30U)
 #define CLOCK_PERM_RATE(x)    (((x) & 0x1U) << 29U)
 
+/* SCMI clock notification flags */
+#define CLOCK_NOTIFY_ENABLE(x)  (((x) & 0x1U) >> 0U)
+
 /* Local types */
 
 /* SCMI clock rate */
@@ -275,6 +283,28 @@ typedef struct
     uint32_t extendedConfigVal;
 } msg_rclock7_t;
 
+/* Request type for ClockRateNotify() */
+typedef struct
+{
+    /* Header word */
+    uint32_t header;
+    /* Identifier for the clock device */
+    uint32_t clockId;
+    /* Notify enable */
+    uint32_t notifyEnable;
+} msg_rclock9_t;
+
+/* Request type for ClockRateChangeRequestedNotify() */
+typedef struct
+{
+    /* Header word */
+    uint32_t header;
+    /* Identifier for the clock device */
+    uint32_t clockId;
+    /* Notify enable */
+    uint32_t notifyEnable;
+} msg_rclock10_t;
+
 /* Request type for ClockConfigGet() */
 typedef struct
 {
@@ -385,6 +415,19 @@ typedef struct
     uint32_t version;
 } msg_rclock16_t;
 
+/* Request type for ClockRateChanged() */
+typedef struct
+{
+    /* Header word */
+    uint32_t header;
+    /* Identifier for the agent that caused the rate change */
+    uint32_t agentId;
+    /* Identifier for the clock device */
+    uint32_t clockId;
+    /* Clock rate */
+    clock_rate_t rate;
+} msg_rclock64_t;
+
 /* Local functions */
 
 static int32_t ClockProtocolVersion(const scmi_caller_t *caller,
@@ -403,6 +446,10 @@ static int32_t ClockRateGet(const scmi_caller_t *caller,
     const msg_rclock6_t *in, msg_tclock6_t *out);
 static int32_t ClockConfigSet(const scmi_caller_t *caller,
     const msg_rclock7_t *in, const scmi_msg_status_t *out);
+static int32_t ClockRateNotify(const scmi_caller_t *caller,
+    const msg_rclock9_t *in, const scmi_msg_status_t *out);
+static int32_t ClockRateChangeRequestedNotify(const scmi_caller_t *caller,
+    const msg_rclock10_t *in, const scmi_msg_status_t *out);
 static int32_t ClockConfigGet(const scmi_caller_t *caller,
     const msg_rclock11_t *in, msg_tclock11_t *out);
 static int32_t ClockPossibleParentsGet(const scmi_caller_t *caller,
@@ -415,6 +462,8 @@ static int32_t ClockGetPermissions(const scmi_caller_t *caller,
     const msg_rclock15_t *in, msg_tclock15_t *out);
 static int32_t ClockNegotiateProtocolVersion(const scmi_caller_t *caller,
     const msg_rclock16_t *in, const scmi_msg_status_t *out);
+static int32_t ClockRateChanged(scmi_msg_id_t msgId,
+    const lmm_rpc_trigger_t *trigger);
 static int32_t ClockResetAgentConfig(uint32_t lmId, uint32_t agentId,
     bool permissionsReset);
 
@@ -476,6 +525,16 @@ int32_t RPC_SCMI_ClockDispatchCommand(scmi_caller_t *caller,
             status = ClockConfigSet(caller, (const msg_rclock7_t*) in,
                 (const scmi_msg_status_t*) out);
             break;
+        case COMMAND_CLOCK_RATE_NOTIFY:
+            lenOut = sizeof(const scmi_msg_status_t);
+            status = ClockRateNotify(caller, (const msg_rclock9_t*) in,
+                (const scmi_msg_status_t*) out);
+            break;
+        case COMMAND_CLOCK_RATE_CHANGE_REQUESTED_NOTIFY:
+            lenOut = sizeof(const scmi_msg_status_t);
+            status = ClockRateChangeRequestedNotify(caller,
+                (const msg_rclock10_t*) in, (const scmi_msg_status_t*) out);
+            break;
         case COMMAND_CLOCK_CONFIG_GET:
             lenOut = sizeof(msg_tclock11_t);
             status = ClockConfigGet(caller, (const msg_rclock11_t*) in,
@@ -518,6 +577,33 @@ int32_t RPC_SCMI_ClockDispatchCommand(scmi_caller_t *caller,
     return status;
 }
 
+/*--------------------------------------------------------------------------*/
+/* Dispatch SCMI notification                                               */
+/*                                                                          */
+/* Parameters:                                                              */
+/* - msgId: Message ID to dispatch                                          */
+/* - trigger: Notification trigger                                          */
+/*--------------------------------------------------------------------------*/
+int32_t RPC_SCMI_ClockDispatchNotification(scmi_msg_id_t msgId,
+    const lmm_rpc_trigger_t *trigger)
+{
+    int32_t status = SM_ERR_SUCCESS;
+
+    /* Handle notifications */
+    switch (msgId.messageId)
+    {
+        case RPC_SCMI_NOTIFY_CLOCK_RATE_CHANGED:
+            status = ClockRateChanged(msgId, trigger);
+            break;
+        default:
+            status = SM_ERR_NOT_SUPPORTED;
+            break;
+    }
+
+    /* Return status */
+    return status;
+}
+
 /*--------------------------------------------------------------------------*/
 /* Dispatch SCMI reset                                                      */
 /*                                                                          */
@@ -532,6 +618,77 @@ int32_t RPC_SCMI_ClockDispatchReset(uint32_t lmId, uint32_t agentId,
     return ClockResetAgentConfig(lmId, agentId, permissionsReset);
 }
 
+/*--------------------------------------------------------------------------*/
+/* Get clock attributes                                                     */
+/*                                                                          */
+/* Parameters:                                                              */
+/* - caller: Caller info                                                    */
+/* - clockId: Identifier for the clock device                               */
+/* - attributes: Pointer to return the clock attributes                     */
+/*--------------------------------------------------------------------------*/
+int32_t RPC_SCMI_ClockAttributesGet(const scmi_caller_t *caller,
+    uint32_t clockId, uint32_t *attributes)
+{
+    int32_t status = SM_ERR_SUCCESS;
+    bool enabled;
+
+    /* Check clock */
+    if (clockId >= SM_NUM_CLOCK)
+    {
+        status = SM_ERR_NOT_FOUND;
+    }
+
+    /* Get clock enable status */
+    if (status == SM_ERR_SUCCESS)
+    {
+        status = LMM_ClockIsEnabled(caller->lmId, clockId, &enabled);
+    }
+
+    /* Return attributes */
+    if (status == SM_ERR_SUCCESS)
+    {
+        uint8_t perm = g_scmiAgentConfig[caller->agentId].clkPerms[clockId];
+        uint32_t mux;
+        uint32_t numMuxes;
+
+        /* Default to no notifications */
+        *attributes
+            = CLOCK_ATTR_CHANGE(0UL)
+            | CLOCK_ATTR_CHANGE_REQ(0UL)
+            | CLOCK_ATTR_EXT_NAME(0UL)
+            | CLOCK_ATTR_EXT_CONFIG(0UL);
+
+        /* Parents? */
+        if (LMM_ClockMuxGet(caller->lmId, clockId, 0U, &mux,
+            &numMuxes) == SM_ERR_SUCCESS)
+        {
+            *attributes |= CLOCK_ATTR_PARENT(1UL);
+        }
+
+        /* Notifications? */
+        if (perm >= SM_SCMI_PERM_NOTIFY)
+        {
+            *attributes |= CLOCK_ATTR_CHANGE(1UL)
+                | CLOCK_ATTR_CHANGE_REQ(1UL);
+        }
+
+        /* Restricted? */
+        if (perm < SM_SCMI_PERM_EXCLUSIVE)
+        {
+            *attributes |= CLOCK_ATTR_RESTRICTED(1UL);
+        }
+
+        /* Return enable status */
+        if (enabled)
+        {
+            *attributes |= CLOCK_ATTR_ENABLED(1UL);
+        }
+    }
+
+    /* Return status */
+    return status;
+}
+
 /*==========================================================================*/
 /* Custom Protocol Implementation                                           */
 /*==========================================================================*/
@@ -540,11 +697,17 @@ int32_t RPC_SCMI_ClockDispatchReset(uint32_t lmId, uint32_t agentId,
 
 static uint8_t s_clockAgent[SM_NUM_CLOCK];
 static uint32_t s_clockState[SM_NUM_CLOCK];
+static BITARRAY_DEC(s_clockOwned[SM_SCMI_NUM_AGNT], SM_NUM_CLOCK);
+static BITARRAY_DEC(s_clockNotify[SM_SCMI_NUM_AGNT], SM_NUM_CLOCK);
+static BITARRAY_DEC(s_clockReqNotify[SM_SCMI_NUM_AGNT], SM_NUM_CLOCK);
+static const scmi_caller_t *s_rateCaller = NULL;
 
 /* Local functions */
 
 static int32_t ClockConfigUpdate(uint32_t lmId, uint32_t agentId,
     uint32_t clockId, bool enable);
+static void ClockRateChangeRequested(const scmi_caller_t *caller,
+    uint32_t clockId, const clock_rate_t *rate);
 
 /*--------------------------------------------------------------------------*/
 /* Get protocol version                                                     */
@@ -751,7 +914,6 @@ static int32_t ClockAttributes(const scmi_caller_t *caller,
 {
     int32_t status = SM_ERR_SUCCESS;
     const uint8_t *nameAddr = (const uint8_t*) "";
-    bool enabled;
 
     /* Check request length */
     if (caller->lenCopy < sizeof(*in))
@@ -759,16 +921,11 @@ static int32_t ClockAttributes(const scmi_caller_t *caller,
         status = SM_ERR_PROTOCOL_ERROR;
     }
 
-    /* Check clock */
-    if ((status == SM_ERR_SUCCESS) && (in->clockId >= SM_NUM_CLOCK))
-    {
-        status = SM_ERR_NOT_FOUND;
-    }
-
-    /* Get clock enable status */
+    /* Get the clock attributes */
     if (status == SM_ERR_SUCCESS)
     {
-        status = LMM_ClockIsEnabled(caller->lmId, in->clockId, &enabled);
+        status = RPC_SCMI_ClockAttributesGet(caller, in->clockId,
+            &out->attributes);
     }
 
     /* Get the clock name */
@@ -781,36 +938,6 @@ static int32_t ClockAttributes(const scmi_caller_t *caller,
     /* Return results */
     if (status == SM_ERR_SUCCESS)
     {
-        uint32_t mux;
-        uint32_t numMuxes;
-
-        /* No notifications */
-        out->attributes
-            = CLOCK_ATTR_CHANGE(0UL)
-            | CLOCK_ATTR_CHANGE_REQ(0UL)
-            | CLOCK_ATTR_EXT_NAME(0UL)
-            | CLOCK_ATTR_EXT_CONFIG(0UL);
-
-        /* Parents? */
-        if (LMM_ClockMuxGet(caller->lmId, in->clockId, 0U, &mux,
-            &numMuxes) == SM_ERR_SUCCESS)
-        {
-            out->attributes |= CLOCK_ATTR_PARENT(1UL);
-        }
-
-        /* Restricted? */
-        if ((g_scmiAgentConfig[caller->agentId].clkPerms[in->clockId]
-            < SM_SCMI_PERM_EXCLUSIVE))
-        {
-            out->attributes |= CLOCK_ATTR_RESTRICTED(1UL);
-        }
-
-        /* Return enable status */
-        if (enabled)
-        {
-            out->attributes |= CLOCK_ATTR_ENABLED(1UL);
-        }
-
         /* Copy out name */
         RPC_SCMI_StrCpy(out->name, nameAddr, CLOCK_MAX_NAME);
     }
@@ -857,6 +984,13 @@ static int32_t ClockAttributes(const scmi_caller_t *caller,
 /*                                                                          */
 /* Process the CLOCK_DESCRIBE_RATES message. Platform handler for           */
 /* SCMI_ClockDescribeRates(). See section 4.6.2.6 in the SCMI spec.         */
+/* Clocks with a short discrete set of rates (up to 16, e.g. CCM roots      */
+/* with few dividers in range) return them in ascending order, paged by     */
+/* rateIndex. Others return a single range. Agents such as Linux accept at  */
+/* most 16 discrete rates, so MX95 roots walking all dividers return the    */
+/* range. The range ends are then snapped to the lowest and highest         */
+/* reachable rates, and agents use the CLOCK_RATE_SET round flags to pick   */
+/* a rate between them.                                                     */
 /*                                                                          */
 /*  Access macros:                                                          */
 /* - CLOCK_NUM_RATE_FLAGS_REMAING_RATES() - Number of remaining rates       */
@@ -876,6 +1010,11 @@ static int32_t ClockDescribeRates(const scmi_caller_t *caller,
 {
     int32_t status = SM_ERR_SUCCESS;
     dev_sm_clock_range_t range = {0ULL, 0ULL, 0ULL};
+    uint64_t rates[CLOCK_MAX_RATES];
+    uint32_t numRates = CLOCK_MAX_RATES;
+    uint32_t remaining = 0U;
+    bool discrete = false;
+    bool snap = false;
 
     /* Check request length */
     if (caller->lenCopy < sizeof(*in))
@@ -889,20 +1028,75 @@ static int32_t ClockDescribeRates(const scmi_caller_t *caller,
         status = SM_ERR_NOT_FOUND;
     }
 
+    /* Get discrete rates */
+    if (status == SM_ERR_SUCCESS)
+    {
+        status = LMM_ClockRatesGet(caller->lmId, in->clockId,
+            in->rateIndex, rates, &numRates, &remaining);
+
+        /* Fall back to range if no list or list too long */
+        if (status == SM_ERR_NOT_SUPPORTED)
+        {
+            status = SM_ERR_SUCCESS;
+        }
+        else if ((status == SM_ERR_SUCCESS) && ((in->rateIndex + numRates
+            + remaining) > CLOCK_MAX_DISCRETE))
+        {
+            /* Range ends can still be snapped to reachable rates */
+            snap = true;
+        }
+        else
+        {
+            discrete = true;
+        }
+    }
+
     /* Only support return of one range */
-    if ((status == SM_ERR_SUCCESS) && (in->rateIndex != 0U))
+    if ((status == SM_ERR_SUCCESS) && !discrete && (in->rateIndex != 0U))
     {
         status = SM_ERR_OUT_OF_RANGE;
     }
 
     /* Get clock range */
-    if (status == SM_ERR_SUCCESS)
+    if ((status == SM_ERR_SUCCESS) && !discrete)
     {
         status = LMM_ClockDescribe(caller->lmId, in->clockId, &range);
     }
 
+    /* Snap range to lowest and highest reachable rates */
+    if ((status == SM_ERR_SUCCESS) && snap)
+    {
+        uint64_t highRate = 0ULL;
+        uint32_t numHigh = 1U;
+        uint32_t remHigh = 0U;
+
+        range.lowestRate = rates[0];
+        if (LMM_ClockRatesGet(caller->lmId, in->clockId, numRates
+            + remaining - 1U, &highRate, &numHigh, &remHigh)
+            == SM_ERR_SUCCESS)
+        {
+            range.highestRate = highRate;
+        }
+    }
+
     /* Return results */
-    if (status == SM_ERR_SUCCESS)
+    if ((status == SM_ERR_SUCCESS) && discrete)
+    {
+        out->numRatesFlags
+            = CLOCK_NUM_RATE_FLAGS_REMAING_RATES(remaining)
+            | CLOCK_NUM_RATE_FLAGS_NUM_RATES(numRates)
+            | CLOCK_NUM_RATE_FLAGS_FORMAT(0UL);
+
+        for (uint32_t idx = 0U; idx < numRates; idx++)
+        {
+            out->rates[idx].upper = SM_UINT64_H(rates[idx]);
+            out->rates[idx].lower = SM_UINT64_L(rates[idx]);
+        }
+
+        /* Update length */
+        *len = (3U * sizeof(uint32_t)) + (numRates * sizeof(clock_rate_t));
+    }
+    else if (status == SM_ERR_SUCCESS)
     {
         out->numRatesFlags
             = CLOCK_NUM_RATE_FLAGS_REMAING_RATES(0UL)
@@ -919,6 +1113,10 @@ static int32_t ClockDescribeRates(const scmi_caller_t *caller,
         /* Update length */
         *len = (3U * sizeof(uint32_t)) + (3U * sizeof(clock_rate_t));
     }
+    else
+    {
+        ; /* Intentional empty else */
+    }
 
     /* Return status */
     return status;
@@ -1030,12 +1228,18 @@ static int32_t ClockRateSet(const scmi_caller_t *caller,
         uint64_t lmRate = (((uint64_t) in->rate.upper) << 32U)
             | (uint64_t) in->rate.lower;
 
+        /* Notify agents of request */
+        ClockRateChangeRequested(caller, in->clockId, &in->rate);
+
         /* Mark owning agent */
         s_clockAgent[in->clockId] = ((uint8_t) caller->agentId) + 1U;
+        BITARRAY_SET(s_clockOwned[caller->agentId], in->clockId);
 
-        /* Set rate */
+        /* Set rate, report caller in change notifications */
+        s_rateCaller = caller;
         status = LMM_ClockRateSet(caller->lmId, in->clockId, lmRate,
             roundSel);
+        s_rateCaller = NULL;
     }
 
     /* Return status */
@@ -1216,6 +1420,146 @@ static int32_t ClockConfigSet(const scmi_caller_t *caller,
     return status;
 }
 
+/*--------------------------------------------------------------------------*/
+/* Configure clock rate change notification                                 */
+/*                                                                          */
+/* Parameters:                                                              */
+/* - caller: Caller info                                                    */
+/* - in->clockId: Identifier for the clock device                           */
+/* - in->notifyEnable: Notify enable:                                       */
+/*   Bits[31:1] Reserved, must be zero.                                     */
+/*   Bit[0] Notify enable.                                                  */
+/*   Set to 1 to send CLOCK_RATE_CHANGED notifications.                     */
+/*   Set to 0 to disable notifications                                      */
+/*                                                                          */
+/* Process the CLOCK_RATE_NOTIFY message. Platform handler for              */
+/* SCMI_ClockRateNotify(). Requires access greater than or equal to         */
+/* NOTIFY. See section 4.6.2.12 in the SCMI spec.                           */
+/*                                                                          */
+/*  Access macros:                                                          */
+/* - CLOCK_NOTIFY_ENABLE() - Notify enable                                  */
+/*                                                                          */
+/* Return errors:                                                           */
+/* - SM_ERR_SUCCESS: if the notification state was successfully updated.   */
+/* - SM_ERR_NOT_FOUND: if the clock identified by clockId does not          */
+/*   exist.                                                                 */
+/* - SM_ERR_DENIED: if the calling agent is not permitted to request this   */
+/*   notification.                                                          */
+/* - SM_ERR_PROTOCOL_ERROR: if the incoming payload is too small.           */
+/*--------------------------------------------------------------------------*/
+static int32_t ClockRateNotify(const scmi_caller_t *caller,
+    const msg_rclock9_t *in, const scmi_msg_status_t *out)
+{
+    int32_t status = SM_ERR_SUCCESS;
+    bool enable = CLOCK_NOTIFY_ENABLE(in->notifyEnable) != 0U;
+
+    /* Check request length */
+    if (caller->lenCopy < sizeof(*in))
+    {
+        status = SM_ERR_PROTOCOL_ERROR;
+    }
+
+    /* Check clock */
+    if ((status == SM_ERR_SUCCESS) && (in->clockId >= SM_NUM_CLOCK))
+    {
+        status = SM_ERR_NOT_FOUND;
+    }
+
+    /* Check permissions */
+    if ((status == SM_ERR_SUCCESS)
+        && (g_scmiAgentConfig[caller->agentId].clkPerms[in->clockId]
+        < SM_SCMI_PERM_NOTIFY))
+    {
+        status = SM_ERR_DENIED;
+    }
+
+    /* Record notification enable */
+    if (status == SM_ERR_SUCCESS)
+    {
+        if (enable)
+        {
+            BITARRAY_SET(s_clockNotify[caller->agentId], in->clockId);
+        }
+        else
+        {
+            BITARRAY_CLR(s_clockNotify[caller->agentId], in->clockId);
+        }
+    }
+
+    /* Return status */
+    return status;
+}
+
+/*--------------------------------------------------------------------------*/
+/* Configure clock rate change requested notification                       */
+/*                                                                          */
+/* Parameters:                                                              */
+/* - caller: Caller info                                                    */
+/* - in->clockId: Identifier for the clock device                           */
+/* - in->notifyEnable: Notify enable:                                       */
+/*   Bits[31:1] Reserved, must be zero.                                     */
+/*   Bit[0] Notify enable.                                                  */
+/*   Set to 1 to send CLOCK_RATE_CHANGE_REQUESTED notifications.            */
+/*   Set to 0 to disable notifications                                      */
+/*                                                                          */
+/* Process the CLOCK_RATE_CHANGE_REQUESTED_NOTIFY message. Platform         */
+/* handler for SCMI_ClockRateChangeRequestedNotify(). Requires access       */
+/* greater than or equal to NOTIFY. See section 4.6.2.13 in the SCMI spec.  */
+/*                                                                          */
+/*  Access macros:                                                          */
+/* - CLOCK_NOTIFY_ENABLE() - Notify enable                                  */
+/*                                                                          */
+/* Return errors:                                                           */
+/* - SM_ERR_SUCCESS: if the notification state was successfully updated.   */
+/* - SM_ERR_NOT_FOUND: if the clock identified by clockId does not          */
+/*   exist.                                                                 */
+/* - SM_ERR_DENIED: if the calling agent is not permitted to request this   */
+/*   notification.                                                          */
+/* - SM_ERR_PROTOCOL_ERROR: if the incoming payload is too small.           */
+/*--------------------------------------------------------------------------*/
+static int32_t ClockRateChangeRequestedNotify(const scmi_caller_t *caller,
+    const msg_rclock10_t *in, const scmi_msg_status_t *out)
+{
+    int32_t status = SM_ERR_SUCCESS;
+    bool enable = CLOCK_NOTIFY_ENABLE(in->notifyEnable) != 0U;
+
+    /* Check request length */
+    if (caller->lenCopy < sizeof(*in))
+    {
+        status = SM_ERR_PROTOCOL_ERROR;
+    }
+
+    /* Check clock */
+    if ((status == SM_ERR_SUCCESS) && (in->clockId >= SM_NUM_CLOCK))
+    {
+        status = SM_ERR_NOT_FOUND;
+    }
+
+    /* Check permissions */
+    if ((status == SM_ERR_SUCCESS)
+        && (g_scmiAgentConfig[caller->agentId].clkPerms[in->clockId]
+        < SM_SCMI_PERM_NOTIFY))
+    {
+        status = SM_ERR_DENIED;
+    }
+
+    /* Record notification enable */
+    if (status == SM_ERR_SUCCESS)
+    {
+        if (enable)
+        {
+            BITARRAY_SET(s_clockReqNotify[caller->agentId], in->clockId);
+        }
+        else
+        {
+            BITARRAY_CLR(s_clockReqNotify[caller->agentId], in->clockId);
+        }
+    }
+
+    /* Return status */
+    return status;
+}
+
 /*--------------------------------------------------------------------------*/
 /* Get clock configuration                                                  */
 /*                                                                          */
@@ -1475,10 +1819,13 @@ static int32_t ClockParentSet(const scmi_caller_t *caller,
     {
         /* Mark owning agent */
         s_clockAgent[in->clockId] = ((uint8_t) caller->agentId) + 1U;
+        BITARRAY_SET(s_clockOwned[caller->agentId], in->clockId);
 
-        /* Set parent */
+        /* Set parent, report caller in change notifications */
+        s_rateCaller = caller;
         status = LMM_ClockParentSet(caller->lmId, in->clockId,
             in->parentId);
+        s_rateCaller = NULL;
     }
 
     /* Return status */
@@ -1663,6 +2010,110 @@ static int32_t ClockNegotiateProtocolVersion(const scmi_caller_t *caller,
     return status;
 }
 
+/*--------------------------------------------------------------------------*/
+/* Send clock rate changed notification                                     */
+/*                                                                          */
+/* Parameters:                                                              */
+/* - msgId: Message ID                                                      */
+/* - trigger: Notification trigger:                                         */
+/*   parm[0]: Clock                                                         */
+/*   parm[1]: Lower 32 bits of the new rate                                 */
+/*   parm[2]: Upper 32 bits of the new rate                                 */
+/*                                                                          */
+/* The agent ID is the requesting agent for agents of the same instance     */
+/* and 0 (platform) for changes not caused by an agent of the instance.     */
+/*--------------------------------------------------------------------------*/
+static int32_t ClockRateChanged(scmi_msg_id_t msgId,
+    const lmm_rpc_trigger_t *trigger)
+{
+    int32_t status = SM_ERR_SUCCESS;
+    uint32_t clockId = trigger->parm[0];
+    uint32_t agentId = 0U;
+
+    /* Requested by an agent of this instance? */
+    if ((s_rateCaller != NULL)
+        && (s_rateCaller->scmiInst == trigger->rpcInst))
+    {
+        agentId = s_rateCaller->instAgentId;
+    }
+
+    /* Check clock */
+    if (clockId < SM_NUM_CLOCK)
+    {
+        /* Loop over all agents */
+        for (uint32_t dstAgent = 0U; dstAgent < SM_SCMI_NUM_AGNT;
+            dstAgent++)
+        {
+            bool enable = BITARRAY_GET(s_clockNotify[dstAgent], clockId)
+                != 0U;
+
+            /* Agent belong to instance? */
+            if ((g_scmiAgentConfig[dstAgent].scmiInst == trigger->rpcInst)
+                && enable)
+            {
+                msg_rclock64_t out;
+
+                /* Fill in data */
+                out.agentId = agentId;
+                out.clockId = clockId;
+                out.rate.lower = trigger->parm[1];
+                out.rate.upper = trigger->parm[2];
+
+                /* Queue notification */
+                RPC_SCMI_P2aTxQ(dstAgent, msgId, (uint32_t*) &out,
+                    sizeof(out), SCMI_NOTIFY_Q);
+            }
+        }
+    }
+
+    /* Return status */
+    return status;
+}
+
+/*--------------------------------------------------------------------------*/
+/* Send clock rate change requested notification                            */
+/*                                                                          */
+/* Parameters:                                                              */
+/* - caller: Caller info of the agent requesting the change                 */
+/* - clockId: Clock                                                         */
+/* - rate: Requested clock rate                                             */
+/*                                                                          */
+/* Notifies subscribed agents of the same instance before the rate is       */
+/* applied.                                                                 */
+/*--------------------------------------------------------------------------*/
+static void ClockRateChangeRequested(const scmi_caller_t *caller,
+    uint32_t clockId, const clock_rate_t *rate)
+{
+    uint32_t scmiInst = caller->scmiInst;
+    scmi_msg_id_t msgId =
+    {
+        .protocolId = SCMI_PROTOCOL_CLOCK,
+        .messageId = RPC_SCMI_NOTIFY_CLOCK_RATE_CHANGE_REQUESTED
+    };
+
+    /* Loop over all agents */
+    for (uint32_t dstAgent = 0U; dstAgent < SM_SCMI_NUM_AGNT; dstAgent++)
+    {
+        bool enable = BITARRAY_GET(s_clockReqNotify[dstAgent], clockId)
+            != 0U;
+
+        /* Agent belong to instance? */
+        if ((g_scmiAgentConfig[dstAgent].scmiInst == scmiInst) && enable)
+        {
+            msg_rclock64_t out;
+
+            /* Fill in data */
+            out.agentId = caller->instAgentId;
+            out.clockId = clockId;
+            out.rate = *rate;
+
+            /* Queue notification */
+            RPC_SCMI_P2aTxQ(dstAgent, msgId, (uint32_t*) &out,
+                sizeof(out), SCMI_NOTIFY_Q);
+        }
+    }
+}
+
 /*--------------------------------------------------------------------------*/
 /* Reset agent configuration                                                */
 /*                                                                          */
@@ -1676,8 +2127,11 @@ static int32_t ClockResetAgentConfig(uint32_t lmId, uint32_t agentId,
 {
     int32_t status = SM_ERR_SUCCESS;
 
-    /* Loop over all clocks */
-    for (uint32_t clockId = 0U; clockId < SM_NUM_CLOCK; clockId++)
+    uint32_t clockId = RPC_SCMI_BitArrayNext(s_clockOwned[agentId],
+        SM_NUM_CLOCK, 0U);
+
+    /* Loop over clocks modified by the agent */
+    while (clockId < SM_NUM_CLOCK)
     {
         /* Disable clock */
         if ((s_clockState[clockId] & (1UL << agentId)) != 0U)
@@ -1692,6 +2146,18 @@ static int32_t ClockResetAgentConfig(uint32_t lmId, uint32_t agentId,
             (void) LMM_ClockReset(lmId, clockId);
             s_clockAgent[clockId] = 0U;
         }
+
+        /* Next clock */
+        BITARRAY_CLR(s_clockOwned[agentId], clockId);
+        clockId = RPC_SCMI_BitArrayNext(s_clockOwned[agentId],
+            SM_NUM_CLOCK, clockId + 1U);
+    }
+
+    /* Disable notifications */
+    for (uint32_t idx = 0U; idx < BITARRAY_SIZE(SM_NUM_CLOCK); idx++)
+    {
+        s_clockNotify[agentId][idx] = 0U;
+        s_clockReqNotify[agentId][idx] = 0U;
     }
 
     /* Return status */
@@ -1722,6 +2188,7 @@ static int32_t ClockConfigUpdate(uint32_t lmId, uint32_t agentId,
     {
         /* Mark as enabled */
         s_clockState[clockId] |= (1UL << agentId);
+        BITARRAY_SET(s_clockOwned[agentId], clockId);
     }
     else
     {
@@ -52,6 +52,18 @@
 
 #include "rpc_scmi.h"
 
+/* Defines */
+
+/*!
+ * @name SCMI clock notification message IDs
+ */
+/** @{ */
+/*! Clock rate changed */
+#define RPC_SCMI_NOTIFY_CLOCK_RATE_CHANGED            0x0U
+/*! Clock rate change requested */
+#define RPC_SCMI_NOTIFY_CLOCK_RATE_CHANGE_REQUESTED   0x1U
+/** @} */
+
 /* Functions */
 
 /*!
@@ -78,6 +90,24 @@
 int32_t RPC_SCMI_ClockDispatchCommand(scmi_caller_t *caller,
     uint32_t messageId);
 
+/*!
+ * Dispatch clock protocol notification.
+ *
+ * @param[in]     msgId       Message to send
+ * @param[in]     trigger     Data associated with message
+ *
+ * This function requests the clock protocol send the requested notification
+ * to agents that requested it.
+ *
+ * @return Returns the status (::SM_ERR_SUCCESS = success).
+ *
+ * Return errors (see @ref STATUS "SM error codes"):
+ * - ::SM_ERR_INVALID_PARAMETERS if \a messageId isn't supported
+ * - others returned by queuing functions
+ */
+int32_t RPC_SCMI_ClockDispatchNotification(scmi_msg_id_t msgId,
+    const lmm_rpc_trigger_t *trigger);
+
 /*!
  * Dispatch SCMI clock protocol reset.
  *
@@ -96,6 +126,25 @@ int32_t RPC_SCMI_ClockDispatchCommand(scmi_caller_t *caller,
 int32_t RPC_SCMI_ClockDispatchReset(uint32_t lmId, uint32_t agentId,
     bool permissionsReset);
 
+/*!
+ * Get SCMI clock attributes.
+ *
+ * @param[in]     caller      Caller info
+ * @param[in]     clockId     Identifier for the clock device
+ * @param[out]    attributes  Pointer to return the clock attributes
+ *
+ * This function returns the attributes word reported to the \a caller
+ * by CLOCK_ATTRIBUTES.
+ *
+ * @return Returns the status (::SM_ERR_SUCCESS = success).
+ *
+ * Return errors (see @ref STATUS "SM error codes"):
+ * - ::SM_ERR_NOT_FOUND if \a clockId is invalid
+ * - others returned by LMM_ClockIsEnabled()
+ */
+int32_t RPC_SCMI_ClockAttributesGet(const scmi_caller_t *caller,
+    uint32_t clockId, uint32_t *attributes);
+
 /** @} */
 
 #endif /* RPC_SCMI_CLOCK_H */
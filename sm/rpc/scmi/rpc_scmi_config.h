@@ -117,6 +117,9 @@ typedef struct
     uint8_t secure;                      /*!< Security state */
     uint8_t seenvId;                     /*!< S-EENV ID */
     uint8_t scmiInst;                    /*!< SCMI instance */
+    uint16_t msgRate;                    /*!< Message rate limit (msg/sec) */
+    uint16_t msgBurst;                   /*!< Message burst (0 = rate) */
+    uint32_t cpuBudget;                  /*!< CPU time budget (uS/sec) */
     uint8_t basePerms[SM_NUM_BASE];      /*!< Base protocol permissions */
     uint8_t pdPerms[SM_NUM_POWER];       /*!< Power protocol permissions */
     uint8_t sysPerms;                    /*!< System protocol permission */
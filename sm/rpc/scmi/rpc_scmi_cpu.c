@@ -479,6 +479,7 @@ int32_t RPC_SCMI_CpuDispatchReset(uint32_t lmId, uint32_t agentId,
 /*==========================================================================*/
 
 static uint8_t s_cpuAgent[SM_NUM_CPU];
+static BITARRAY_DEC(s_cpuOwned[SM_SCMI_NUM_AGNT], SM_NUM_CPU);
 
 /*--------------------------------------------------------------------------*/
 /* Get protocol version                                                     */
@@ -856,6 +857,7 @@ static int32_t CpuResetVectorSet(const scmi_caller_t *caller,
 
         /* Mark owning agent */
         s_cpuAgent[in->cpuId] = ((uint8_t) caller->agentId) + 1U;
+        BITARRAY_SET(s_cpuOwned[caller->agentId], in->cpuId);
 
         /* Update vector */
         status = LMM_CpuResetVectorSet(caller->lmId, in->cpuId,
@@ -1355,8 +1357,11 @@ static int32_t CpuResetAgentConfig(uint32_t lmId, uint32_t agentId,
 {
     int32_t status = SM_ERR_SUCCESS;
 
-    /* Loop over all CPUs */
-    for (uint32_t cpuId = 0U; cpuId < SM_NUM_CPU; cpuId++)
+    uint32_t cpuId = RPC_SCMI_BitArrayNext(s_cpuOwned[agentId],
+        SM_NUM_CPU, 0U);
+
+    /* Loop over CPUs modified by the agent */
+    while (cpuId < SM_NUM_CPU)
     {
         /* Reset vector */
         if (s_cpuAgent[cpuId] == (((uint8_t) agentId) + 1U))
@@ -1364,6 +1369,11 @@ static int32_t CpuResetAgentConfig(uint32_t lmId, uint32_t agentId,
             (void) LMM_CpuResetVectorReset(lmId, cpuId);
             s_cpuAgent[cpuId] = 0U;
         }
+
+        /* Next CPU */
+        BITARRAY_CLR(s_cpuOwned[agentId], cpuId);
+        cpuId = RPC_SCMI_BitArrayNext(s_cpuOwned[agentId],
+            SM_NUM_CPU, cpuId + 1U);
     }
 
     /* Return status */
@@ -107,7 +107,9 @@ typedef struct
  * @param[in]     len         Length of message in bytes
  * @param[in]     queue       Notify or priority queue
  *
- * Check if sufficient space for a desired notification.
+ * Check if sufficient space for a desired notification. Space reserved
+ * for delayed responses is not available. An agent with no channel for
+ * \a queue is reported as full.
  *
  * @return Returns true if insufficient space.
  */
@@ -131,6 +133,60 @@ bool RPC_SCMI_P2aTxQFull(uint32_t agentId, uint32_t len, uint32_t queue);
 void RPC_SCMI_P2aTxQ(uint32_t agentId, scmi_msg_id_t msgId, uint32_t *msg,
     uint32_t len, uint32_t queue);
 
+/*!
+ * Transmit SCMI delayed response (P2A).
+ *
+ * @param[in]     agentId     Agent to send message
+ * @param[in]     header      Header of the originating command
+ * @param[in]     msg         Pointer to message to send
+ * @param[in]     len         Length of message in bytes
+ *
+ * This function queues a delayed response to an asynchronous command on
+ * the ::SM_SCMI_CHN_P2A_NOTIFY channel of the agent. The protocol, message
+ * and token are taken from the command \a header. The \a len parameter
+ * is the size in bytes of the source payload. Space for the response
+ * should be reserved with RPC_SCMI_P2aDelayedReserve() when the command
+ * is accepted and released with RPC_SCMI_P2aDelayedRelease() just before
+ * this call.
+ */
+void RPC_SCMI_P2aDelayedTxQ(uint32_t agentId, uint32_t header,
+    uint32_t *msg, uint32_t len);
+
+/*!
+ * Reserve P2A queue space for a delayed response.
+ *
+ * @param[in]     agentId     Agent to send message
+ * @param[in]     len         Max length of the delayed response in bytes
+ *
+ * Called when an asynchronous command is accepted so that the delayed
+ * response can always be delivered. Notifications queued later cannot
+ * use the reserved space.
+ *
+ * @return Returns the status (::SM_ERR_SUCCESS = success).
+ *
+ * Return errors (see @ref STATUS "SM error codes"):
+ * - ::SM_ERR_NOT_SUPPORTED: if the agent has no ::SM_SCMI_CHN_P2A_NOTIFY
+ *   channel.
+ * - ::SM_ERR_BUSY: if the queue has no space for the response.
+ */
+int32_t RPC_SCMI_P2aDelayedReserve(uint32_t agentId, uint32_t len);
+
+/*!
+ * Release P2A queue space reserved for a delayed response.
+ *
+ * @param[in]     agentId     Agent the space was reserved for
+ * @param[in]     len         Length passed to RPC_SCMI_P2aDelayedReserve()
+ */
+void RPC_SCMI_P2aDelayedRelease(uint32_t agentId, uint32_t len);
+
+/*!
+ * Request deferred processing.
+ *
+ * Called by a command handler that queued asynchronous work. Deferred
+ * processing is triggered once the command response has been sent.
+ */
+void RPC_SCMI_DeferRequest(void);
+
 /*!
  * Bounded string copy.
  *
@@ -169,6 +225,58 @@ uint32_t RPC_SCMI_NumProtocolsGet(void);
 int32_t RPC_SCMI_ProtocolListGet(uint32_t skip, uint32_t numWords,
     uint32_t *numProtocols, uint32_t *protocolListDst);
 
+/*!
+ * Get the number of resources of a protocol.
+ *
+ * @param[in]   protocolId    Protocol of the resources
+ * @param[out]  numResources  Pointer to return the number of resources
+ *
+ * This function returns the number of power, perf, clock, sensor, reset,
+ * voltage or pin resources configured for the device.
+ *
+ * @return Returns the status (::SM_ERR_SUCCESS = success).
+ *
+ * Return errors (see @ref STATUS "SM error codes"):
+ * - ::SM_ERR_NOT_SUPPORTED if the protocol has no resource permissions
+ */
+int32_t RPC_SCMI_ResourceNumGet(uint32_t protocolId, uint32_t *numResources);
+
+/*!
+ * Get agent permission for a resource.
+ *
+ * @param[in]   agentId     Agent (global index into ::g_scmiAgentConfig)
+ * @param[in]   protocolId  Protocol of the resource
+ * @param[in]   resourceId  Resource ID
+ * @param[out]  perm        Pointer to return the permission
+ *
+ * This function returns the configured permission of an agent for a
+ * power, perf, clock, sensor, reset, voltage or pin resource.
+ *
+ * @return Returns the status (::SM_ERR_SUCCESS = success).
+ *
+ * Return errors (see @ref STATUS "SM error codes"):
+ * - ::SM_ERR_NOT_SUPPORTED if the protocol has no resource permissions
+ * - ::SM_ERR_NOT_FOUND if the resource does not exist
+ */
+int32_t RPC_SCMI_ResourcePermGet(uint32_t agentId, uint32_t protocolId,
+    uint32_t resourceId, uint8_t *perm);
+
+/*!
+ * Find the next set bit in a bit array.
+ *
+ * @param[in]   bits   Bit array (see BITARRAY_DEC())
+ * @param[in]   num    Number of bits in the array
+ * @param[in]   start  First bit to check
+ *
+ * Used to walk the per-agent lists of resources an agent has modified.
+ * Empty bytes are skipped so the walk cost scales with the number of
+ * resources touched rather than the size of the array.
+ *
+ * @return Returns the index of the next set bit, or \a num if none.
+ */
+uint32_t RPC_SCMI_BitArrayNext(const uint8_t *bits, uint32_t num,
+    uint32_t start);
+
 /** @} */
 
 #endif /* RPC_SCMI_INTERNAL_H */
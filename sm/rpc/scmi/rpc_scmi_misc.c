@@ -41,6 +41,7 @@
 
 #include "rpc_scmi_internal.h"
 #include "lmm.h"
+#include "trace.h"
 
 /* Local defines */
 
@@ -66,7 +67,9 @@
 #define COMMAND_NEGOTIATE_PROTOCOL_VERSION   0x10U
 #define COMMAND_MISC_CONTROL_EXT_SET         0x20U
 #define COMMAND_MISC_CONTROL_EXT_GET         0x21U
-#define COMMAND_SUPPORTED_MASK               0x300017FFFULL
+#define COMMAND_MISC_DISCOVER_RESOURCES      0x22U
+#define COMMAND_MISC_TRACE_GET               0x23U
+#define COMMAND_SUPPORTED_MASK               0xF00017FFFULL
 
 /* SCMI max misc argument lengths */
 #define MISC_MAX_BUILDDATE  16U
@@ -84,6 +87,9 @@
 #define MISC_MAX_PASSOVER   SCMI_ARRAY(8U, uint32_t)
 #define MISC_MAX_EXTINFO    SCMI_ARRAY(16U, uint32_t)
 #define MISC_MAX_SYSLOG     SCMI_ARRAY(8U, uint32_t)
+#define MISC_MAX_RECORD     SCMI_ARRAY(12U, misc_record_t)
+#define MISC_MAX_RECNAME    16U
+#define MISC_MAX_TRACE      SCMI_ARRAY(16U, misc_trace_t)
 
 /* SCMI Control ID Flags */
 #define MISC_CTRL_FLAG_BRD  0x8000U
@@ -119,8 +125,48 @@
 #define MISC_NUM_LOG_FLAGS_REMAING_LOGS(x)  (((x) & 0xFFFU) << 20U)
 #define MISC_NUM_LOG_FLAGS_NUM_LOGS(x)      (((x) & 0xFFFU) << 0U)
 
+/* SCMI misc num record flags */
+#define MISC_NUM_REC_FLAGS_REMAINING_IDS(x)  (((x) & 0xFFFU) << 20U)
+#define MISC_NUM_REC_FLAGS_NUM_RECS(x)       (((x) & 0xFFFU) << 0U)
+
+/* SCMI misc record attributes */
+#define MISC_REC_ATTR_ID(x)    (((x) & 0xFFFFU) << 16U)
+#define MISC_REC_ATTR_PERM(x)  (((x) & 0xFFU) << 0U)
+
+/* SCMI misc num trace flags */
+#define MISC_NUM_TRACE_FLAGS_REMAINING(x)  (((x) & 0xFFFU) << 20U)
+#define MISC_NUM_TRACE_FLAGS_LOST(x)       (((x) & 0x1U) << 19U)
+#define MISC_NUM_TRACE_FLAGS_NUM_RECS(x)   (((x) & 0xFFFU) << 0U)
+
 /* Local types */
 
+/* SCMI misc resource record */
+typedef struct
+{
+    /* Resource ID and caller permission */
+    uint32_t attributes;
+    /* Protocol resource attributes (low) */
+    uint32_t attrLow;
+    /* Protocol resource attributes (high) */
+    uint32_t attrHigh;
+    /* A NULL terminated ASCII string with the resource name, of up to
+        16 bytes */
+    uint8_t name[16];
+} misc_record_t;
+
+/* SCMI misc trace record */
+typedef struct
+{
+    /* Timestamp in uS (low) */
+    uint32_t timeLow;
+    /* Timestamp in uS (high) */
+    uint32_t timeHigh;
+    /* Category, event ID, and argument 0 */
+    uint32_t event;
+    /* Argument 1 */
+    uint32_t arg;
+} misc_trace_t;
+
 /* Response type for ProtocolVersion() */
 typedef struct
 {
@@ -432,6 +478,56 @@ typedef struct
     uint32_t extVal[MISC_MAX_EXTVAL];
 } msg_tmisc33_t;
 
+/* Request type for MiscDiscoverResources() */
+typedef struct
+{
+    /* Header word */
+    uint32_t header;
+    /* Protocol of the resources */
+    uint32_t protocolId;
+    /* Index of the first resource ID to scan */
+    uint32_t index;
+} msg_rmisc34_t;
+
+/* Response type for MiscDiscoverResources() */
+typedef struct
+{
+    /* Header word */
+    uint32_t header;
+    /* Return status */
+    int32_t status;
+    /* Descriptor for the records returned by this call */
+    uint32_t numRecordFlags;
+    /* Index of the next resource ID to scan */
+    uint32_t nextIndex;
+    /* Array of resource records */
+    misc_record_t records[MISC_MAX_RECORD];
+} msg_tmisc34_t;
+
+/* Request type for MiscTraceGet() */
+typedef struct
+{
+    /* Header word */
+    uint32_t header;
+    /* Index of the first trace record to return */
+    uint32_t index;
+} msg_rmisc35_t;
+
+/* Response type for MiscTraceGet() */
+typedef struct
+{
+    /* Header word */
+    uint32_t header;
+    /* Return status */
+    int32_t status;
+    /* Descriptor for the records returned by this call */
+    uint32_t numTraceFlags;
+    /* Index of the next trace record */
+    uint32_t nextIndex;
+    /* Array of trace records */
+    misc_trace_t records[MISC_MAX_TRACE];
+} msg_tmisc35_t;
+
 /* Request type for MiscControlEvent() */
 typedef struct
 {
@@ -481,6 +577,10 @@ static int32_t MiscControlExtSet(const scmi_caller_t *caller,
     const msg_rmisc32_t *in, const scmi_msg_status_t *out);
 static int32_t MiscControlExtGet(const scmi_caller_t *caller,
     const msg_rmisc33_t *in, msg_tmisc33_t *out, uint32_t *len);
+static int32_t MiscDiscoverResources(const scmi_caller_t *caller,
+    const msg_rmisc34_t *in, msg_tmisc34_t *out, uint32_t *len);
+static int32_t MiscTraceGet(const scmi_caller_t *caller,
+    const msg_rmisc35_t *in, msg_tmisc35_t *out, uint32_t *len);
 static int32_t MiscControlEvent(scmi_msg_id_t msgId,
     const lmm_rpc_trigger_t *trigger);
 static int32_t MiscResetAgentConfig(uint32_t lmId, uint32_t agentId,
@@ -594,6 +694,16 @@ int32_t RPC_SCMI_MiscDispatchCommand(scmi_caller_t *caller,
             status = MiscControlExtGet(caller, (const msg_rmisc33_t*) in,
                 (msg_tmisc33_t*) out, &lenOut);
             break;
+        case COMMAND_MISC_DISCOVER_RESOURCES:
+            lenOut = sizeof(msg_tmisc34_t);
+            status = MiscDiscoverResources(caller, (const msg_rmisc34_t*) in,
+                (msg_tmisc34_t*) out, &lenOut);
+            break;
+        case COMMAND_MISC_TRACE_GET:
+            lenOut = sizeof(msg_tmisc35_t);
+            status = MiscTraceGet(caller, (const msg_rmisc35_t*) in,
+                (msg_tmisc35_t*) out, &lenOut);
+            break;
         default:
             status = SM_ERR_NOT_SUPPORTED;
             break;
@@ -654,11 +764,14 @@ int32_t RPC_SCMI_MiscDispatchReset(uint32_t lmId, uint32_t agentId,
 /* Local variables */
 
 static uint32_t s_ctrlNotify[SM_NUM_CTRL][SM_SCMI_NUM_AGNT];
+static BITARRAY_DEC(s_ctrlOwned[SM_SCMI_NUM_AGNT], SM_NUM_CTRL);
 
 /* Local functions */
 
 static int32_t MiscControlUpdate(uint32_t lmId, uint32_t agentId,
     uint32_t ctrlId, uint32_t flags);
+static int32_t MiscResourceGet(const scmi_caller_t *caller,
+    uint32_t protocolId, uint32_t resourceId, misc_record_t *record);
 
 /*--------------------------------------------------------------------------*/
 /* Get protocol version                                                     */
@@ -1887,6 +2000,222 @@ static int32_t MiscControlExtGet(const scmi_caller_t *caller,
     return status;
 }
 
+/*--------------------------------------------------------------------------*/
+/* Discover resources                                                       */
+/*                                                                          */
+/* Parameters:                                                              */
+/* - caller: Caller info                                                    */
+/* - in->protocolId: Protocol of the resources                              */
+/* - in->index: Index of the first resource ID to scan                      */
+/* - out->numRecordFlags: Descriptor for the records returned by this       */
+/*   call.                                                                  */
+/*   Bits[31:20] Number of remaining resource IDs to scan.                  */
+/*   Bits[19:12] Reserved, must be zero.                                    */
+/*   Bits[11:0] Number of records that are returned by this call            */
+/* - out->nextIndex: Index of the next resource ID to scan                  */
+/* - out->records: Array of resource records                                */
+/* - len: Pointer to length (can modify)                                    */
+/*                                                                          */
+/* Process the MISC_DISCOVER_RESOURCES message. Platform handler for        */
+/* SCMI_MiscDiscoverResources(). Scans resource IDs of a protocol starting  */
+/* at index and returns a packed record (ID, permission, attributes, name)  */
+/* for each resource the caller has access to. Resources with no access    */
+/* are skipped. The attributes are those returned by the resource           */
+/* attributes message of the protocol. Allows an agent to probe many        */
+/* resources in one transfer rather than one attributes message per         */
+/* resource.                                                                */
+/*                                                                          */
+/*  Access macros:                                                          */
+/* - MISC_NUM_REC_FLAGS_REMAINING_IDS() - Number of remaining resource IDs  */
+/* - MISC_NUM_REC_FLAGS_NUM_RECS() - Number of records returned             */
+/* - MISC_REC_ATTR_ID() - Resource ID                                       */
+/* - MISC_REC_ATTR_PERM() - Caller permission                               */
+/*                                                                          */
+/* Return errors:                                                           */
+/* - SM_ERR_SUCCESS: if the records are returned successfully.              */
+/* - SM_ERR_NOT_SUPPORTED: if protocolId is not supported.                  */
+/* - SM_ERR_INVALID_PARAMETERS: if index is out of range.                   */
+/* - SM_ERR_PROTOCOL_ERROR: if the incoming payload is too small.           */
+/*--------------------------------------------------------------------------*/
+static int32_t MiscDiscoverResources(const scmi_caller_t *caller,
+    const msg_rmisc34_t *in, msg_tmisc34_t *out, uint32_t *len)
+{
+    int32_t status = SM_ERR_SUCCESS;
+    uint32_t numResources = 0U;
+
+    /* Check request length */
+    if (caller->lenCopy < sizeof(*in))
+    {
+        status = SM_ERR_PROTOCOL_ERROR;
+    }
+
+    /* Get number of resources */
+    if (status == SM_ERR_SUCCESS)
+    {
+        status = RPC_SCMI_ResourceNumGet(in->protocolId, &numResources);
+    }
+
+    /* Check index bounds */
+    if ((status == SM_ERR_SUCCESS) && (in->index >= numResources))
+    {
+        status = SM_ERR_INVALID_PARAMETERS;
+    }
+
+    /* Scan resources */
+    if (status == SM_ERR_SUCCESS)
+    {
+        uint32_t resourceId = in->index;
+        uint32_t numRecords = 0U;
+
+        while ((status == SM_ERR_SUCCESS) && (resourceId < numResources)
+            && (numRecords < MISC_MAX_RECORD))
+        {
+            uint8_t perm = SM_SCMI_PERM_NONE;
+
+            /* Get caller permission */
+            status = RPC_SCMI_ResourcePermGet(caller->agentId,
+                in->protocolId, resourceId, &perm);
+
+            /* Copy out record if accessible */
+            if ((status == SM_ERR_SUCCESS) && (perm != SM_SCMI_PERM_NONE))
+            {
+                status = MiscResourceGet(caller, in->protocolId,
+                    resourceId, &out->records[numRecords]);
+            }
+            if ((status == SM_ERR_SUCCESS) && (perm != SM_SCMI_PERM_NONE))
+            {
+                out->records[numRecords].attributes
+                    = MISC_REC_ATTR_ID(resourceId)
+                    | MISC_REC_ATTR_PERM((uint32_t) perm);
+
+                /* Increment count */
+                numRecords++;
+            }
+
+            resourceId++;
+        }
+
+        /* Return results */
+        out->numRecordFlags = MISC_NUM_REC_FLAGS_NUM_RECS(numRecords)
+            | MISC_NUM_REC_FLAGS_REMAINING_IDS(numResources - resourceId);
+        out->nextIndex = resourceId;
+
+        /* Update length */
+        *len = (4U * sizeof(uint32_t))
+            + (numRecords * sizeof(misc_record_t));
+    }
+
+    /* Return status */
+    return status;
+}
+
+/*--------------------------------------------------------------------------*/
+/* Get event trace records                                                  */
+/*                                                                          */
+/* Parameters:                                                              */
+/* - caller: Caller info                                                    */
+/* - in->index: Index of the first trace record to return                   */
+/* - out->numTraceFlags: Descriptor for the records returned by this call.  */
+/*   Bits[31:20] Number of remaining records.                               */
+/*   Bit[19] Records before index were lost (overwritten).                  */
+/*   Bits[18:12] Reserved, must be zero.                                    */
+/*   Bits[11:0] Number of records that are returned by this call            */
+/* - out->nextIndex: Index of the next trace record                         */
+/* - out->records: Array of trace records                                   */
+/* - len: Pointer to length (can modify)                                    */
+/*                                                                          */
+/* Process the MISC_TRACE_GET message. Platform handler for                 */
+/* SCMI_MiscTraceGet(). Returns records from the SM event trace ring,       */
+/* oldest first. An index older than the oldest record still in the ring   */
+/* starts at the oldest record and sets the lost flag.                      */
+/*                                                                          */
+/*  Access macros:                                                          */
+/* - MISC_NUM_TRACE_FLAGS_REMAINING() - Number of remaining records         */
+/* - MISC_NUM_TRACE_FLAGS_LOST() - Records lost                             */
+/* - MISC_NUM_TRACE_FLAGS_NUM_RECS() - Number of records returned           */
+/*                                                                          */
+/* Return errors:                                                           */
+/* - SM_ERR_SUCCESS: if the records are returned successfully.              */
+/* - SM_ERR_INVALID_PARAMETERS: if index is beyond the last record.         */
+/* - SM_ERR_PROTOCOL_ERROR: if the incoming payload is too small.           */
+/*--------------------------------------------------------------------------*/
+static int32_t MiscTraceGet(const scmi_caller_t *caller,
+    const msg_rmisc35_t *in, msg_tmisc35_t *out, uint32_t *len)
+{
+    int32_t status = SM_ERR_SUCCESS;
+    uint32_t last = TRACE_IndexGet();
+    uint32_t index = 0U;
+    uint32_t lost = 0U;
+
+    /* Check request length */
+    if (caller->lenCopy < sizeof(*in))
+    {
+        status = SM_ERR_PROTOCOL_ERROR;
+    }
+
+    /* Check index bounds */
+    if (status == SM_ERR_SUCCESS)
+    {
+        index = in->index;
+        if (index > last)
+        {
+            status = SM_ERR_INVALID_PARAMETERS;
+        }
+        else if ((last - index) > SM_TRACE_NUM)
+        {
+            /* Skip to the oldest record */
+            index = last - SM_TRACE_NUM;
+            lost = 1U;
+        }
+        else
+        {
+            ; /* Intentional empty else */
+        }
+    }
+
+    /* Copy out records */
+    if (status == SM_ERR_SUCCESS)
+    {
+        uint32_t numRecords = 0U;
+
+        while ((index != last) && (numRecords < MISC_MAX_TRACE))
+        {
+            trace_rec_t rec;
+
+            /* Records overwritten before or during the copy are skipped */
+            if (TRACE_Get(index, &rec) == SM_ERR_SUCCESS)
+            {
+                out->records[numRecords].timeLow = rec.timeLow;
+                out->records[numRecords].timeHigh = rec.timeHigh;
+                out->records[numRecords].event = rec.event;
+                out->records[numRecords].arg = rec.arg;
+
+                /* Increment count */
+                numRecords++;
+            }
+            else
+            {
+                lost = 1U;
+            }
+
+            index++;
+        }
+
+        /* Return results */
+        out->numTraceFlags = MISC_NUM_TRACE_FLAGS_NUM_RECS(numRecords)
+            | MISC_NUM_TRACE_FLAGS_LOST(lost)
+            | MISC_NUM_TRACE_FLAGS_REMAINING(last - index);
+        out->nextIndex = index;
+
+        /* Update length */
+        *len = (4U * sizeof(uint32_t))
+            + (numRecords * sizeof(misc_trace_t));
+    }
+
+    /* Return status */
+    return status;
+}
+
 /*--------------------------------------------------------------------------*/
 /* Send misc control event                                                  */
 /*                                                                          */
@@ -1949,10 +2278,18 @@ static int32_t MiscResetAgentConfig(uint32_t lmId, uint32_t agentId,
 {
     int32_t status = SM_ERR_SUCCESS;
 
-    /* Loop over all controls */
-    for (uint32_t ctrlId = 0U; ctrlId < SM_NUM_CTRL; ctrlId++)
+    uint32_t ctrlId = RPC_SCMI_BitArrayNext(s_ctrlOwned[agentId],
+        SM_NUM_CTRL, 0U);
+
+    /* Loop over controls with notifications enabled by the agent */
+    while (ctrlId < SM_NUM_CTRL)
     {
         (void) MiscControlUpdate(lmId, agentId, ctrlId, 0U);
+
+        /* Next control */
+        BITARRAY_CLR(s_ctrlOwned[agentId], ctrlId);
+        ctrlId = RPC_SCMI_BitArrayNext(s_ctrlOwned[agentId],
+            SM_NUM_CTRL, ctrlId + 1U);
     }
 
     /* Return status */
@@ -1988,6 +2325,10 @@ static int32_t MiscControlUpdate(uint32_t lmId, uint32_t agentId,
 
         /* Record agent flags for this control */
         s_ctrlNotify[ctrlId][agentId] =flags;
+        if (flags != 0U)
+        {
+            BITARRAY_SET(s_ctrlOwned[agentId], ctrlId);
+        }
 
         /* Calculate new aggregate state for the flags */
         for (uint32_t a = firstAgent; a < (firstAgent + numAgents); a++)
@@ -2003,3 +2344,104 @@ static int32_t MiscControlUpdate(uint32_t lmId, uint32_t agentId,
     return status;
 }
 
+/*--------------------------------------------------------------------------*/
+/* Get resource record for discovery                                        */
+/*                                                                          */
+/* Parameters:                                                              */
+/* - caller: Caller info                                                    */
+/* - protocolId: Protocol of the resource                                   */
+/* - resourceId: Resource ID                                                */
+/* - record: Return resource attributes and name                            */
+/*                                                                          */
+/* Attributes are those returned by the attributes message of the resource  */
+/* protocol. The high word is only used by sensors and is zero otherwise.   */
+/*--------------------------------------------------------------------------*/
+static int32_t MiscResourceGet(const scmi_caller_t *caller,
+    uint32_t protocolId, uint32_t resourceId, misc_record_t *record)
+{
+    int32_t status;
+    const uint8_t *nameAddr = (const uint8_t*) "";
+
+    /* Default to no high attributes */
+    record->attrHigh = 0U;
+
+    /* Get attributes and name */
+    switch (protocolId)
+    {
+        case SCMI_PROTOCOL_POWER:
+            status = RPC_SCMI_PowerAttributesGet(caller, resourceId,
+                &record->attrLow);
+            if (status == SM_ERR_SUCCESS)
+            {
+                status = LMM_PowerDomainNameGet(caller->lmId, resourceId,
+                    (string*) &nameAddr, NULL);
+            }
+            break;
+        case SCMI_PROTOCOL_PERF:
+            status = RPC_SCMI_PerfAttributesGet(caller, resourceId,
+                &record->attrLow);
+            if (status == SM_ERR_SUCCESS)
+            {
+                status = LMM_PerfNameGet(caller->lmId, resourceId,
+                    (string*) &nameAddr, NULL);
+            }
+            break;
+        case SCMI_PROTOCOL_CLOCK:
+            status = RPC_SCMI_ClockAttributesGet(caller, resourceId,
+                &record->attrLow);
+            if (status == SM_ERR_SUCCESS)
+            {
+                status = LMM_ClockNameGet(caller->lmId, resourceId,
+                    (string*) &nameAddr, NULL);
+            }
+            break;
+        case SCMI_PROTOCOL_SENSOR:
+            status = RPC_SCMI_SensorAttributesGet(caller, resourceId,
+                &record->attrLow, &record->attrHigh);
+            if (status == SM_ERR_SUCCESS)
+            {
+                status = LMM_SensorNameGet(caller->lmId, resourceId,
+                    (string*) &nameAddr, NULL);
+            }
+            break;
+        case SCMI_PROTOCOL_RESET:
+            status = RPC_SCMI_ResetAttributesGet(resourceId,
+                &record->attrLow);
+            if (status == SM_ERR_SUCCESS)
+            {
+                status = LMM_ResetDomainNameGet(caller->lmId, resourceId,
+                    (string*) &nameAddr, NULL);
+            }
+            break;
+        case SCMI_PROTOCOL_VOLTAGE:
+            status = RPC_SCMI_VoltageAttributesGet(resourceId,
+                &record->attrLow);
+            if (status == SM_ERR_SUCCESS)
+            {
+                status = LMM_VoltageNameGet(caller->lmId, resourceId,
+                    (string*) &nameAddr, NULL);
+            }
+            break;
+        case SCMI_PROTOCOL_PINCTRL:
+            status = RPC_SCMI_PinctrlAttributesGet(resourceId,
+                &record->attrLow);
+            if (status == SM_ERR_SUCCESS)
+            {
+                status = SM_PINNAMEGET(resourceId, (string*) &nameAddr,
+                    NULL);
+            }
+            break;
+        default:
+            status = SM_ERR_NOT_SUPPORTED;
+            break;
+    }
+
+    /* Copy out name */
+    if (status == SM_ERR_SUCCESS)
+    {
+        RPC_SCMI_StrCpy(record->name, nameAddr, MISC_MAX_RECNAME);
+    }
+
+    /* Return status */
+    return status;
+}
@@ -408,6 +408,56 @@ int32_t RPC_SCMI_PerfDispatchReset(uint32_t lmId, uint32_t agentId,
     return PerfResetAgentConfig(lmId, agentId, permissionsReset);
 }
 
+/*--------------------------------------------------------------------------*/
+/* Get performance domain attributes                                        */
+/*                                                                          */
+/* Parameters:                                                              */
+/* - caller: Caller info                                                    */
+/* - domainId: Identifier for the performance domain                        */
+/* - attributes: Pointer to return the domain attributes                    */
+/*--------------------------------------------------------------------------*/
+int32_t RPC_SCMI_PerfAttributesGet(const scmi_caller_t *caller,
+    uint32_t domainId, uint32_t *attributes)
+{
+    int32_t status = SM_ERR_SUCCESS;
+
+    /* Check domain */
+    if (domainId >= SM_NUM_PERF)
+    {
+        status = SM_ERR_NOT_FOUND;
+    }
+
+    /* Return attributes */
+    if (status == SM_ERR_SUCCESS)
+    {
+        uint8_t perm = g_scmiAgentConfig[caller->agentId].perfPerms[domainId];
+
+        /* No notifications */
+        *attributes
+            = PERF_ATTR_LIMIT_NOTIFY(0UL)
+            | PERF_ATTR_LEVEL_NOTIFY(0UL)
+            | PERF_ATTR_FAST(0UL)
+            | PERF_ATTR_EXT_NAME(0UL)
+            | PERF_ATTR_IDX_MODE(1UL)
+            | PERF_RATE_LIMIT_USECONDS(0UL);
+
+        /* Can set performance levels */
+        if (perm >= SM_SCMI_PERM_PRIV)
+        {
+            *attributes |= PERF_ATTR_LEVEL(1UL);
+        }
+
+        /* Can set limits */
+        if (perm >= SM_SCMI_PERM_SET)
+        {
+            *attributes |= PERF_ATTR_LIMIT(1UL);
+        }
+    }
+
+    /* Return status */
+    return status;
+}
+
 /*==========================================================================*/
 /* Custom Protocol Implementation                                           */
 /*==========================================================================*/
@@ -672,10 +722,11 @@ static int32_t PerformanceDomainAttributes(const scmi_caller_t *caller,
         status = SM_ERR_PROTOCOL_ERROR;
     }
 
-    /* Check domain */
-    if ((status == SM_ERR_SUCCESS) && (in->domainId >= SM_NUM_PERF))
+    /* Get the domain attributes */
+    if (status == SM_ERR_SUCCESS)
     {
-        status = SM_ERR_NOT_FOUND;
+        status = RPC_SCMI_PerfAttributesGet(caller, in->domainId,
+            &out->attributes);
     }
 
     /* Get perf domain info */
@@ -699,29 +750,6 @@ static int32_t PerformanceDomainAttributes(const scmi_caller_t *caller,
         out->sustainedFreq = info.sustainedFreq;
         out->sustainedPerfLevel = info.sustainedPerfLevel;
 
-        /* No notifications */
-        out->attributes
-            = PERF_ATTR_LIMIT_NOTIFY(0UL)
-            | PERF_ATTR_LEVEL_NOTIFY(0UL)
-            | PERF_ATTR_FAST(0UL)
-            | PERF_ATTR_EXT_NAME(0UL)
-            | PERF_ATTR_IDX_MODE(1UL)
-            | PERF_RATE_LIMIT_USECONDS(0UL);
-
-        /* Can set performance levels */
-        if ((g_scmiAgentConfig[caller->agentId].perfPerms[in->domainId]
-            >= SM_SCMI_PERM_PRIV))
-        {
-            out->attributes |= PERF_ATTR_LEVEL(1UL);
-        }
-
-        /* Can set limits */
-        if ((g_scmiAgentConfig[caller->agentId].perfPerms[in->domainId]
-            >= SM_SCMI_PERM_SET))
-        {
-            out->attributes |= PERF_ATTR_LIMIT(1UL);
-        }
-
         /* Copy out name */
         RPC_SCMI_StrCpy(out->name, nameAddr, PERF_MAX_NAME);
     }
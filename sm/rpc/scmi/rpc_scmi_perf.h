@@ -96,6 +96,24 @@ int32_t RPC_SCMI_PerfDispatchCommand(scmi_caller_t *caller,
 int32_t RPC_SCMI_PerfDispatchReset(uint32_t lmId, uint32_t agentId,
     bool permissionsReset);
 
+/*!
+ * Get SCMI performance domain attributes.
+ *
+ * @param[in]     caller      Caller info
+ * @param[in]     domainId    Identifier for the performance domain
+ * @param[out]    attributes  Pointer to return the domain attributes
+ *
+ * This function returns the attributes word reported to the \a caller
+ * by PERFORMANCE_DOMAIN_ATTRIBUTES.
+ *
+ * @return Returns the status (::SM_ERR_SUCCESS = success).
+ *
+ * Return errors (see @ref STATUS "SM error codes"):
+ * - ::SM_ERR_NOT_FOUND if \a domainId is invalid
+ */
+int32_t RPC_SCMI_PerfAttributesGet(const scmi_caller_t *caller,
+    uint32_t domainId, uint32_t *attributes);
+
 /** @} */
 
 #endif /* RPC_SCMI_PERF_H */
@@ -380,6 +380,38 @@ int32_t RPC_SCMI_PinctrlDispatchReset(uint32_t lmId, uint32_t agentId,
     return PinctrlResetAgentConfig(lmId, agentId, permissionsReset);
 }
 
+/*--------------------------------------------------------------------------*/
+/* Get pin attributes                                                       */
+/*                                                                          */
+/* Parameters:                                                              */
+/* - pinId: Identifier for the pin                                          */
+/* - attributes: Pointer to return the pin attributes                       */
+/*--------------------------------------------------------------------------*/
+int32_t RPC_SCMI_PinctrlAttributesGet(uint32_t pinId, uint32_t *attributes)
+{
+    int32_t status = SM_ERR_SUCCESS;
+
+    /* Check pin */
+    if (pinId >= SM_NUM_PIN)
+    {
+        status = SM_ERR_NOT_FOUND;
+    }
+
+    /* Return attributes */
+    if (status == SM_ERR_SUCCESS)
+    {
+        /* No notifications */
+        *attributes
+            = PINCTRL_ATTR_EXT_NAME(0UL)
+            | PINCTRL_ATTR_GPIO(0UL)
+            | PINCTRL_ATTR_PIN_ONLY(0UL)
+            | PINCTRL_ATTR_NUM(1UL);
+    }
+
+    /* Return status */
+    return status;
+}
+
 /*==========================================================================*/
 /* Custom Protocol Implementation                                           */
 /*==========================================================================*/
@@ -613,10 +645,11 @@ static int32_t PinctrlAttributes(const scmi_caller_t *caller,
         status = SM_ERR_NOT_FOUND;
     }
 
-    /* Check pin */
-    if ((status == SM_ERR_SUCCESS) && (in->identifier >= SM_NUM_PIN))
+    /* Get the pin attributes */
+    if (status == SM_ERR_SUCCESS)
     {
-        status = SM_ERR_NOT_FOUND;
+        status = RPC_SCMI_PinctrlAttributesGet(in->identifier,
+            &out->attributes);
     }
 
     /* Get the pin name */
@@ -628,13 +661,6 @@ static int32_t PinctrlAttributes(const scmi_caller_t *caller,
     /* Return results */
     if (status == SM_ERR_SUCCESS)
     {
-        /* No notifications */
-        out->attributes
-            = PINCTRL_ATTR_EXT_NAME(0UL)
-            | PINCTRL_ATTR_GPIO(0UL)
-            | PINCTRL_ATTR_PIN_ONLY(0UL)
-            | PINCTRL_ATTR_NUM(1UL);
-
         /* Copy out name */
         RPC_SCMI_StrCpy(out->name, nameAddr, PINCTRL_MAX_NAME);
     }
@@ -96,6 +96,22 @@ int32_t RPC_SCMI_PinctrlDispatchCommand(scmi_caller_t *caller,
 int32_t RPC_SCMI_PinctrlDispatchReset(uint32_t lmId, uint32_t agentId,
     bool permissionsReset);
 
+/*!
+ * Get SCMI pin attributes.
+ *
+ * @param[in]     pinId       Identifier for the pin
+ * @param[out]    attributes  Pointer to return the pin attributes
+ *
+ * This function returns the attributes word reported by
+ * PINCTRL_ATTRIBUTES for a pin.
+ *
+ * @return Returns the status (::SM_ERR_SUCCESS = success).
+ *
+ * Return errors (see @ref STATUS "SM error codes"):
+ * - ::SM_ERR_NOT_FOUND if \a pinId is invalid
+ */
+int32_t RPC_SCMI_PinctrlAttributesGet(uint32_t pinId, uint32_t *attributes);
+
 /** @} */
 
 #endif /* RPC_SCMI_PINCTRL_H */
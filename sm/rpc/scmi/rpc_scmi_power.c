@@ -54,12 +54,17 @@
 #define COMMAND_POWER_DOMAIN_ATTRIBUTES      0x3U
 #define COMMAND_POWER_STATE_SET              0x4U
 #define COMMAND_POWER_STATE_GET              0x5U
+#define COMMAND_POWER_STATE_NOTIFY           0x6U
+#define COMMAND_POWER_STATE_CHANGE_REQUESTED_NOTIFY  0x7U
 #define COMMAND_NEGOTIATE_PROTOCOL_VERSION   0x10U
-#define COMMAND_SUPPORTED_MASK               0x1003FULL
+#define COMMAND_SUPPORTED_MASK               0x100FFULL
 
 /* SCMI max power argument lengths */
 #define POWER_MAX_NAME  16U
 
+/* Max outstanding async power state changes */
+#define POWER_MAX_PENDING  8U
+
 /* SCMI power domain states */
 #define POWER_DOMAIN_STATE_ON   0x00000000U
 #define POWER_DOMAIN_STATE_OFF  0x40000000U
@@ -79,6 +84,9 @@
 /* SCMI power state set flags */
 #define POWER_FLAGS_ASYNC(x)  (((x) & 0x1U) >> 0U)
 
+/* SCMI power notification flags */
+#define POWER_NOTIFY_ENABLE(x)  (((x) & 0x1U) >> 0U)
+
 /* Local types */
 
 /* Response type for ProtocolVersion() */
@@ -184,6 +192,28 @@ typedef struct
     uint32_t powerState;
 } msg_tpower5_t;
 
+/* Request type for PowerStateNotify() */
+typedef struct
+{
+    /* Header word */
+    uint32_t header;
+    /* Identifier for the power domain */
+    uint32_t domainId;
+    /* Notify enable */
+    uint32_t notifyEnable;
+} msg_rpower6_t;
+
+/* Request type for PowerStateChangeRequestedNotify() */
+typedef struct
+{
+    /* Header word */
+    uint32_t header;
+    /* Identifier for the power domain */
+    uint32_t domainId;
+    /* Notify enable */
+    uint32_t notifyEnable;
+} msg_rpower7_t;
+
 /* Request type for NegotiateProtocolVersion() */
 typedef struct
 {
@@ -193,6 +223,47 @@ typedef struct
     uint32_t version;
 } msg_rpower16_t;
 
+/* Delayed response type for PowerStateSet() */
+typedef struct
+{
+    /* Header word */
+    uint32_t header;
+    /* Return status */
+    int32_t status;
+    /* Identifier for the power domain */
+    uint32_t domainId;
+} msg_tpower4d_t;
+
+/* Request type for PowerStateChanged() */
+typedef struct
+{
+    /* Header word */
+    uint32_t header;
+    /* Identifier for the agent that caused the power state change */
+    uint32_t agentId;
+    /* Identifier for the power domain */
+    uint32_t domainId;
+    /* Parameter identifying the power state of the domain */
+    uint32_t powerState;
+} msg_rpower64_t;
+
+/* Async power state change */
+typedef struct
+{
+    /* Header of the command */
+    uint32_t header;
+    /* Agent to respond to */
+    uint32_t agentId;
+    /* LM of the agent */
+    uint32_t lmId;
+    /* Identifier for the power domain */
+    uint32_t domainId;
+    /* Requested power state */
+    uint8_t powerState;
+    /* Change pending */
+    bool pending;
+} power_async_t;
+
 /* Local functions */
 
 static int32_t PowerProtocolVersion(const scmi_caller_t *caller,
@@ -207,8 +278,14 @@ static int32_t PowerStateSet(const scmi_caller_t *caller,
     const msg_rpower4_t *in, const scmi_msg_status_t *out);
 static int32_t PowerStateGet(const scmi_caller_t *caller,
     const msg_rpower5_t *in, msg_tpower5_t *out);
+static int32_t PowerStateNotify(const scmi_caller_t *caller,
+    const msg_rpower6_t *in, const scmi_msg_status_t *out);
+static int32_t PowerStateChangeRequestedNotify(const scmi_caller_t *caller,
+    const msg_rpower7_t *in, const scmi_msg_status_t *out);
 static int32_t PowerNegotiateProtocolVersion(const scmi_caller_t *caller,
     const msg_rpower16_t *in, const scmi_msg_status_t *out);
+static int32_t PowerStateChanged(scmi_msg_id_t msgId,
+    const lmm_rpc_trigger_t *trigger);
 static int32_t PowerResetAgentConfig(uint32_t lmId, uint32_t agentId,
     bool permissionsReset);
 
@@ -260,6 +337,16 @@ int32_t RPC_SCMI_PowerDispatchCommand(scmi_caller_t *caller,
             status = PowerStateGet(caller, (const msg_rpower5_t*) in,
                 (msg_tpower5_t*) out);
             break;
+        case COMMAND_POWER_STATE_NOTIFY:
+            lenOut = sizeof(const scmi_msg_status_t);
+            status = PowerStateNotify(caller, (const msg_rpower6_t*) in,
+                (const scmi_msg_status_t*) out);
+            break;
+        case COMMAND_POWER_STATE_CHANGE_REQUESTED_NOTIFY:
+            lenOut = sizeof(const scmi_msg_status_t);
+            status = PowerStateChangeRequestedNotify(caller,
+                (const msg_rpower7_t*) in, (const scmi_msg_status_t*) out);
+            break;
         case COMMAND_NEGOTIATE_PROTOCOL_VERSION:
             lenOut = sizeof(const scmi_msg_status_t);
             status = PowerNegotiateProtocolVersion(caller,
@@ -277,6 +364,33 @@ int32_t RPC_SCMI_PowerDispatchCommand(scmi_caller_t *caller,
     return status;
 }
 
+/*--------------------------------------------------------------------------*/
+/* Dispatch SCMI notification                                               */
+/*                                                                          */
+/* Parameters:                                                              */
+/* - msgId: Message ID to dispatch                                          */
+/* - trigger: Notification trigger                                          */
+/*--------------------------------------------------------------------------*/
+int32_t RPC_SCMI_PowerDispatchNotification(scmi_msg_id_t msgId,
+    const lmm_rpc_trigger_t *trigger)
+{
+    int32_t status = SM_ERR_SUCCESS;
+
+    /* Handle notifications */
+    switch (msgId.messageId)
+    {
+        case RPC_SCMI_NOTIFY_POWER_STATE_CHANGED:
+            status = PowerStateChanged(msgId, trigger);
+            break;
+        default:
+            status = SM_ERR_NOT_SUPPORTED;
+            break;
+    }
+
+    /* Return status */
+    return status;
+}
+
 /*--------------------------------------------------------------------------*/
 /* Dispatch SCMI reset                                                      */
 /*                                                                          */
@@ -291,6 +405,55 @@ int32_t RPC_SCMI_PowerDispatchReset(uint32_t lmId, uint32_t agentId,
     return PowerResetAgentConfig(lmId, agentId, permissionsReset);
 }
 
+/*--------------------------------------------------------------------------*/
+/* Get power domain attributes                                              */
+/*                                                                          */
+/* Parameters:                                                              */
+/* - caller: Caller info                                                    */
+/* - domainId: Identifier for the power domain                              */
+/* - attributes: Pointer to return the domain attributes                    */
+/*--------------------------------------------------------------------------*/
+int32_t RPC_SCMI_PowerAttributesGet(const scmi_caller_t *caller,
+    uint32_t domainId, uint32_t *attributes)
+{
+    int32_t status = SM_ERR_SUCCESS;
+
+    /* Check domain */
+    if (domainId >= SM_NUM_POWER)
+    {
+        status = SM_ERR_NOT_FOUND;
+    }
+
+    /* Return attributes */
+    if (status == SM_ERR_SUCCESS)
+    {
+        uint8_t perm = g_scmiAgentConfig[caller->agentId].pdPerms[domainId];
+
+        /* Default to no access */
+        *attributes
+            = POWER_ATTR_CHANGE(0UL)
+            | POWER_ATTR_ASYNC(0UL)
+            | POWER_ATTR_SYNC(0UL)
+            | POWER_ATTR_CHANGE_REQ(0UL)
+            | POWER_ATTR_EXT_NAME(0UL);
+
+        /* Adjust based on access */
+        if (perm >= SM_SCMI_PERM_NOTIFY)
+        {
+            *attributes |= POWER_ATTR_CHANGE(1UL)
+                | POWER_ATTR_CHANGE_REQ(1UL);
+        }
+        if (perm >= SM_SCMI_PERM_SET)
+        {
+            *attributes |= POWER_ATTR_ASYNC(1UL)
+                | POWER_ATTR_SYNC(1UL);
+        }
+    }
+
+    /* Return status */
+    return status;
+}
+
 /*==========================================================================*/
 /* Custom Protocol Implementation                                           */
 /*==========================================================================*/
@@ -298,11 +461,18 @@ int32_t RPC_SCMI_PowerDispatchReset(uint32_t lmId, uint32_t agentId,
 /* Local variables */
 
 static uint8_t s_powerState[SM_NUM_POWER][SM_SCMI_NUM_AGNT];
+static BITARRAY_DEC(s_powerOwned[SM_SCMI_NUM_AGNT], SM_NUM_POWER);
+static uint32_t s_powerNotify[SM_SCMI_NUM_AGNT];
+static uint32_t s_powerReqNotify[SM_SCMI_NUM_AGNT];
+static power_async_t s_powerAsync[POWER_MAX_PENDING];
 
 /* Local functions */
 
 static int32_t PowerStateUpdate(uint32_t lmId, uint32_t agentId,
     uint32_t domainId, uint32_t powerState);
+static void PowerStateChangeRequested(const scmi_caller_t *caller,
+    uint32_t domainId, uint32_t powerState);
+static void PowerStateSetComplete(const power_async_t *req);
 
 /*--------------------------------------------------------------------------*/
 /* Get protocol version                                                     */
@@ -505,10 +675,11 @@ static int32_t PowerDomainAttributes(const scmi_caller_t *caller,
         status = SM_ERR_PROTOCOL_ERROR;
     }
 
-    /* Check domain */
-    if ((status == SM_ERR_SUCCESS) && (in->domainId >= SM_NUM_POWER))
+    /* Get the domain attributes */
+    if (status == SM_ERR_SUCCESS)
     {
-        status = SM_ERR_NOT_FOUND;
+        status = RPC_SCMI_PowerAttributesGet(caller, in->domainId,
+            &out->attributes);
     }
 
     /* Get the domain name */
@@ -521,21 +692,6 @@ static int32_t PowerDomainAttributes(const scmi_caller_t *caller,
     /* Return results */
     if (status == SM_ERR_SUCCESS)
     {
-        /* Sync responses only, no notificaions */
-        out->attributes
-            = POWER_ATTR_CHANGE(0UL)
-            | POWER_ATTR_ASYNC(0UL)
-            | POWER_ATTR_SYNC(0UL)
-            | POWER_ATTR_CHANGE_REQ(0UL)
-            | POWER_ATTR_EXT_NAME(0UL);
-
-        /* Adjust based on access */
-        if (g_scmiAgentConfig[caller->agentId].pdPerms[in->domainId]
-            >= SM_SCMI_PERM_SET)
-        {
-            out->attributes |= POWER_ATTR_SYNC(1UL);
-        }
-
         /* Copy out name */
         RPC_SCMI_StrCpy(out->name, nameAddr, POWER_MAX_NAME);
     }
@@ -582,6 +738,10 @@ static int32_t PowerDomainAttributes(const scmi_caller_t *caller,
 /*   of this power domain. An example would be if this power domain is      */
 /*   exclusive to another agent.                                            */
 /* - SM_ERR_PROTOCOL_ERROR: if the incoming payload is too small.           */
+/* - SM_ERR_BUSY: if too many asynchronous changes are pending or the       */
+/*   agent notification queue has no space for the delayed response.        */
+/* - SM_ERR_NOT_SUPPORTED: if an asynchronous change is requested by an     */
+/*   agent without a notification channel.                                  */
 /*--------------------------------------------------------------------------*/
 static int32_t PowerStateSet(const scmi_caller_t *caller,
     const msg_rpower4_t *in, const scmi_msg_status_t *out)
@@ -611,13 +771,6 @@ static int32_t PowerStateSet(const scmi_caller_t *caller,
         status = SM_ERR_DENIED;
     }
 
-    /* Check for async request */
-    if ((status == SM_ERR_SUCCESS) && async)
-    {
-        /* Support sync only */
-        status = SM_ERR_NOT_SUPPORTED;
-    }
-
     /* Check and translate to device power states as easier to track */
     if (status == SM_ERR_SUCCESS)
     {
@@ -635,7 +788,62 @@ static int32_t PowerStateSet(const scmi_caller_t *caller,
                 break;
         }
 
-        /* Update tracking */
+        /* Check power state */
+        if (((uint32_t) state) >= SM_NUM_POWER_STATE)
+        {
+            status = SM_ERR_INVALID_PARAMETERS;
+        }
+    }
+
+    /* Queue async change */
+    if ((status == SM_ERR_SUCCESS) && async)
+    {
+        power_async_t *req = NULL;
+
+        /* Find free entry */
+        for (uint32_t idx = 0U; idx < POWER_MAX_PENDING; idx++)
+        {
+            if (!s_powerAsync[idx].pending)
+            {
+                req = &s_powerAsync[idx];
+                break;
+            }
+        }
+
+        if (req == NULL)
+        {
+            status = SM_ERR_BUSY;
+        }
+        else
+        {
+            /* Ensure the delayed response can be delivered */
+            status = RPC_SCMI_P2aDelayedReserve(agentId,
+                sizeof(msg_tpower4d_t));
+        }
+
+        if (status == SM_ERR_SUCCESS)
+        {
+            req->header = caller->header;
+            req->agentId = agentId;
+            req->lmId = caller->lmId;
+            req->domainId = in->domainId;
+            req->powerState = state;
+            req->pending = true;
+
+            /* Change once response sent */
+            RPC_SCMI_DeferRequest();
+        }
+    }
+
+    /* Notify agents of accepted request */
+    if (status == SM_ERR_SUCCESS)
+    {
+        PowerStateChangeRequested(caller, in->domainId, in->powerState);
+    }
+
+    /* Update tracking */
+    if ((status == SM_ERR_SUCCESS) && !async)
+    {
         status = PowerStateUpdate(caller->lmId, agentId, in->domainId,
             state);
     }
@@ -707,6 +915,146 @@ static int32_t PowerStateGet(const scmi_caller_t *caller,
     return status;
 }
 
+/*--------------------------------------------------------------------------*/
+/* Configure power state change notification                                */
+/*                                                                          */
+/* Parameters:                                                              */
+/* - caller: Caller info                                                    */
+/* - in->domainId: Identifier for the power domain                          */
+/* - in->notifyEnable: Notify enable:                                       */
+/*   Bits[31:1] Reserved, must be zero.                                     */
+/*   Bit[0] Notify enable.                                                  */
+/*   Set to 1 to send POWER_STATE_CHANGED notifications.                    */
+/*   Set to 0 to disable notifications                                      */
+/*                                                                          */
+/* Process the POWER_STATE_NOTIFY message. Platform handler for             */
+/* SCMI_PowerStateNotify(). Requires access greater than or equal to        */
+/* NOTIFY. See section 4.3.2.8 in the SCMI spec.                            */
+/*                                                                          */
+/*  Access macros:                                                          */
+/* - POWER_NOTIFY_ENABLE() - Notify enable                                  */
+/*                                                                          */
+/* Return errors:                                                           */
+/* - SM_ERR_SUCCESS: if the notification state was successfully updated.   */
+/* - SM_ERR_NOT_FOUND: if domainId does not point to a valid power          */
+/*   domain.                                                                */
+/* - SM_ERR_DENIED: if the calling agent is not permitted to request this   */
+/*   notification.                                                          */
+/* - SM_ERR_PROTOCOL_ERROR: if the incoming payload is too small.           */
+/*--------------------------------------------------------------------------*/
+static int32_t PowerStateNotify(const scmi_caller_t *caller,
+    const msg_rpower6_t *in, const scmi_msg_status_t *out)
+{
+    int32_t status = SM_ERR_SUCCESS;
+    bool enable = POWER_NOTIFY_ENABLE(in->notifyEnable) != 0U;
+
+    /* Check request length */
+    if (caller->lenCopy < sizeof(*in))
+    {
+        status = SM_ERR_PROTOCOL_ERROR;
+    }
+
+    /* Check domain */
+    if ((status == SM_ERR_SUCCESS) && (in->domainId >= SM_NUM_POWER))
+    {
+        status = SM_ERR_NOT_FOUND;
+    }
+
+    /* Check permissions */
+    if ((status == SM_ERR_SUCCESS)
+        && (g_scmiAgentConfig[caller->agentId].pdPerms[in->domainId]
+        < SM_SCMI_PERM_NOTIFY))
+    {
+        status = SM_ERR_DENIED;
+    }
+
+    /* Record notification enable */
+    if (status == SM_ERR_SUCCESS)
+    {
+        if (enable)
+        {
+            s_powerNotify[caller->agentId] |= (1UL << in->domainId);
+        }
+        else
+        {
+            s_powerNotify[caller->agentId] &= ~(1UL << in->domainId);
+        }
+    }
+
+    /* Return status */
+    return status;
+}
+
+/*--------------------------------------------------------------------------*/
+/* Configure power state change requested notification                      */
+/*                                                                          */
+/* Parameters:                                                              */
+/* - caller: Caller info                                                    */
+/* - in->domainId: Identifier for the power domain                          */
+/* - in->notifyEnable: Notify enable:                                       */
+/*   Bits[31:1] Reserved, must be zero.                                     */
+/*   Bit[0] Notify enable.                                                  */
+/*   Set to 1 to send POWER_STATE_CHANGE_REQUESTED notifications.           */
+/*   Set to 0 to disable notifications                                      */
+/*                                                                          */
+/* Process the POWER_STATE_CHANGE_REQUESTED_NOTIFY message. Platform        */
+/* handler for SCMI_PowerStateChangeRequestedNotify(). Requires access      */
+/* greater than or equal to NOTIFY. See section 4.3.2.9 in the SCMI spec.   */
+/*                                                                          */
+/*  Access macros:                                                          */
+/* - POWER_NOTIFY_ENABLE() - Notify enable                                  */
+/*                                                                          */
+/* Return errors:                                                           */
+/* - SM_ERR_SUCCESS: if the notification state was successfully updated.   */
+/* - SM_ERR_NOT_FOUND: if domainId does not point to a valid power          */
+/*   domain.                                                                */
+/* - SM_ERR_DENIED: if the calling agent is not permitted to request this   */
+/*   notification.                                                          */
+/* - SM_ERR_PROTOCOL_ERROR: if the incoming payload is too small.           */
+/*--------------------------------------------------------------------------*/
+static int32_t PowerStateChangeRequestedNotify(const scmi_caller_t *caller,
+    const msg_rpower7_t *in, const scmi_msg_status_t *out)
+{
+    int32_t status = SM_ERR_SUCCESS;
+    bool enable = POWER_NOTIFY_ENABLE(in->notifyEnable) != 0U;
+
+    /* Check request length */
+    if (caller->lenCopy < sizeof(*in))
+    {
+        status = SM_ERR_PROTOCOL_ERROR;
+    }
+
+    /* Check domain */
+    if ((status == SM_ERR_SUCCESS) && (in->domainId >= SM_NUM_POWER))
+    {
+        status = SM_ERR_NOT_FOUND;
+    }
+
+    /* Check permissions */
+    if ((status == SM_ERR_SUCCESS)
+        && (g_scmiAgentConfig[caller->agentId].pdPerms[in->domainId]
+        < SM_SCMI_PERM_NOTIFY))
+    {
+        status = SM_ERR_DENIED;
+    }
+
+    /* Record notification enable */
+    if (status == SM_ERR_SUCCESS)
+    {
+        if (enable)
+        {
+            s_powerReqNotify[caller->agentId] |= (1UL << in->domainId);
+        }
+        else
+        {
+            s_powerReqNotify[caller->agentId] &= ~(1UL << in->domainId);
+        }
+    }
+
+    /* Return status */
+    return status;
+}
+
 /*--------------------------------------------------------------------------*/
 /* Negotiate the protocol version                                           */
 /*                                                                          */
@@ -756,6 +1104,152 @@ static int32_t PowerNegotiateProtocolVersion(const scmi_caller_t *caller,
     return status;
 }
 
+/*--------------------------------------------------------------------------*/
+/* Send power state changed notification                                    */
+/*                                                                          */
+/* Parameters:                                                              */
+/* - msgId: Message ID                                                      */
+/* - trigger: Notification trigger:                                         */
+/*   parm[0]: Power domain                                                  */
+/*   parm[1]: New power state                                               */
+/*--------------------------------------------------------------------------*/
+static int32_t PowerStateChanged(scmi_msg_id_t msgId,
+    const lmm_rpc_trigger_t *trigger)
+{
+    int32_t status = SM_ERR_SUCCESS;
+    uint32_t domainId = trigger->parm[0];
+
+    /* Loop over all agents */
+    for (uint32_t dstAgent = 0U; dstAgent < SM_SCMI_NUM_AGNT; dstAgent++)
+    {
+        bool enable = ((s_powerNotify[dstAgent] >> domainId) & 0x1U) != 0U;
+
+        /* Agent belong to instance? */
+        if ((g_scmiAgentConfig[dstAgent].scmiInst == trigger->rpcInst)
+            && enable)
+        {
+            msg_rpower64_t out;
+
+            /* Fill in data */
+            out.agentId = 0U;
+            out.domainId = domainId;
+            switch (trigger->parm[1])
+            {
+                case DEV_SM_POWER_STATE_OFF:
+                    out.powerState = POWER_DOMAIN_STATE_OFF;
+                    break;
+                case DEV_SM_POWER_STATE_ON:
+                    out.powerState = POWER_DOMAIN_STATE_ON;
+                    break;
+                default:
+                    out.powerState = trigger->parm[1];
+                    break;
+            }
+
+            /* Queue notification */
+            RPC_SCMI_P2aTxQ(dstAgent, msgId, (uint32_t*) &out,
+                sizeof(out), SCMI_NOTIFY_Q);
+        }
+    }
+
+    /* Return status */
+    return status;
+}
+
+/*--------------------------------------------------------------------------*/
+/* Dispatch SCMI deferred work                                              */
+/*                                                                          */
+/* Parameters:                                                              */
+/* - scmiInst: SCMI instance                                                */
+/*--------------------------------------------------------------------------*/
+void RPC_SCMI_PowerDispatchDeferred(uint8_t scmiInst)
+{
+    /* Loop over pending changes */
+    for (uint32_t idx = 0U; idx < POWER_MAX_PENDING; idx++)
+    {
+        power_async_t *req = &s_powerAsync[idx];
+
+        /* Agent belong to instance? */
+        if (req->pending && (g_scmiAgentConfig[req->agentId].scmiInst
+            == scmiInst))
+        {
+            /* Change state and send response */
+            PowerStateSetComplete(req);
+
+            /* Free entry */
+            req->pending = false;
+        }
+    }
+}
+
+/*--------------------------------------------------------------------------*/
+/* Send power state change requested notification                           */
+/*                                                                          */
+/* Parameters:                                                              */
+/* - caller: Caller info of the agent requesting the change                 */
+/* - domainId: Power domain                                                 */
+/* - powerState: Requested SCMI power state                                 */
+/*                                                                          */
+/* Notifies subscribed agents of the same instance before the request is    */
+/* aggregated and applied.                                                  */
+/*--------------------------------------------------------------------------*/
+static void PowerStateChangeRequested(const scmi_caller_t *caller,
+    uint32_t domainId, uint32_t powerState)
+{
+    uint32_t scmiInst = caller->scmiInst;
+    scmi_msg_id_t msgId =
+    {
+        .protocolId = SCMI_PROTOCOL_POWER,
+        .messageId = RPC_SCMI_NOTIFY_POWER_STATE_CHANGE_REQUESTED
+    };
+
+    /* Loop over all agents */
+    for (uint32_t dstAgent = 0U; dstAgent < SM_SCMI_NUM_AGNT; dstAgent++)
+    {
+        bool enable = ((s_powerReqNotify[dstAgent] >> domainId) & 0x1U)
+            != 0U;
+
+        /* Agent belong to instance? */
+        if ((g_scmiAgentConfig[dstAgent].scmiInst == scmiInst) && enable)
+        {
+            msg_rpower64_t out;
+
+            /* Fill in data */
+            out.agentId = caller->instAgentId;
+            out.domainId = domainId;
+            out.powerState = powerState;
+
+            /* Queue notification */
+            RPC_SCMI_P2aTxQ(dstAgent, msgId, (uint32_t*) &out,
+                sizeof(out), SCMI_NOTIFY_Q);
+        }
+    }
+}
+
+/*--------------------------------------------------------------------------*/
+/* Complete async power state change                                        */
+/*                                                                          */
+/* Parameters:                                                              */
+/* - req: Pending change                                                    */
+/*                                                                          */
+/* Updates the power state and queues the POWER_STATE_SET_COMPLETE delayed  */
+/* response. Errors are returned in the status of the delayed response.     */
+/*--------------------------------------------------------------------------*/
+static void PowerStateSetComplete(const power_async_t *req)
+{
+    msg_tpower4d_t out;
+
+    /* Update tracking */
+    out.status = PowerStateUpdate(req->lmId, req->agentId, req->domainId,
+        req->powerState);
+    out.domainId = req->domainId;
+
+    /* Queue delayed response */
+    RPC_SCMI_P2aDelayedRelease(req->agentId, sizeof(out));
+    RPC_SCMI_P2aDelayedTxQ(req->agentId, req->header, (uint32_t*) &out,
+        sizeof(out));
+}
+
 /*--------------------------------------------------------------------------*/
 /* Reset agent configuration                                                */
 /*                                                                          */
@@ -769,8 +1263,11 @@ static int32_t PowerResetAgentConfig(uint32_t lmId, uint32_t agentId,
 {
     int32_t status = SM_ERR_SUCCESS;
 
-    /* Loop over all power domains */
-    for (uint32_t domainId = 0U; domainId < SM_NUM_POWER; domainId++)
+    uint32_t domainId = RPC_SCMI_BitArrayNext(s_powerOwned[agentId],
+        SM_NUM_POWER, 0U);
+
+    /* Loop over power domains turned on by the agent */
+    while (domainId < SM_NUM_POWER)
     {
         /* Turn off power */
         if (s_powerState[domainId][agentId] != DEV_SM_POWER_STATE_OFF)
@@ -778,6 +1275,26 @@ static int32_t PowerResetAgentConfig(uint32_t lmId, uint32_t agentId,
             (void) PowerStateUpdate(lmId, agentId, domainId,
                 DEV_SM_POWER_STATE_OFF);
         }
+
+        /* Next domain */
+        BITARRAY_CLR(s_powerOwned[agentId], domainId);
+        domainId = RPC_SCMI_BitArrayNext(s_powerOwned[agentId],
+            SM_NUM_POWER, domainId + 1U);
+    }
+
+    /* Disable notifications */
+    s_powerNotify[agentId] = 0U;
+    s_powerReqNotify[agentId] = 0U;
+
+    /* Drop pending async changes */
+    for (uint32_t idx = 0U; idx < POWER_MAX_PENDING; idx++)
+    {
+        if (s_powerAsync[idx].pending
+            && (s_powerAsync[idx].agentId == agentId))
+        {
+            RPC_SCMI_P2aDelayedRelease(agentId, sizeof(msg_tpower4d_t));
+            s_powerAsync[idx].pending = false;
+        }
     }
 
     /* Return status */
@@ -813,6 +1330,10 @@ static int32_t PowerStateUpdate(uint32_t lmId, uint32_t agentId,
 
         /* Record agent power state for this domain */
         s_powerState[domainId][agentId] = (uint8_t) powerState;
+        if (powerState != DEV_SM_POWER_STATE_OFF)
+        {
+            BITARRAY_SET(s_powerOwned[agentId], domainId);
+        }
 
         /* Calculate new aggregate state for the domain */
         for (uint32_t a = firstAgent; a < (firstAgent + numAgents); a++)
@@ -52,6 +52,18 @@
 
 #include "rpc_scmi.h"
 
+/* Defines */
+
+/*!
+ * @name SCMI power notification message IDs
+ */
+/** @{ */
+/*! Power state changed */
+#define RPC_SCMI_NOTIFY_POWER_STATE_CHANGED            0x0U
+/*! Power state change requested */
+#define RPC_SCMI_NOTIFY_POWER_STATE_CHANGE_REQUESTED   0x1U
+/** @} */
+
 /* Functions */
 
 /*!
@@ -78,6 +90,24 @@
 int32_t RPC_SCMI_PowerDispatchCommand(scmi_caller_t *caller,
     uint32_t messageId);
 
+/*!
+ * Dispatch power protocol notification.
+ *
+ * @param[in]     msgId       Message to send
+ * @param[in]     trigger     Data associated with message
+ *
+ * This function requests the power protocol send the requested notification
+ * to agents that requested it.
+ *
+ * @return Returns the status (::SM_ERR_SUCCESS = success).
+ *
+ * Return errors (see @ref STATUS "SM error codes"):
+ * - ::SM_ERR_INVALID_PARAMETERS if \a messageId isn't supported
+ * - others returned by queuing functions
+ */
+int32_t RPC_SCMI_PowerDispatchNotification(scmi_msg_id_t msgId,
+    const lmm_rpc_trigger_t *trigger);
+
 /*!
  * Dispatch SCMI power protocol reset.
  *
@@ -96,6 +126,34 @@ int32_t RPC_SCMI_PowerDispatchCommand(scmi_caller_t *caller,
 int32_t RPC_SCMI_PowerDispatchReset(uint32_t lmId, uint32_t agentId,
     bool permissionsReset);
 
+/*!
+ * Dispatch SCMI power protocol deferred work.
+ *
+ * @param[in]     scmiInst    SCMI instance
+ *
+ * This function applies asynchronous power state changes pending for
+ * agents of the \a scmiInst instance and sends the delayed responses.
+ */
+void RPC_SCMI_PowerDispatchDeferred(uint8_t scmiInst);
+
+/*!
+ * Get SCMI power domain attributes.
+ *
+ * @param[in]     caller      Caller info
+ * @param[in]     domainId    Identifier for the power domain
+ * @param[out]    attributes  Pointer to return the domain attributes
+ *
+ * This function returns the attributes word reported to the \a caller
+ * by POWER_DOMAIN_ATTRIBUTES.
+ *
+ * @return Returns the status (::SM_ERR_SUCCESS = success).
+ *
+ * Return errors (see @ref STATUS "SM error codes"):
+ * - ::SM_ERR_NOT_FOUND if \a domainId is invalid
+ */
+int32_t RPC_SCMI_PowerAttributesGet(const scmi_caller_t *caller,
+    uint32_t domainId, uint32_t *attributes);
+
 /** @} */
 
 #endif /* RPC_SCMI_POWER_H */
@@ -59,6 +59,9 @@
 /* SCMI max reset argument lengths */
 #define RESET_MAX_NAME  16U
 
+/* Max outstanding async resets */
+#define RESET_MAX_PENDING  8U
+
 /* SCMI reset architectural reset states */
 #define RESET_ARCH_COLD  0x00000000U
 
@@ -170,6 +173,34 @@ typedef struct
     uint32_t version;
 } msg_rreset16_t;
 
+/* Delayed response type for Reset() */
+typedef struct
+{
+    /* Header word */
+    uint32_t header;
+    /* Return status */
+    int32_t status;
+    /* Identifier for the reset domain */
+    uint32_t domainId;
+} msg_treset4d_t;
+
+/* Async reset */
+typedef struct
+{
+    /* Header of the command */
+    uint32_t header;
+    /* Agent to respond to */
+    uint32_t agentId;
+    /* LM of the agent */
+    uint32_t lmId;
+    /* Identifier for the reset domain */
+    uint32_t domainId;
+    /* Requested reset state */
+    uint8_t resetState;
+    /* Reset pending */
+    bool pending;
+} reset_async_t;
+
 /* Local functions */
 
 static int32_t ResetProtocolVersion(const scmi_caller_t *caller,
@@ -184,6 +215,7 @@ static int32_t Reset(const scmi_caller_t *caller, const msg_rreset4_t *in,
     const scmi_msg_status_t *out);
 static int32_t ResetNegotiateProtocolVersion(const scmi_caller_t *caller,
     const msg_rreset16_t *in, const scmi_msg_status_t *out);
+static void ResetComplete(const reset_async_t *req);
 static int32_t ResetResetAgentConfig(uint32_t lmId, uint32_t agentId,
     bool permissionsReset);
 
@@ -261,10 +293,45 @@ int32_t RPC_SCMI_ResetDispatchReset(uint32_t lmId, uint32_t agentId,
     return ResetResetAgentConfig(lmId, agentId, permissionsReset);
 }
 
+/*--------------------------------------------------------------------------*/
+/* Get reset domain attributes                                              */
+/*                                                                          */
+/* Parameters:                                                              */
+/* - domainId: Identifier for the reset domain                              */
+/* - attributes: Pointer to return the domain attributes                    */
+/*--------------------------------------------------------------------------*/
+int32_t RPC_SCMI_ResetAttributesGet(uint32_t domainId, uint32_t *attributes)
+{
+    int32_t status = SM_ERR_SUCCESS;
+
+    /* Check domain */
+    if (domainId >= SM_NUM_RESET)
+    {
+        status = SM_ERR_NOT_FOUND;
+    }
+
+    /* Return attributes */
+    if (status == SM_ERR_SUCCESS)
+    {
+        /* Sync and async resets, no notificaions */
+        *attributes
+            = RESET_ATTR_ASYNC(1UL)
+            | RESET_ATTR_NOTIFICATIONS(0UL)
+            | RESET_ATTR_EXT_NAME(0UL);
+    }
+
+    /* Return status */
+    return status;
+}
+
 /*==========================================================================*/
 /* Custom Protocol Implementation                                           */
 /*==========================================================================*/
 
+/* Local variables */
+
+static reset_async_t s_resetAsync[RESET_MAX_PENDING];
+
 /*--------------------------------------------------------------------------*/
 /* Get protocol version                                                     */
 /*                                                                          */
@@ -443,10 +510,11 @@ static int32_t ResetDomainAttributes(const scmi_caller_t *caller,
         status = SM_ERR_PROTOCOL_ERROR;
     }
 
-    /* Check domain */
-    if ((status == SM_ERR_SUCCESS) && (in->domainId >= SM_NUM_RESET))
+    /* Get the domain attributes */
+    if (status == SM_ERR_SUCCESS)
     {
-        status = SM_ERR_NOT_FOUND;
+        status = RPC_SCMI_ResetAttributesGet(in->domainId,
+            &out->attributes);
     }
 
     /* Get the domain name */
@@ -459,12 +527,6 @@ static int32_t ResetDomainAttributes(const scmi_caller_t *caller,
     /* Return results */
     if (status == SM_ERR_SUCCESS)
     {
-        /* Sync responses only, no notificaions */
-        out->attributes
-            = RESET_ATTR_ASYNC(0UL)
-            | RESET_ATTR_NOTIFICATIONS(0UL)
-            | RESET_ATTR_EXT_NAME(0UL);
-
         /* Latency not supported */
         out->latency = 0xFFFFFFFFU;
 
@@ -519,12 +581,18 @@ static int32_t ResetDomainAttributes(const scmi_caller_t *caller,
 /* - SM_ERR_DENIED: if the calling agent is not allowed to reset the        */
 /*   specified reset domain.                                                */
 /* - SM_ERR_PROTOCOL_ERROR: if the incoming payload is too small.           */
+/* - SM_ERR_BUSY: if too many asynchronous resets are pending or the        */
+/*   agent notification queue has no space for the delayed response.        */
+/* - SM_ERR_NOT_SUPPORTED: if an asynchronous reset is requested by an      */
+/*   agent without a notification channel.                                  */
 /*--------------------------------------------------------------------------*/
 static int32_t Reset(const scmi_caller_t *caller, const msg_rreset4_t *in,
     const scmi_msg_status_t *out)
 {
     int32_t status = SM_ERR_SUCCESS;
     uint8_t lmmState = DEV_SM_RST_COLD;
+    bool async = (RESET_FLAGS_ASYNC(in->flags) != 0U);
+    bool autonomous = (RESET_FLAGS_AUTO(in->flags) != 0U);
 
     /* Check request length */
     if (caller->lenCopy < sizeof(*in))
@@ -546,15 +614,10 @@ static int32_t Reset(const scmi_caller_t *caller, const msg_rreset4_t *in,
         status = SM_ERR_DENIED;
     }
 
-    /* Check async flag */
-    if (status == SM_ERR_SUCCESS)
+    /* Check async flag, only valid for autonomous reset */
+    if ((status == SM_ERR_SUCCESS) && async && !autonomous)
     {
-        bool async = (RESET_FLAGS_ASYNC(in->flags) != 0U);
-
-        if (async)
-        {
-            status = SM_ERR_INVALID_PARAMETERS;
-        }
+        status = SM_ERR_INVALID_PARAMETERS;
     }
 
     /* Check and translate resets */
@@ -580,10 +643,49 @@ static int32_t Reset(const scmi_caller_t *caller, const msg_rreset4_t *in,
         }
     }
 
+    /* Queue async reset */
+    if ((status == SM_ERR_SUCCESS) && async)
+    {
+        reset_async_t *req = NULL;
+
+        /* Find free entry */
+        for (uint32_t idx = 0U; idx < RESET_MAX_PENDING; idx++)
+        {
+            if (!s_resetAsync[idx].pending)
+            {
+                req = &s_resetAsync[idx];
+                break;
+            }
+        }
+
+        if (req == NULL)
+        {
+            status = SM_ERR_BUSY;
+        }
+        else
+        {
+            /* Ensure the delayed response can be delivered */
+            status = RPC_SCMI_P2aDelayedReserve(caller->agentId,
+                sizeof(msg_treset4d_t));
+        }
+
+        if (status == SM_ERR_SUCCESS)
+        {
+            req->header = caller->header;
+            req->agentId = caller->agentId;
+            req->lmId = caller->lmId;
+            req->domainId = in->domainId;
+            req->resetState = lmmState;
+            req->pending = true;
+
+            /* Reset once response sent */
+            RPC_SCMI_DeferRequest();
+        }
+    }
+
     /* Request reset */
-    if (status == SM_ERR_SUCCESS)
+    if ((status == SM_ERR_SUCCESS) && !async)
     {
-        bool autonomous = (RESET_FLAGS_AUTO(in->flags) != 0U);
         bool assertNegate = (RESET_FLAGS_SIGNAL(in->flags) != 0U);
 
         status = LMM_ResetDomain(caller->lmId, in->domainId, lmmState,
@@ -643,6 +745,56 @@ static int32_t ResetNegotiateProtocolVersion(const scmi_caller_t *caller,
     return status;
 }
 
+/*--------------------------------------------------------------------------*/
+/* Dispatch SCMI deferred work                                              */
+/*                                                                          */
+/* Parameters:                                                              */
+/* - scmiInst: SCMI instance                                                */
+/*--------------------------------------------------------------------------*/
+void RPC_SCMI_ResetDispatchDeferred(uint8_t scmiInst)
+{
+    /* Loop over pending resets */
+    for (uint32_t idx = 0U; idx < RESET_MAX_PENDING; idx++)
+    {
+        reset_async_t *req = &s_resetAsync[idx];
+
+        /* Agent belong to instance? */
+        if (req->pending && (g_scmiAgentConfig[req->agentId].scmiInst
+            == scmiInst))
+        {
+            /* Reset and send response */
+            ResetComplete(req);
+
+            /* Free entry */
+            req->pending = false;
+        }
+    }
+}
+
+/*--------------------------------------------------------------------------*/
+/* Complete async reset                                                     */
+/*                                                                          */
+/* Parameters:                                                              */
+/* - req: Pending reset                                                     */
+/*                                                                          */
+/* Performs the autonomous reset and queues the RESET_COMPLETE delayed      */
+/* response. Errors are returned in the status of the delayed response.     */
+/*--------------------------------------------------------------------------*/
+static void ResetComplete(const reset_async_t *req)
+{
+    msg_treset4d_t out;
+
+    /* Toggle reset */
+    out.status = LMM_ResetDomain(req->lmId, req->domainId, req->resetState,
+        true, false);
+    out.domainId = req->domainId;
+
+    /* Queue delayed response */
+    RPC_SCMI_P2aDelayedRelease(req->agentId, sizeof(out));
+    RPC_SCMI_P2aDelayedTxQ(req->agentId, req->header, (uint32_t*) &out,
+        sizeof(out));
+}
+
 /*--------------------------------------------------------------------------*/
 /* Reset agent configuration                                                */
 /*                                                                          */
@@ -656,6 +808,17 @@ static int32_t ResetResetAgentConfig(uint32_t lmId, uint32_t agentId,
 {
     int32_t status = SM_ERR_SUCCESS;
 
+    /* Drop pending async resets */
+    for (uint32_t idx = 0U; idx < RESET_MAX_PENDING; idx++)
+    {
+        if (s_resetAsync[idx].pending
+            && (s_resetAsync[idx].agentId == agentId))
+        {
+            RPC_SCMI_P2aDelayedRelease(agentId, sizeof(msg_treset4d_t));
+            s_resetAsync[idx].pending = false;
+        }
+    }
+
     /* Return status */
     return status;
 }
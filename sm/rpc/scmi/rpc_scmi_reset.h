@@ -96,6 +96,32 @@ int32_t RPC_SCMI_ResetDispatchCommand(scmi_caller_t *caller,
 int32_t RPC_SCMI_ResetDispatchReset(uint32_t lmId, uint32_t agentId,
     bool permissionsReset);
 
+/*!
+ * Dispatch SCMI reset protocol deferred work.
+ *
+ * @param[in]     scmiInst    SCMI instance
+ *
+ * This function performs asynchronous resets pending for agents of the
+ * \a scmiInst instance and sends the delayed responses.
+ */
+void RPC_SCMI_ResetDispatchDeferred(uint8_t scmiInst);
+
+/*!
+ * Get SCMI reset domain attributes.
+ *
+ * @param[in]     domainId    Identifier for the reset domain
+ * @param[out]    attributes  Pointer to return the domain attributes
+ *
+ * This function returns the attributes word reported by
+ * RESET_DOMAIN_ATTRIBUTES.
+ *
+ * @return Returns the status (::SM_ERR_SUCCESS = success).
+ *
+ * Return errors (see @ref STATUS "SM error codes"):
+ * - ::SM_ERR_NOT_FOUND if \a domainId is invalid
+ */
+int32_t RPC_SCMI_ResetAttributesGet(uint32_t domainId, uint32_t *attributes);
+
 /** @} */
 
 #endif /* RPC_SCMI_RESET_H */
@@ -57,14 +57,21 @@
 #define COMMAND_SENSOR_READING_GET           0x6U
 #define COMMAND_SENSOR_CONFIG_GET            0x9U
 #define COMMAND_SENSOR_CONFIG_SET            0xAU
+#define COMMAND_SENSOR_CONTINUOUS_UPDATE_NOTIFY  0xBU
 #define COMMAND_NEGOTIATE_PROTOCOL_VERSION   0x10U
-#define COMMAND_SUPPORTED_MASK               0x1067FULL
+#define COMMAND_SUPPORTED_MASK               0x10E7FULL
 
 /* SCMI max sensor argument lengths */
 #define SENSOR_MAX_NAME      16U
 #define SENSOR_MAX_DESC      SCMI_ARRAY(8U, sensor_desc_t)
 #define SENSOR_MAX_READINGS  SCMI_ARRAY(4U, sensor_reading_t)
 
+/* Max outstanding async reads per agent */
+#define SENSOR_MAX_PENDING  2U
+
+/* Default continuous update interval (msec) */
+#define SENSOR_UPDATE_INTV_DEFAULT  1000U
+
 /* SCMI sensor TP events */
 #define SENSOR_TP_NONE  0U
 #define SENSOR_TP_POS   1U
@@ -112,6 +119,10 @@
 #define SENSOR_CONFIG_GET_TS_ENABLED(x)       (((x) & 0x1U) << 1U)
 #define SENSOR_CONFIG_GET_ENABLED(x)          (((x) & 0x1U) << 0U)
 
+/* SCMI sensor round modes */
+#define SENSOR_ROUND_DOWN  0U
+#define SENSOR_ROUND_UP    1U
+
 /* SCMI sensor config (set) */
 #define SENSOR_CONFIG_SET_UPDATE_INTV_SEC(x)  (((x) & 0xFFFF0000U) >> 16U)
 #define SENSOR_CONFIG_SET_UPDATE_INTV_EXP(x)  (((x) & 0xF800U) >> 11U)
@@ -301,6 +312,17 @@ typedef struct
     uint32_t sensorConfig;
 } msg_rsensor10_t;
 
+/* Request type for SensorContinuousUpdateNotify() */
+typedef struct
+{
+    /* Header word */
+    uint32_t header;
+    /* Identifier for the sensor */
+    uint32_t sensorId;
+    /* Notify enable */
+    uint32_t notifyEnable;
+} msg_rsensor11_t;
+
 /* Request type for NegotiateProtocolVersion() */
 typedef struct
 {
@@ -310,6 +332,47 @@ typedef struct
     uint32_t version;
 } msg_rsensor16_t;
 
+/* Delayed response type for SensorReadingGet() */
+typedef struct
+{
+    /* Header word */
+    uint32_t header;
+    /* Return status */
+    int32_t status;
+    /* Identifier for the sensor */
+    uint32_t sensorId;
+    /* An array of sensor readings */
+    sensor_reading_t readings[1];
+} msg_tsensor6d_t;
+
+/* Request type for SensorUpdate() */
+typedef struct
+{
+    /* Header word */
+    uint32_t header;
+    /* Refers to the agent that caused this event */
+    uint32_t agentId;
+    /* Identifier for the sensor */
+    uint32_t sensorId;
+    /* An array of sensor readings */
+    sensor_reading_t readings[1];
+} msg_rsensor65_t;
+
+/* Async sensor read */
+typedef struct
+{
+    /* Header of the command */
+    uint32_t header;
+    /* Agent to respond to */
+    uint32_t agentId;
+    /* LM of the agent */
+    uint32_t lmId;
+    /* Identifier for the sensor */
+    uint32_t sensorId;
+    /* Read pending */
+    bool pending;
+} sensor_async_t;
+
 /* Request type for SensorTripPointEvent() */
 typedef struct
 {
@@ -343,10 +406,14 @@ static int32_t SensorConfigGet(const scmi_caller_t *caller,
     const msg_rsensor9_t *in, msg_tsensor9_t *out);
 static int32_t SensorConfigSet(const scmi_caller_t *caller,
     const msg_rsensor10_t *in, const scmi_msg_status_t *out);
+static int32_t SensorContinuousUpdateNotify(const scmi_caller_t *caller,
+    const msg_rsensor11_t *in, const scmi_msg_status_t *out);
 static int32_t SensorNegotiateProtocolVersion(const scmi_caller_t *caller,
     const msg_rsensor16_t *in, const scmi_msg_status_t *out);
 static int32_t SensorTripPointEvent(scmi_msg_id_t msgId,
     const lmm_rpc_trigger_t *trigger);
+static void SensorReadingComplete(const sensor_async_t *read);
+static void SensorUpdate(uint8_t scmiInst, uint32_t sensorId);
 static int32_t SensorResetAgentConfig(uint32_t lmId, uint32_t agentId,
     bool permissionsReset);
 
@@ -413,6 +480,11 @@ int32_t RPC_SCMI_SensorDispatchCommand(scmi_caller_t *caller,
             status = SensorConfigSet(caller, (const msg_rsensor10_t*) in,
                 (const scmi_msg_status_t*) out);
             break;
+        case COMMAND_SENSOR_CONTINUOUS_UPDATE_NOTIFY:
+            lenOut = sizeof(const scmi_msg_status_t);
+            status = SensorContinuousUpdateNotify(caller,
+                (const msg_rsensor11_t*) in, (const scmi_msg_status_t*) out);
+            break;
         case COMMAND_NEGOTIATE_PROTOCOL_VERSION:
             lenOut = sizeof(const scmi_msg_status_t);
             status = SensorNegotiateProtocolVersion(caller,
@@ -471,6 +543,63 @@ int32_t RPC_SCMI_SensorDispatchReset(uint32_t lmId, uint32_t agentId,
     return SensorResetAgentConfig(lmId, agentId, permissionsReset);
 }
 
+/*--------------------------------------------------------------------------*/
+/* Get sensor attributes                                                    */
+/*                                                                          */
+/* Parameters:                                                              */
+/* - caller: Caller info                                                    */
+/* - sensorId: Identifier for the sensor                                    */
+/* - attributesLow: Pointer to return the sensor attributes (low)           */
+/* - attributesHigh: Pointer to return the sensor attributes (high)         */
+/*--------------------------------------------------------------------------*/
+int32_t RPC_SCMI_SensorAttributesGet(const scmi_caller_t *caller,
+    uint32_t sensorId, uint32_t *attributesLow, uint32_t *attributesHigh)
+{
+    int32_t status = SM_ERR_SUCCESS;
+    dev_sm_sensor_desc_t lmmDesc;
+
+    /* Check sensor */
+    if (sensorId >= SM_NUM_SENSOR)
+    {
+        status = SM_ERR_NOT_FOUND;
+    }
+
+    /* Get sensor description */
+    if (status == SM_ERR_SUCCESS)
+    {
+        status = LMM_SensorDescribe(caller->lmId, sensorId, &lmmDesc);
+    }
+
+    /* Return attributes */
+    if (status == SM_ERR_SUCCESS)
+    {
+        /* Sensor attributes (low) */
+        *attributesLow = SENSOR_ATTR_LOW_NUM_TP(
+            (uint32_t) lmmDesc.numTripPoints);
+        if (lmmDesc.timestampSupport)
+        {
+            *attributesLow |= SENSOR_ATTR_LOW_TIME_SUPPORT(1UL);
+            *attributesLow |= SENSOR_ATTR_LOW_TIME_EXP(
+                (uint32_t) lmmDesc.timestampExponent);
+        }
+        if (lmmDesc.asyncReadSupport)
+        {
+            *attributesLow |= SENSOR_ATTR_LOW_ASYNC(1UL);
+        }
+        *attributesLow |= SENSOR_ATTR_LOW_CONTINUOUS(1UL);
+
+        /* Sensor attributes (high) */
+        *attributesHigh
+            = SENSOR_ATTR_HIGH_SENSOR_TYPE(
+            (uint32_t) lmmDesc.sensorType);
+        *attributesHigh |= SENSOR_ATTR_HIGH_SENSOR_EXP(
+            (uint32_t) lmmDesc.sensorExponent);
+    }
+
+    /* Return status */
+    return status;
+}
+
 /*==========================================================================*/
 /* Custom Protocol Implementation                                           */
 /*==========================================================================*/
@@ -478,12 +607,27 @@ int32_t RPC_SCMI_SensorDispatchReset(uint32_t lmId, uint32_t agentId,
 /* Local variables */
 
 static uint32_t s_sensorState[SM_NUM_SENSOR];
+static BITARRAY_DEC(s_sensorOwned[SM_SCMI_NUM_AGNT], SM_NUM_SENSOR);
 static uint32_t s_sensorNotify[SM_SCMI_NUM_AGNT];
+static sensor_async_t s_sensorAsync[SM_SCMI_NUM_AGNT][SENSOR_MAX_PENDING];
+static uint32_t s_sensorUpdate[SM_SCMI_NUM_AGNT];
+static uint32_t s_sensorIntv[SM_SCMI_NUM_AGNT][SM_NUM_SENSOR];
+
+/* Written only by the tick, updates due when counts differ */
+static uint32_t s_sensorElapsed[SM_SCMI_NUM_AGNT][SM_NUM_SENSOR];
+static uint8_t s_sensorDueCnt[SM_SCMI_NUM_AGNT][SM_NUM_SENSOR];
+
+/* Written only by dispatch */
+static uint8_t s_sensorSentCnt[SM_SCMI_NUM_AGNT][SM_NUM_SENSOR];
 
 /* Local functions */
 
 static int32_t SensorConfigUpdate(uint32_t lmId, uint32_t agentId,
     uint32_t sensorId, bool enable, bool timeStamp);
+static uint32_t SensorIntvGet(uint32_t agentId, uint32_t sensorId);
+static bool SensorUpdateDue(uint32_t agentId, uint32_t sensorId);
+static void SensorUpdateClear(uint32_t agentId, uint32_t sensorId);
+static uint32_t SensorIntvDecode(uint32_t sensorConfig);
 
 /*--------------------------------------------------------------------------*/
 /* Get protocol version                                                     */
@@ -573,9 +717,9 @@ static int32_t SensorProtocolAttributes(const scmi_caller_t *caller,
     /* Return data */
     if (status == SM_ERR_SUCCESS)
     {
-        /* Return number of sensors, no async calls */
+        /* Return number of sensors and async calls */
         out->attributes
-            = SENSOR_PROTO_ATTR_MAX_PENDING(0UL)
+            = SENSOR_PROTO_ATTR_MAX_PENDING(SENSOR_MAX_PENDING)
             | SENSOR_PROTO_ATTR_NUM_SENSORS(SM_NUM_SENSOR);
 
         /* Statistics not supported */
@@ -693,7 +837,6 @@ static int32_t SensorDescriptionGet(const scmi_caller_t *caller,
         out->numSensorFlags = 0U;
         for (sensor = 0U; sensor < SENSOR_MAX_DESC; sensor++)
         {
-            dev_sm_sensor_desc_t lmmDesc;
             const uint8_t *nameAddr = (const uint8_t*) "";
 
             /* Break out if done */
@@ -716,37 +859,16 @@ static int32_t SensorDescriptionGet(const scmi_caller_t *caller,
                     SENSOR_MAX_NAME);
             }
 
-            /* Get sensor description */
-            status = LMM_SensorDescribe(caller->lmId,
-                sensor + in->descIndex, &lmmDesc);
+            /* Get sensor attributes */
+            status = RPC_SCMI_SensorAttributesGet(caller,
+                sensor + in->descIndex,
+                &out->desc[sensor].sensorAttributesLow,
+                &out->desc[sensor].sensorAttributesHigh);
 
-            /* Copy out data */
+            /* Sensor number */
             if (status == SM_ERR_SUCCESS)
             {
-                uint32_t attributes;
-
-                /* Sensor number */
                 out->desc[sensor].sensorId = sensor + in->descIndex;
-
-                /* Sensor attributes (low) */
-                attributes = SENSOR_ATTR_LOW_NUM_TP(
-                    (uint32_t) lmmDesc.numTripPoints);
-                if (lmmDesc.timestampSupport)
-                {
-                    attributes |= SENSOR_ATTR_LOW_TIME_SUPPORT(1UL);
-                    attributes |= SENSOR_ATTR_LOW_TIME_EXP(
-                        (uint32_t) lmmDesc.timestampExponent);
-                }
-                out->desc[sensor].sensorAttributesLow = attributes;
-
-                /* Sensor attributes (high) */
-                attributes
-                    = SENSOR_ATTR_HIGH_SENSOR_TYPE(
-                    (uint32_t) lmmDesc.sensorType);
-                attributes |= SENSOR_ATTR_HIGH_SENSOR_EXP(
-                    (uint32_t) lmmDesc.sensorExponent);
-
-                out->desc[sensor].sensorAttributesHigh = attributes;
             }
 
             /* Increment count */
@@ -966,6 +1088,10 @@ static int32_t SensorTripPointConfig(const scmi_caller_t *caller,
 /* - SM_ERR_PROTOCOL_ERROR: if the function is used to read updates from    */
 /*   a disabled sensor.                                                     */
 /* - SM_ERR_PROTOCOL_ERROR: if the incoming payload is too small.           */
+/* - SM_ERR_BUSY: if too many asynchronous reads are pending for the agent  */
+/*   or its notification queue has no space for the delayed response.       */
+/* - SM_ERR_NOT_SUPPORTED: if an asynchronous read is requested by an agent */
+/*   without a notification channel.                                        */
 /*--------------------------------------------------------------------------*/
 static int32_t SensorReadingGet(const scmi_caller_t *caller,
     const msg_rsensor6_t *in, msg_tsensor6_t *out, uint32_t *len)
@@ -987,10 +1113,17 @@ static int32_t SensorReadingGet(const scmi_caller_t *caller,
         status = SM_ERR_NOT_FOUND;
     }
 
-    /* Check for delayed response */
+    /* Check sensor supports delayed response */
     if ((status == SM_ERR_SUCCESS) && async)
     {
-        status = SM_ERR_INVALID_PARAMETERS;
+        dev_sm_sensor_desc_t lmmDesc;
+
+        status = LMM_SensorDescribe(caller->lmId, in->sensorId, &lmmDesc);
+
+        if ((status == SM_ERR_SUCCESS) && !lmmDesc.asyncReadSupport)
+        {
+            status = SM_ERR_INVALID_PARAMETERS;
+        }
     }
 
     /* Check if enabled */
@@ -1008,14 +1141,56 @@ static int32_t SensorReadingGet(const scmi_caller_t *caller,
         }
     }
 
+    /* Queue async read */
+    if ((status == SM_ERR_SUCCESS) && async)
+    {
+        sensor_async_t *read = NULL;
+
+        /* Find free entry of the agent */
+        for (uint32_t idx = 0U; idx < SENSOR_MAX_PENDING; idx++)
+        {
+            if (!s_sensorAsync[caller->agentId][idx].pending)
+            {
+                read = &s_sensorAsync[caller->agentId][idx];
+                break;
+            }
+        }
+
+        if (read == NULL)
+        {
+            status = SM_ERR_BUSY;
+        }
+        else
+        {
+            /* Ensure the delayed response can be delivered */
+            status = RPC_SCMI_P2aDelayedReserve(caller->agentId,
+                sizeof(msg_tsensor6d_t));
+        }
+
+        if (status == SM_ERR_SUCCESS)
+        {
+            read->header = caller->header;
+            read->agentId = caller->agentId;
+            read->lmId = caller->lmId;
+            read->sensorId = in->sensorId;
+            read->pending = true;
+
+            /* Read once response sent */
+            RPC_SCMI_DeferRequest();
+
+            /* Return status only */
+            *len = sizeof(scmi_msg_status_t);
+        }
+    }
+
     /* Get sensor reading */
-    if (status == SM_ERR_SUCCESS)
+    if ((status == SM_ERR_SUCCESS) && !async)
     {
         status = LMM_SensorReadingGet(caller->lmId, in->sensorId,
             &sensorValue, &sensorTimestamp);
     }
 
-    if (status == SM_ERR_SUCCESS)
+    if ((status == SM_ERR_SUCCESS) && !async)
     {
         uint64_t uSensorValue = (uint64_t) sensorValue;
         uint32_t uSensorValueHigh = SM_UINT64_H(uSensorValue);
@@ -1107,9 +1282,22 @@ static int32_t SensorConfigGet(const scmi_caller_t *caller,
     /* Return results */
     if (status == SM_ERR_SUCCESS)
     {
-        out->sensorConfig
-            = SENSOR_CONFIG_GET_UPDATE_INTV_SEC(0UL)
-            | SENSOR_CONFIG_GET_UPDATE_INTV_EXP(0UL);
+        uint32_t intv = SensorIntvGet(caller->agentId, in->sensorId);
+
+        /* Return interval in msec if it fits, else in sec */
+        if (intv <= 0xFFFFU)
+        {
+            out->sensorConfig
+                = SENSOR_CONFIG_GET_UPDATE_INTV_SEC(intv)
+                | SENSOR_CONFIG_GET_UPDATE_INTV_EXP(0x1DUL); /* -3 */
+        }
+        else
+        {
+            out->sensorConfig
+                = SENSOR_CONFIG_GET_UPDATE_INTV_SEC(MIN(intv / 1000U,
+                0xFFFFU))
+                | SENSOR_CONFIG_GET_UPDATE_INTV_EXP(0UL);
+        }
 
         if (enabled)
         {
@@ -1219,6 +1407,83 @@ static int32_t SensorConfigSet(const scmi_caller_t *caller,
             enable, timestampReporting);
     }
 
+    /* Update interval of the agent, 0 leaves it unchanged */
+    if ((status == SM_ERR_SUCCESS)
+        && (SENSOR_CONFIG_SET_UPDATE_INTV_SEC(in->sensorConfig) != 0U))
+    {
+        s_sensorIntv[agentId][in->sensorId]
+            = SensorIntvDecode(in->sensorConfig);
+    }
+
+    /* Return status */
+    return status;
+}
+
+/*--------------------------------------------------------------------------*/
+/* Configure sensor update notification                                     */
+/*                                                                          */
+/* Parameters:                                                              */
+/* - caller: Caller info                                                    */
+/* - in->sensorId: Identifier for the sensor                                */
+/* - in->notifyEnable: Notify enable:                                       */
+/*   Bits[31:1] Reserved, must be zero.                                     */
+/*   Bit[0] Set to 1 to enable SENSOR_UPDATE notifications, set to 0 to     */
+/*   disable them                                                           */
+/*                                                                          */
+/* Process the SENSOR_CONTINUOUS_UPDATE_NOTIFY message. Platform handler    */
+/* for SCMI_SensorContinuousUpdateNotify(). Requires access greater than or */
+/* equal to NOTIFY. See section 4.7.2.13 in the SCMI spec.                  */
+/*                                                                          */
+/* Notifications are sent at the update interval configured by the agent    */
+/* with SENSOR_CONFIG_SET.                                                  */
+/*                                                                          */
+/* Return errors:                                                           */
+/* - SM_ERR_SUCCESS: if the notification state was successfully updated.   */
+/* - SM_ERR_NOT_FOUND: if sensorId does not point to an existing sensor.    */
+/* - SM_ERR_DENIED: if the calling agent is not permitted to request this   */
+/*   notification.                                                          */
+/* - SM_ERR_PROTOCOL_ERROR: if the incoming payload is too small.           */
+/*--------------------------------------------------------------------------*/
+static int32_t SensorContinuousUpdateNotify(const scmi_caller_t *caller,
+    const msg_rsensor11_t *in, const scmi_msg_status_t *out)
+{
+    int32_t status = SM_ERR_SUCCESS;
+    bool enable = SENSOR_EV_CTRL_ENABLE(in->notifyEnable) != 0U;
+
+    /* Check request length */
+    if (caller->lenCopy < sizeof(*in))
+    {
+        status = SM_ERR_PROTOCOL_ERROR;
+    }
+
+    /* Check sensor */
+    if ((status == SM_ERR_SUCCESS) && (in->sensorId >= SM_NUM_SENSOR))
+    {
+        status = SM_ERR_NOT_FOUND;
+    }
+
+    /* Check permissions */
+    if ((status == SM_ERR_SUCCESS)
+        && (g_scmiAgentConfig[caller->agentId].sensorPerms[in->sensorId]
+        < SM_SCMI_PERM_NOTIFY))
+    {
+        status = SM_ERR_DENIED;
+    }
+
+    /* Record notification enable */
+    if (status == SM_ERR_SUCCESS)
+    {
+        if (enable)
+        {
+            s_sensorUpdate[caller->agentId] |= (1UL << in->sensorId);
+        }
+        else
+        {
+            s_sensorUpdate[caller->agentId] &= ~(1UL << in->sensorId);
+            SensorUpdateClear(caller->agentId, in->sensorId);
+        }
+    }
+
     /* Return status */
     return status;
 }
@@ -1315,6 +1580,201 @@ static int32_t SensorTripPointEvent(scmi_msg_id_t msgId,
     return status;
 }
 
+/*--------------------------------------------------------------------------*/
+/* Dispatch SCMI deferred work                                              */
+/*                                                                          */
+/* Parameters:                                                              */
+/* - scmiInst: SCMI instance                                                */
+/*--------------------------------------------------------------------------*/
+void RPC_SCMI_SensorDispatchDeferred(uint8_t scmiInst)
+{
+    /* Loop over agents */
+    for (uint32_t agentId = 0U; agentId < SM_SCMI_NUM_AGNT; agentId++)
+    {
+        /* Agent belong to instance? */
+        if (g_scmiAgentConfig[agentId].scmiInst == scmiInst)
+        {
+            /* Loop over pending reads */
+            for (uint32_t idx = 0U; idx < SENSOR_MAX_PENDING; idx++)
+            {
+                sensor_async_t *read = &s_sensorAsync[agentId][idx];
+
+                if (read->pending)
+                {
+                    /* Read sensor and send response */
+                    SensorReadingComplete(read);
+
+                    /* Free entry */
+                    read->pending = false;
+                }
+            }
+        }
+    }
+
+    /* Send due continuous updates */
+    for (uint32_t sensorId = 0U; sensorId < SM_NUM_SENSOR; sensorId++)
+    {
+        SensorUpdate(scmiInst, sensorId);
+    }
+}
+
+/*--------------------------------------------------------------------------*/
+/* Tick SCMI sensor timers                                                  */
+/*                                                                          */
+/* Parameters:                                                              */
+/* - msec: Time elapsed since last tick                                     */
+/*--------------------------------------------------------------------------*/
+bool RPC_SCMI_SensorTick(uint32_t msec)
+{
+    bool due = false;
+
+    /* Loop over subscribed agents and sensors */
+    for (uint32_t agentId = 0U; agentId < SM_SCMI_NUM_AGNT; agentId++)
+    {
+        for (uint32_t sensorId = 0U; sensorId < SM_NUM_SENSOR; sensorId++)
+        {
+            if ((s_sensorUpdate[agentId] & (1UL << sensorId)) == 0U)
+            {
+                /* Restart interval on next subscribe */
+                s_sensorElapsed[agentId][sensorId] = 0U;
+            }
+            else
+            {
+                s_sensorElapsed[agentId][sensorId] += msec;
+
+                /* Update interval of the agent expired? */
+                if (s_sensorElapsed[agentId][sensorId]
+                    >= SensorIntvGet(agentId, sensorId))
+                {
+                    s_sensorElapsed[agentId][sensorId] = 0U;
+
+                    /* Mark update due, dispatch clears it */
+                    s_sensorDueCnt[agentId][sensorId]++;
+                    due = true;
+                }
+            }
+        }
+    }
+
+    /* Return if deferred work due */
+    return due;
+}
+
+/*--------------------------------------------------------------------------*/
+/* Complete async sensor read                                               */
+/*                                                                          */
+/* Parameters:                                                              */
+/* - read: Pending read                                                     */
+/*                                                                          */
+/* Reads the sensor and queues the SENSOR_READING_COMPLETE delayed          */
+/* response. Errors are returned in the status of the delayed response.     */
+/*--------------------------------------------------------------------------*/
+static void SensorReadingComplete(const sensor_async_t *read)
+{
+    int64_t sensorValue = 0;
+    uint64_t sensorTimestamp = 0U;
+    msg_tsensor6d_t out;
+    uint32_t len = sizeof(out);
+
+    /* Get sensor reading */
+    out.status = LMM_SensorReadingGet(read->lmId, read->sensorId,
+        &sensorValue, &sensorTimestamp);
+    out.sensorId = read->sensorId;
+
+    if (out.status == SM_ERR_SUCCESS)
+    {
+        uint64_t uSensorValue = (uint64_t) sensorValue;
+        uint32_t uSensorValueHigh = SM_UINT64_H(uSensorValue);
+        uint32_t uSensorValueLow = SM_UINT64_L(uSensorValue);
+
+        /* Record result */
+        out.readings[0].sensorValueHigh = (int32_t) uSensorValueHigh;
+        out.readings[0].sensorValueLow = (int32_t) uSensorValueLow;
+        out.readings[0].timestampHigh = SM_UINT64_H(sensorTimestamp);
+        out.readings[0].timestampLow = SM_UINT64_L(sensorTimestamp);
+    }
+    else
+    {
+        /* Return status only */
+        len = sizeof(scmi_msg_status_t);
+    }
+
+    /* Queue delayed response into the space reserved for it */
+    RPC_SCMI_P2aDelayedRelease(read->agentId, sizeof(msg_tsensor6d_t));
+    RPC_SCMI_P2aDelayedTxQ(read->agentId, read->header, (uint32_t*) &out,
+        len);
+}
+
+/*--------------------------------------------------------------------------*/
+/* Send sensor update notifications                                         */
+/*                                                                          */
+/* Parameters:                                                              */
+/* - scmiInst: SCMI instance                                                */
+/* - sensorId: Identifier for the sensor                                    */
+/*                                                                          */
+/* The sensor is read once and the reading sent to all agents of the        */
+/* instance with an update due.                                             */
+/*--------------------------------------------------------------------------*/
+static void SensorUpdate(uint8_t scmiInst, uint32_t sensorId)
+{
+    uint32_t firstAgent = g_scmiConfig[scmiInst].firstAgent;
+    uint32_t numAgents = g_scmiConfig[scmiInst].numAgents;
+    bool due = false;
+
+    /* Any update due for this instance? */
+    for (uint32_t agentId = firstAgent; agentId < (firstAgent + numAgents);
+        agentId++)
+    {
+        if (SensorUpdateDue(agentId, sensorId))
+        {
+            due = true;
+        }
+    }
+
+    if (due)
+    {
+        int64_t sensorValue = 0;
+        uint64_t sensorTimestamp = 0U;
+        int32_t status;
+
+        /* Get sensor reading */
+        status = LMM_SensorReadingGet(g_scmiConfig[scmiInst].lmId,
+            sensorId, &sensorValue, &sensorTimestamp);
+
+        /* Loop over agents of the instance */
+        for (uint32_t agentId = firstAgent; agentId < (firstAgent
+            + numAgents); agentId++)
+        {
+            if ((status == SM_ERR_SUCCESS)
+                && SensorUpdateDue(agentId, sensorId))
+            {
+                uint64_t uSensorValue = (uint64_t) sensorValue;
+                scmi_msg_id_t msgId;
+                msg_rsensor65_t out;
+
+                /* Fill in data */
+                out.agentId = 0U;
+                out.sensorId = sensorId;
+                out.readings[0].sensorValueHigh
+                    = (int32_t) SM_UINT64_H(uSensorValue);
+                out.readings[0].sensorValueLow
+                    = (int32_t) SM_UINT64_L(uSensorValue);
+                out.readings[0].timestampHigh = SM_UINT64_H(sensorTimestamp);
+                out.readings[0].timestampLow = SM_UINT64_L(sensorTimestamp);
+
+                /* Queue notification */
+                msgId.protocolId = SCMI_PROTOCOL_SENSOR;
+                msgId.messageId = RPC_SCMI_NOTIFY_SENSOR_UPDATE;
+                RPC_SCMI_P2aTxQ(agentId, msgId, (uint32_t*) &out,
+                    sizeof(out), SCMI_NOTIFY_Q);
+            }
+
+            /* Clear due */
+            SensorUpdateClear(agentId, sensorId);
+        }
+    }
+}
+
 /*--------------------------------------------------------------------------*/
 /* Reset agent configuration                                                */
 /*                                                                          */
@@ -1328,8 +1788,11 @@ static int32_t SensorResetAgentConfig(uint32_t lmId, uint32_t agentId,
 {
     int32_t status = SM_ERR_SUCCESS;
 
-    /* Loop over all sensors */
-    for (uint32_t sensorId = 0U; sensorId < SM_NUM_SENSOR; sensorId++)
+    uint32_t sensorId = RPC_SCMI_BitArrayNext(s_sensorOwned[agentId],
+        SM_NUM_SENSOR, 0U);
+
+    /* Loop over sensors enabled by the agent */
+    while (sensorId < SM_NUM_SENSOR)
     {
         /* Disable sensor */
         if ((s_sensorState[sensorId] & (1UL << agentId)) != 0U)
@@ -1337,10 +1800,31 @@ static int32_t SensorResetAgentConfig(uint32_t lmId, uint32_t agentId,
             (void) SensorConfigUpdate(lmId, agentId, sensorId,
                 false, false);
         }
+
+        /* Next sensor */
+        BITARRAY_CLR(s_sensorOwned[agentId], sensorId);
+        sensorId = RPC_SCMI_BitArrayNext(s_sensorOwned[agentId],
+            SM_NUM_SENSOR, sensorId + 1U);
     }
 
     /* Disable notifications */
     s_sensorNotify[agentId] = 0U;
+    s_sensorUpdate[agentId] = 0U;
+    for (uint32_t idx = 0U; idx < SM_NUM_SENSOR; idx++)
+    {
+        SensorUpdateClear(agentId, idx);
+        s_sensorIntv[agentId][idx] = 0U;
+    }
+
+    /* Drop pending async reads */
+    for (uint32_t idx = 0U; idx < SENSOR_MAX_PENDING; idx++)
+    {
+        if (s_sensorAsync[agentId][idx].pending)
+        {
+            RPC_SCMI_P2aDelayedRelease(agentId, sizeof(msg_tsensor6d_t));
+            s_sensorAsync[agentId][idx].pending = false;
+        }
+    }
 
     /* Return status */
     return status;
@@ -1370,6 +1854,7 @@ static int32_t SensorConfigUpdate(uint32_t lmId, uint32_t agentId,
     {
         /* Mark as enabled */
         s_sensorState[sensorId] |= (1UL << agentId);
+        BITARRAY_SET(s_sensorOwned[agentId], sensorId);
     }
     else
     {
@@ -1386,3 +1871,107 @@ static int32_t SensorConfigUpdate(uint32_t lmId, uint32_t agentId,
     return LMM_SensorEnable(lmId, sensorId, sensorEnable, timeStamp);
 }
 
+/*--------------------------------------------------------------------------*/
+/* Get sensor update interval                                               */
+/*                                                                          */
+/* Parameters:                                                              */
+/* - agentId: Agent                                                         */
+/* - sensorId: Identifier for the sensor                                    */
+/*                                                                          */
+/* Returns the update interval of the agent in msec.                        */
+/*--------------------------------------------------------------------------*/
+static uint32_t SensorIntvGet(uint32_t agentId, uint32_t sensorId)
+{
+    uint32_t intv = s_sensorIntv[agentId][sensorId];
+
+    /* Not configured? */
+    if (intv == 0U)
+    {
+        intv = SENSOR_UPDATE_INTV_DEFAULT;
+    }
+
+    return intv;
+}
+
+/*--------------------------------------------------------------------------*/
+/* Decode sensor update interval                                            */
+/*                                                                          */
+/* Parameters:                                                              */
+/* - sensorConfig: Sensor config from SENSOR_CONFIG_SET                     */
+/*                                                                          */
+/* Converts the [sec] x 10^[exponent] interval to msec, applying the        */
+/* requested rounding. Returns the interval in msec, minimum 1.             */
+/*--------------------------------------------------------------------------*/
+static uint32_t SensorIntvDecode(uint32_t sensorConfig)
+{
+    uint64_t intv = SENSOR_CONFIG_SET_UPDATE_INTV_SEC(sensorConfig);
+    uint32_t exp = SENSOR_CONFIG_SET_UPDATE_INTV_EXP(sensorConfig);
+    uint32_t round = SENSOR_CONFIG_SET_ROUND(sensorConfig);
+    int32_t pow10 = 3;
+
+    /* Sign extend exponent and convert sec to msec */
+    if (exp >= 16U)
+    {
+        pow10 -= (int32_t) (32U - exp);
+    }
+    else
+    {
+        pow10 += (int32_t) exp;
+    }
+
+    /* Scale up */
+    while ((pow10 > 0) && (intv <= 0xFFFFFFFFULL))
+    {
+        intv *= 10ULL;
+        pow10--;
+    }
+
+    /* Scale down with rounding */
+    while (pow10 < 0)
+    {
+        if (round == SENSOR_ROUND_UP)
+        {
+            intv = (intv + 9ULL) / 10ULL;
+        }
+        else if (round == SENSOR_ROUND_DOWN)
+        {
+            intv = intv / 10ULL;
+        }
+        else
+        {
+            intv = (intv + 5ULL) / 10ULL;
+        }
+        pow10++;
+    }
+
+    /* Return bounded interval */
+    return (uint32_t) MAX(MIN(intv, 0xFFFFFFFFULL), 1ULL);
+}
+
+/*--------------------------------------------------------------------------*/
+/* Check if sensor update due                                               */
+/*                                                                          */
+/* Parameters:                                                              */
+/* - agentId: Agent                                                         */
+/* - sensorId: Identifier for the sensor                                    */
+/*                                                                          */
+/* The tick only increments the due count and dispatch only copies it to    */
+/* the sent count, so neither needs to lock out the other.                  */
+/*--------------------------------------------------------------------------*/
+static bool SensorUpdateDue(uint32_t agentId, uint32_t sensorId)
+{
+    return (s_sensorDueCnt[agentId][sensorId]
+        != s_sensorSentCnt[agentId][sensorId]);
+}
+
+/*--------------------------------------------------------------------------*/
+/* Clear sensor update due                                                  */
+/*                                                                          */
+/* Parameters:                                                              */
+/* - agentId: Agent                                                         */
+/* - sensorId: Identifier for the sensor                                    */
+/*--------------------------------------------------------------------------*/
+static void SensorUpdateClear(uint32_t agentId, uint32_t sensorId)
+{
+    s_sensorSentCnt[agentId][sensorId] = s_sensorDueCnt[agentId][sensorId];
+}
@@ -60,6 +60,8 @@
 /** @{ */
 /*! Read sensor event */
 #define RPC_SCMI_NOTIFY_SENSOR_TRIP_POINT_EVENT  0x0U
+/*! Read sensor update */
+#define RPC_SCMI_NOTIFY_SENSOR_UPDATE            0x1U
 /** @} */
 
 /* Functions */
@@ -124,6 +126,50 @@ int32_t RPC_SCMI_SensorDispatchNotification(scmi_msg_id_t msgId,
 int32_t RPC_SCMI_SensorDispatchReset(uint32_t lmId, uint32_t agentId,
     bool permissionsReset);
 
+/*!
+ * Dispatch SCMI sensor protocol deferred work.
+ *
+ * @param[in]     scmiInst    SCMI instance
+ *
+ * This function completes asynchronous sensor reads pending for agents
+ * of the \a scmiInst instance and sends the delayed responses.
+ */
+void RPC_SCMI_SensorDispatchDeferred(uint8_t scmiInst);
+
+/*!
+ * Tick SCMI sensor protocol timers.
+ *
+ * @param[in]     msec        Time elapsed since last tick
+ *
+ * This function advances the continuous update timers of sensors with
+ * subscribed agents. Called from the SM timer tick, so only marks the
+ * updates that are due. The sensors are read and notifications sent by
+ * RPC_SCMI_SensorDispatchDeferred().
+ *
+ * @return Returns true if deferred work is due.
+ */
+bool RPC_SCMI_SensorTick(uint32_t msec);
+
+/*!
+ * Get SCMI sensor attributes.
+ *
+ * @param[in]     caller          Caller info
+ * @param[in]     sensorId        Identifier for the sensor
+ * @param[out]    attributesLow   Pointer to return the attributes (low)
+ * @param[out]    attributesHigh  Pointer to return the attributes (high)
+ *
+ * This function returns the attribute words reported to the \a caller
+ * in the SENSOR_DESCRIPTION_GET descriptor of a sensor.
+ *
+ * @return Returns the status (::SM_ERR_SUCCESS = success).
+ *
+ * Return errors (see @ref STATUS "SM error codes"):
+ * - ::SM_ERR_NOT_FOUND if \a sensorId is invalid
+ * - others returned by LMM_SensorDescribe()
+ */
+int32_t RPC_SCMI_SensorAttributesGet(const scmi_caller_t *caller,
+    uint32_t sensorId, uint32_t *attributesLow, uint32_t *attributesHigh);
+
 /** @} */
 
 #endif /* RPC_SCMI_SENSOR_H */
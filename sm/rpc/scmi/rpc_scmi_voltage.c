@@ -375,6 +375,37 @@ int32_t RPC_SCMI_VoltageDispatchReset(uint32_t lmId, uint32_t agentId,
     return VoltageResetAgentConfig(lmId, agentId, permissionsReset);
 }
 
+/*--------------------------------------------------------------------------*/
+/* Get voltage domain attributes                                            */
+/*                                                                          */
+/* Parameters:                                                              */
+/* - domainId: Identifier for the voltage domain                            */
+/* - attributes: Pointer to return the domain attributes                    */
+/*--------------------------------------------------------------------------*/
+int32_t RPC_SCMI_VoltageAttributesGet(uint32_t domainId,
+    uint32_t *attributes)
+{
+    int32_t status = SM_ERR_SUCCESS;
+
+    /* Check domain */
+    if (domainId >= SM_NUM_VOLT)
+    {
+        status = SM_ERR_NOT_FOUND;
+    }
+
+    /* Return attributes */
+    if (status == SM_ERR_SUCCESS)
+    {
+        /* Sync responses only */
+        *attributes
+            = VOLTAGE_ATTR_ASYNC(0UL)
+            | VOLTAGE_ATTR_EXT_NAME(0UL);
+    }
+
+    /* Return status */
+    return status;
+}
+
 /*==========================================================================*/
 /* Custom Protocol Implementation                                           */
 /*==========================================================================*/
@@ -382,6 +413,7 @@ int32_t RPC_SCMI_VoltageDispatchReset(uint32_t lmId, uint32_t agentId,
 /* Local variables */
 
 static uint8_t s_voltState[SM_NUM_VOLT][SM_SCMI_NUM_AGNT];
+static BITARRAY_DEC(s_voltOwned[SM_SCMI_NUM_AGNT], SM_NUM_VOLT);
 
 /* Local functions */
 
@@ -563,10 +595,11 @@ static int32_t VoltageDomainAttributes(const scmi_caller_t *caller,
         status = SM_ERR_PROTOCOL_ERROR;
     }
 
-    /* Check domain */
-    if ((status == SM_ERR_SUCCESS) && (in->domainId >= SM_NUM_VOLT))
+    /* Get the domain attributes */
+    if (status == SM_ERR_SUCCESS)
     {
-        status = SM_ERR_NOT_FOUND;
+        status = RPC_SCMI_VoltageAttributesGet(in->domainId,
+            &out->attributes);
     }
 
     /* Get the domain name */
@@ -579,11 +612,6 @@ static int32_t VoltageDomainAttributes(const scmi_caller_t *caller,
     /* Return results */
     if (status == SM_ERR_SUCCESS)
     {
-        /* Sync responses only */
-        out->attributes
-            = VOLTAGE_ATTR_ASYNC(0UL)
-            | VOLTAGE_ATTR_EXT_NAME(0UL);
-
         /* Copy out name */
         RPC_SCMI_StrCpy(out->name, nameAddr, VOLTAGE_MAX_NAME);
     }
@@ -1042,8 +1070,11 @@ static int32_t VoltageResetAgentConfig(uint32_t lmId, uint32_t agentId,
 {
     int32_t status = SM_ERR_SUCCESS;
 
-    /* Loop over all voltage domains */
-    for (uint32_t domainId = 0U; domainId < SM_NUM_VOLT; domainId++)
+    uint32_t domainId = RPC_SCMI_BitArrayNext(s_voltOwned[agentId],
+        SM_NUM_VOLT, 0U);
+
+    /* Loop over voltage domains turned on by the agent */
+    while (domainId < SM_NUM_VOLT)
     {
         /* Turn off voltage */
         if (s_voltState[domainId][agentId] != VOLTAGE_DOMAIN_MODES_OFF)
@@ -1051,6 +1082,11 @@ static int32_t VoltageResetAgentConfig(uint32_t lmId, uint32_t agentId,
             status = VoltageConfigUpdate(lmId, agentId, domainId,
                 VOLTAGE_DOMAIN_MODES_OFF);
         }
+
+        /* Next domain */
+        BITARRAY_CLR(s_voltOwned[agentId], domainId);
+        domainId = RPC_SCMI_BitArrayNext(s_voltOwned[agentId],
+            SM_NUM_VOLT, domainId + 1U);
     }
 
     /* TODO: reset voltage level */
@@ -1078,6 +1114,10 @@ static int32_t VoltageConfigUpdate(uint32_t lmId, uint32_t agentId,
 
     /* Record agent voltage mode for this domain */
     s_voltState[domainId][agentId] = mode;
+    if (mode != VOLTAGE_DOMAIN_MODES_OFF)
+    {
+        BITARRAY_SET(s_voltOwned[agentId], domainId);
+    }
 
     /* Calculate new aggregate state for the domain */
     for (uint32_t a = firstAgent; a < (firstAgent + numAgents); a++)
@@ -96,6 +96,23 @@ int32_t RPC_SCMI_VoltageDispatchCommand(scmi_caller_t *caller,
 int32_t RPC_SCMI_VoltageDispatchReset(uint32_t lmId, uint32_t agentId,
     bool permissionsReset);
 
+/*!
+ * Get SCMI voltage domain attributes.
+ *
+ * @param[in]     domainId    Identifier for the voltage domain
+ * @param[out]    attributes  Pointer to return the domain attributes
+ *
+ * This function returns the attributes word reported by
+ * VOLTAGE_DOMAIN_ATTRIBUTES.
+ *
+ * @return Returns the status (::SM_ERR_SUCCESS = success).
+ *
+ * Return errors (see @ref STATUS "SM error codes"):
+ * - ::SM_ERR_NOT_FOUND if \a domainId is invalid
+ */
+int32_t RPC_SCMI_VoltageAttributesGet(uint32_t domainId,
+    uint32_t *attributes);
+
 /** @} */
 
 #endif /* RPC_SCMI_VOLTAGE_H */
@@ -43,6 +43,7 @@
 #include "rpc_smt.h"
 #include "config_smt.h"
 #include "rpc_scmi.h"
+#include "dev_sm.h"
 #ifdef USES_MB_LOOPBACK
 #include "mb_loopback.h"
 #endif
@@ -57,6 +58,9 @@
 #define SMT_ERROR     (1UL << 1U)
 #define SMT_COMP_INT  (1UL << 0U)
 
+/* Max messages serviced by polling before returning to the IRQ */
+#define SMT_POLL_MAX_BURST  16U
+
 /* Local types */
 
 typedef struct
@@ -80,10 +84,14 @@ static const rpc_smt_chn_config_t s_smtConfig[SM_NUM_SMT_CHN] =
 
 static bool s_smtInProgress[SM_NUM_SMT_CHN];
 
+static rpc_smt_stats_t s_smtStats[SM_NUM_SMT_CHN];
+
 /* Local functions */
 
 static rpc_smt_buf_t *RPC_SMT_SmaGet(uint32_t smtChannel);
 static int32_t RPC_SMT_DoorbellRing(uint32_t smtChannel);
+static void RPC_SMT_Service(uint32_t smtChannel);
+static bool RPC_SMT_Poll(uint32_t smtChannel);
 
 /*--------------------------------------------------------------------------*/
 /* Init SMT channel                                                         */
@@ -192,32 +200,46 @@ bool RPC_SMT_ChannelFree(uint32_t smtChannel)
 /*--------------------------------------------------------------------------*/
 void RPC_SMT_Dispatch(uint32_t smtChannel)
 {
-    /* Call RPC-specific dispatcher */
-    switch (s_smtConfig[smtChannel].rpcType)
-    {
-        case SM_RPC_SCMI:
-            RPC_SCMI_Dispatch(s_smtConfig[smtChannel].rpcChannel);
-            break;
-        default:
-            ; /* Intentional empty default */
-            break;
-    }
+    bool pending = true;
+    uint32_t burst = 0U;
 
-    /* Not completed? */
-    if (s_smtInProgress[smtChannel])
+    /* Count doorbell */
+    s_smtStats[smtChannel].dispatch++;
+
+    /* Service until no new message arrives within the poll window */
+    while (pending)
     {
-        rpc_smt_buf_t *buf = RPC_SMT_SmaGet(smtChannel);
+        RPC_SMT_Service(smtChannel);
+        burst++;
 
-        /* Check buffer */
-        if (buf != NULL)
+        /* Poll unless burst limit reached, IRQ will catch the rest */
+        pending = false;
+        if (burst < SMT_POLL_MAX_BURST)
         {
-            /* Mark channel in error */
-            buf->channelFlags = SMT_ERROR;
+            pending = RPC_SMT_Poll(smtChannel);
         }
+    }
+}
 
-        /* Force completion */
-        (void) RPC_SMT_Tx(smtChannel, 0U, true, false);
+/*--------------------------------------------------------------------------*/
+/* Get SMT channel statistics                                               */
+/*--------------------------------------------------------------------------*/
+int32_t RPC_SMT_StatsGet(uint32_t smtChannel, rpc_smt_stats_t *stats)
+{
+    int32_t status = SM_ERR_SUCCESS;
+
+    /* Check channel */
+    if (smtChannel >= SM_NUM_SMT_CHN)
+    {
+        status = SM_ERR_OUT_OF_RANGE;
     }
+    else
+    {
+        *stats = s_smtStats[smtChannel];
+    }
+
+    /* Return status */
+    return status;
 }
 
 /*--------------------------------------------------------------------------*/
@@ -569,3 +591,71 @@ static int32_t RPC_SMT_DoorbellRing(uint32_t smtChannel)
     return status;
 }
 
+/*--------------------------------------------------------------------------*/
+/* Service one SMT message                                                  */
+/*--------------------------------------------------------------------------*/
+static void RPC_SMT_Service(uint32_t smtChannel)
+{
+    /* Call RPC-specific dispatcher */
+    switch (s_smtConfig[smtChannel].rpcType)
+    {
+        case SM_RPC_SCMI:
+            RPC_SCMI_Dispatch(s_smtConfig[smtChannel].rpcChannel);
+            break;
+        default:
+            ; /* Intentional empty default */
+            break;
+    }
+
+    /* Not completed? */
+    if (s_smtInProgress[smtChannel])
+    {
+        rpc_smt_buf_t *buf = RPC_SMT_SmaGet(smtChannel);
+
+        /* Check buffer */
+        if (buf != NULL)
+        {
+            /* Mark channel in error */
+            buf->channelFlags = SMT_ERROR;
+        }
+
+        /* Force completion */
+        (void) RPC_SMT_Tx(smtChannel, 0U, true, false);
+    }
+}
+
+/*--------------------------------------------------------------------------*/
+/* Poll for the next doorbell                                               */
+/*--------------------------------------------------------------------------*/
+static bool RPC_SMT_Poll(uint32_t smtChannel)
+{
+    bool pending = false;
+    uint32_t pollTime = s_smtConfig[smtChannel].pollTime;
+
+    /* Adaptive polling enabled? */
+    if (pollTime != 0U)
+    {
+        uint64_t endTime = DEV_SM_Usec64Get() + pollTime;
+
+        /* Poll doorbell until window expires */
+        do
+        {
+            pending = RPC_SMT_DoorbellState(smtChannel);
+        }
+        while (!pending && (DEV_SM_Usec64Get() < endTime));
+
+        /* Record hit rate */
+        if (pending)
+        {
+            s_smtStats[smtChannel].pollHit++;
+        }
+        else
+        {
+            s_smtStats[smtChannel].pollMiss++;
+        }
+    }
+
+    /* Return result */
+    return pending;
+}
+
@@ -61,6 +61,18 @@
 /*! SMT buffer payload size */
 #define SMT_BUFFER_PAYLOAD  (SMT_BUFFER_SIZE - SMT_BUFFER_HEADER - 4U)
 
+/* Types */
+
+/*!
+ * SMT channel statistics
+ */
+typedef struct
+{
+    uint32_t dispatch;  /*!< Doorbell interrupts dispatched */
+    uint32_t pollHit;   /*!< Messages received while polling */
+    uint32_t pollMiss;  /*!< Poll windows expired without a message */
+} rpc_smt_stats_t;
+
 /* Functions */
 
 /*!
@@ -114,9 +126,30 @@ bool RPC_SMT_ChannelFree(uint32_t smtChannel);
  * parameter is used to index into the local const SMT config structure
  * to find the linked RPC type and RPC channel. The RPC disptch function
  * is then called.
+ *
+ * If the channel is configured with a poll window, the doorbell is then
+ * polled for that time. Messages that arrive within the window are
+ * serviced without taking another interrupt.
  */
 void RPC_SMT_Dispatch(uint32_t smtChannel);
 
+/*!
+ * Get SMT channel statistics.
+ *
+ * @param[in]     smtChannel  SMT channel
+ * @param[out]    stats       Return pointer to the statistics
+ *
+ * This function returns the doorbell dispatch count and the adaptive
+ * poll hit/miss counts for \a smtChannel.
+ *
+ * @return Returns the status (::SM_ERR_SUCCESS = success).
+ *
+ * Return errors (see @ref STATUS "SM error codes"):
+ * - ::SM_ERR_SUCCESS: if the stats were returned.
+ * - ::SM_ERR_OUT_OF_RANGE: if \a smtChannel is invalid.
+ */
+int32_t RPC_SMT_StatsGet(uint32_t smtChannel, rpc_smt_stats_t *stats);
+
 /*!
  * Get SMT doorbell state and clear.
  *
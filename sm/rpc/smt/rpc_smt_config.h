@@ -86,6 +86,7 @@ typedef struct
     uint8_t mbInst;      /*!< Mailbox instance to link */
     uint8_t mbDoorbell;  /*!< Mailbox doorbell to link */
     uint8_t crc;         /*!< CRC algorithm to use for this channel */
+    uint16_t pollTime;   /*!< Adaptive poll window in uS, 0 = off */
 } rpc_smt_chn_config_t;
 
 #endif /* RPC_SMT_CONFIG_H */
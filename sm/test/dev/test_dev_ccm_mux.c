@@ -0,0 +1,137 @@
+/*
+** ###################################################################
+**
+** Copyright 2024 NXP
+**
+** Redistribution and use in source and binary forms, with or without modification,
+** are permitted provided that the following conditions are met:
+**
+** o Redistributions of source code must retain the above copyright notice, this list
+**   of conditions and the following disclaimer.
+**
+** o Redistributions in binary form must reproduce the above copyright notice, this
+**   list of conditions and the following disclaimer in the documentation and/or
+**   other materials provided with the distribution.
+**
+** o Neither the name of the copyright holder nor the names of its
+**   contributors may be used to endorse or promote products derived from this
+**   software without specific prior written permission.
+**
+** THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+** ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+** WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+** DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+** ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+** (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+** LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+** ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+** (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+** SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+**
+**
+** ###################################################################
+*/
+
+
+/*==========================================================================*/
+/* Unit test for the CCM reverse mux map.                                   */
+/*==========================================================================*/
+
+/* Include Config */
+
+/* Includes */
+
+#include <stdio.h>
+#include "dev_sm.h"
+#include "fsl_ccm.h"
+
+/* Local defines */
+
+/* Local types */
+
+/* Local variables */
+
+/* Local functions */
+
+/*--------------------------------------------------------------------------*/
+/* Test CCM reverse mux map against the forward mux table                   */
+/*--------------------------------------------------------------------------*/
+void TEST_DevCcmMux(void)
+{
+    uint32_t errors = 0U;
+    uint32_t muxIdx = 0U;
+
+    printf("TEST_DevCcmMux: Begin reverse mux map tests\n");
+
+    /* Compare every root/source pair with a forward scan */
+    for (uint32_t rootIdx = 0U; rootIdx < CLOCK_NUM_ROOT; rootIdx++)
+    {
+        for (uint32_t srcIdx = 0U; srcIdx < CLOCK_NUM_SRC; srcIdx++)
+        {
+            uint32_t expIdx = CLOCK_NUM_ROOT_MUX_SEL;
+            bool found;
+
+            /* First forward mux input with this source */
+            for (uint32_t idx = 0U; idx < CLOCK_NUM_ROOT_MUX_SEL; idx++)
+            {
+                if (g_clockRootMux[rootIdx][idx] == srcIdx)
+                {
+                    expIdx = idx;
+                    break;
+                }
+            }
+
+            found = CCM_RootMuxSelGet(rootIdx, srcIdx, &muxIdx);
+
+            if (found != (expIdx < CLOCK_NUM_ROOT_MUX_SEL))
+            {
+                printf("  root %u src %u: found %u, expected %u\n",
+                    rootIdx, srcIdx, found ? 1U : 0U,
+                    (expIdx < CLOCK_NUM_ROOT_MUX_SEL) ? 1U : 0U);
+                errors++;
+            }
+            else if (found && (muxIdx != expIdx))
+            {
+                printf("  root %u src %u: mux %u, expected %u\n",
+                    rootIdx, srcIdx, muxIdx, expIdx);
+                errors++;
+            }
+            else
+            {
+                ; /* Match */
+            }
+        }
+    }
+
+    /* Round trip every mux input */
+    for (uint32_t rootIdx = 0U; rootIdx < CLOCK_NUM_ROOT; rootIdx++)
+    {
+        for (uint32_t idx = 0U; idx < CLOCK_NUM_ROOT_MUX_SEL; idx++)
+        {
+            uint32_t srcIdx = 0U;
+            uint32_t muxInput = CLOCK_NUM_SRC;
+
+            if (!CCM_RootMuxInputGet(rootIdx, idx, &srcIdx)
+                || !CCM_RootMuxSelGet(rootIdx, srcIdx, &muxIdx)
+                || !CCM_RootMuxInputGet(rootIdx, muxIdx, &muxInput)
+                || (muxInput != srcIdx))
+            {
+                printf("  root %u mux %u: round trip failed\n", rootIdx,
+                    idx);
+                errors++;
+            }
+        }
+    }
+
+    /* Out of range */
+    if (CCM_RootMuxSelGet(CLOCK_NUM_ROOT, CLOCK_SRC_OSC24M, &muxIdx)
+        || CCM_RootMuxSelGet(CLOCK_ROOT_ADC, CLOCK_NUM_SRC, &muxIdx))
+    {
+        printf("  out of range lookup succeeded\n");
+        errors++;
+    }
+
+    printf("TEST_DevCcmMux: %s (%u errors)\n\n",
+        (errors == 0U) ? "PASS" : "FAIL", errors);
+}
+
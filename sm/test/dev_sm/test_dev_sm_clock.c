@@ -47,6 +47,9 @@
 
 /* Local defines */
 
+/* Iterations of clock rate get benchmark */
+#define TEST_CLOCK_BENCH_ITER  100000U
+
 /* Local types */
 
 /* Local variables */
@@ -66,6 +69,9 @@ void TEST_DevSmClock(void)
     uint32_t mux = 0U;
     uint32_t numMuxes = 0U;
     uint32_t extConfigVal = 0U;
+    uint64_t rates[4];
+    uint32_t numRates = 4U;
+    uint32_t remaining = 0U;
 #endif
 
     /* Device tests */
@@ -130,6 +136,9 @@ void TEST_DevSmClock(void)
                 NECHECK(DEV_SM_ClockMuxGet(clockId, 0U, &mux, &numMuxes),
                     SM_ERR_NOT_SUPPORTED);
                 printf("  numMuxes=%d\n",  numMuxes);
+
+                NECHECK(DEV_SM_ClockRatesGet(clockId, 0U, rates, &numRates,
+                    &remaining), SM_ERR_NOT_SUPPORTED);
             }
             else
             {
@@ -142,6 +151,19 @@ void TEST_DevSmClock(void)
                 /* Pass invalid argument for idx*/
                 NECHECK(DEV_SM_ClockMuxGet(clockId, 1U, &mux, &numMuxes),
                     SM_ERR_OUT_OF_RANGE);
+
+                /* Get first page of discrete rates */
+                numRates = 4U;
+                printf("DEV_SM_ClockRatesGet(%u)\n", clockId);
+                CHECK(DEV_SM_ClockRatesGet(clockId, 0U, rates, &numRates,
+                    &remaining));
+                printf("  numRates=%u\n", numRates);
+                printf("  remaining=%u\n", remaining);
+                BCHECK(numRates == 4U);
+
+                /* Pass invalid argument for idx */
+                NECHECK(DEV_SM_ClockRatesGet(clockId, numRates + remaining,
+                    rates, &numRates, &remaining), SM_ERR_OUT_OF_RANGE);
             }
         }
 #endif
@@ -161,6 +183,186 @@ void TEST_DevSmClock(void)
 #endif
     }
 
+#ifdef SIMU
+    /* Benchmark rate get with cold and warm cache */
+    {
+        uint64_t coldRate[DEV_SM_NUM_CLOCK];
+        uint64_t coldUsec;
+        uint64_t warmUsec;
+        uint64_t start = DEV_SM_Usec64Get();
+
+        /* Cold passes, cache invalidated before each */
+        for (uint32_t iter = 0U; iter < TEST_CLOCK_BENCH_ITER; iter++)
+        {
+            DEV_SM_ClockRateInvalidate(DEV_SM_NUM_CLOCK);
+            for (uint32_t clockId = 0U; clockId < DEV_SM_NUM_CLOCK;
+                clockId++)
+            {
+                (void) DEV_SM_ClockRateGet(clockId, &coldRate[clockId]);
+            }
+        }
+        coldUsec = DEV_SM_Usec64Get() - start;
+
+        /* Warm passes */
+        start = DEV_SM_Usec64Get();
+        for (uint32_t iter = 0U; iter < TEST_CLOCK_BENCH_ITER; iter++)
+        {
+            for (uint32_t clockId = 0U; clockId < DEV_SM_NUM_CLOCK;
+                clockId++)
+            {
+                (void) DEV_SM_ClockRateGet(clockId, &rate);
+            }
+        }
+        warmUsec = DEV_SM_Usec64Get() - start;
+
+        printf("DEV_SM_ClockRateGet() x %u\n", TEST_CLOCK_BENCH_ITER);
+        printf("  coldUsec=%u\n", SM_UINT64_L(coldUsec));
+        printf("  warmUsec=%u\n", SM_UINT64_L(warmUsec));
+
+        /* Cached rates must match uncached */
+        for (uint32_t clockId = 0U; clockId < DEV_SM_NUM_CLOCK; clockId++)
+        {
+            CHECK(DEV_SM_ClockRateGet(clockId, &rate));
+            BCHECK(rate == coldRate[clockId]);
+        }
+    }
+
+    /* Rate change invalidates children */
+    {
+        uint32_t oldParent[DEV_SM_NUM_CLOCK];
+
+        for (uint32_t clockId = 0U; clockId < DEV_SM_NUM_CLOCK; clockId++)
+        {
+            CHECK(DEV_SM_ClockParentGet(clockId, &oldParent[clockId]));
+        }
+
+        /* Chain 0 -> 1 -> 2, clock 3 is a separate root */
+        CHECK(DEV_SM_ClockParentSet(DEV_SM_CLK_1, DEV_SM_CLK_0));
+        CHECK(DEV_SM_ClockParentSet(DEV_SM_CLK_2, DEV_SM_CLK_1));
+        CHECK(DEV_SM_ClockParentSet(DEV_SM_CLK_3, DEV_SM_CLK_3));
+        CHECK(DEV_SM_ClockRateSet(DEV_SM_CLK_0, 150000000U, 0U));
+        CHECK(DEV_SM_ClockRateSet(DEV_SM_CLK_1, 100000000U, 0U));
+        CHECK(DEV_SM_ClockRateGet(DEV_SM_CLK_0, &rate));
+        CHECK(DEV_SM_ClockRateGet(DEV_SM_CLK_1, &rate));
+        BCHECK(rate == 100000000U);
+        CHECK(DEV_SM_ClockRateGet(DEV_SM_CLK_2, &rate));
+        CHECK(DEV_SM_ClockRateGet(DEV_SM_CLK_3, &rate));
+        BCHECK(DEV_SM_ClockRateIsCached(DEV_SM_CLK_1));
+        BCHECK(DEV_SM_ClockRateIsCached(DEV_SM_CLK_2));
+        BCHECK(DEV_SM_ClockRateIsCached(DEV_SM_CLK_3));
+
+        /* Parent change drops child and grandchild, not others */
+        CHECK(DEV_SM_ClockRateSet(DEV_SM_CLK_0, 200000000U, 0U));
+        BCHECK(!DEV_SM_ClockRateIsCached(DEV_SM_CLK_1));
+        BCHECK(!DEV_SM_ClockRateIsCached(DEV_SM_CLK_2));
+        BCHECK(DEV_SM_ClockRateIsCached(DEV_SM_CLK_3));
+        CHECK(DEV_SM_ClockRateGet(DEV_SM_CLK_1, &rate));
+        BCHECK(rate == 100000000U);
+        BCHECK(DEV_SM_ClockRateIsCached(DEV_SM_CLK_1));
+        CHECK(DEV_SM_ClockRateGet(DEV_SM_CLK_0, &rate));
+        BCHECK(rate == 200000000U);
+
+        /* Restore parents */
+        for (uint32_t clockId = 0U; clockId < DEV_SM_NUM_CLOCK; clockId++)
+        {
+            CHECK(DEV_SM_ClockParentSet(clockId, oldParent[clockId]));
+        }
+    }
+#else
+    /* Gated source use count and power down delay */
+    {
+        uint32_t src = DEV_SM_CLK_VIDEOPLL1;
+        uint32_t root = DEV_SM_NUM_CLOCK;
+        uint32_t oldParent = 0U;
+        uint32_t use0 = 0U;
+        uint32_t use = 0U;
+        uint32_t idle = 0U;
+        bool srcOn = false;
+
+        /* Find a disabled root that can select the source */
+        for (uint32_t clockId = CLOCK_NUM_SRC; (clockId < (CLOCK_NUM_SRC
+            + CLOCK_NUM_ROOT)) && (root == DEV_SM_NUM_CLOCK); clockId++)
+        {
+            uint32_t mux = 0U;
+            uint32_t numMuxes = 1U;
+
+            CHECK(DEV_SM_ClockIsEnabled(clockId, &enabled));
+            for (uint32_t idx = 0U; !enabled && (idx < numMuxes); idx++)
+            {
+                if ((DEV_SM_ClockMuxGet(clockId, idx, &mux, &numMuxes)
+                    == SM_ERR_SUCCESS) && (mux == src))
+                {
+                    root = clockId;
+                }
+            }
+        }
+
+        printf("DEV_SM_ClockSrcStateGet(%u)\n", src);
+        CHECK(DEV_SM_ClockSrcStateGet(src, &use0, &idle));
+        CHECK(DEV_SM_ClockIsEnabled(src, &srcOn));
+        printf("  root=%u, use=%u, on=%d\n", root, use0, srcOn);
+
+        if (root < DEV_SM_NUM_CLOCK)
+        {
+            CHECK(DEV_SM_ClockParentGet(root, &oldParent));
+            CHECK(DEV_SM_ClockParentSet(root, src));
+
+            /* Enabling a root acquires and powers up the source */
+            CHECK(DEV_SM_ClockEnable(root, true));
+            CHECK(DEV_SM_ClockSrcStateGet(src, &use, &idle));
+            BCHECK(use == (use0 + 1U));
+            BCHECK(idle == 0U);
+            CHECK(DEV_SM_ClockIsEnabled(src, &enabled));
+            BCHECK(enabled);
+
+            /* Relock syncs source state without changing users */
+            if (use0 == 0U)
+            {
+                CHECK(DEV_SM_ClockRateGet(src, &rate));
+                CHECK(DEV_SM_ClockRateSet(src, rate,
+                    DEV_SM_CLOCK_ROUND_AUTO));
+                CHECK(DEV_SM_ClockSrcStateGet(src, &use, &idle));
+                BCHECK(use == (use0 + 1U));
+            }
+
+            /* Disabling releases, source stays up for the delay */
+            CHECK(DEV_SM_ClockEnable(root, false));
+            CHECK(DEV_SM_ClockSrcStateGet(src, &use, &idle));
+            BCHECK(use == use0);
+            CHECK(DEV_SM_ClockIsEnabled(src, &enabled));
+            BCHECK(enabled);
+
+            /* Unused source powers down when the delay expires */
+            if (!srcOn)
+            {
+                BCHECK(idle != 0U);
+                DEV_SM_ClockTick(idle);
+                CHECK(DEV_SM_ClockSrcStateGet(src, &use, &idle));
+                BCHECK(idle == 0U);
+                CHECK(DEV_SM_ClockIsEnabled(src, &enabled));
+                BCHECK(!enabled);
+            }
+
+            CHECK(DEV_SM_ClockParentSet(root, oldParent));
+        }
+
+        /* Direct request powers down at once when dropped */
+        if (!srcOn)
+        {
+            CHECK(DEV_SM_ClockEnable(src, true));
+            CHECK(DEV_SM_ClockIsEnabled(src, &enabled));
+            BCHECK(enabled);
+            CHECK(DEV_SM_ClockEnable(src, false));
+            CHECK(DEV_SM_ClockIsEnabled(src, &enabled));
+            BCHECK(!enabled);
+        }
+
+        /* Only gated sources have state */
+        NECHECK(DEV_SM_ClockSrcStateGet(DEV_SM_CLK_NOC, &use, &idle),
+            SM_ERR_NOT_SUPPORTED);
+    }
+#endif
+
     /* Test API bounds */
     NECHECK(DEV_SM_ClockNameGet(DEV_SM_NUM_CLOCK, &name, &len),
         SM_ERR_NOT_FOUND);
@@ -170,6 +372,8 @@ void TEST_DevSmClock(void)
 #ifdef SIMU
     NECHECK(DEV_SM_ClockMuxGet(DEV_SM_NUM_CLOCK, 0U, &mux, &numMuxes),
         SM_ERR_NOT_FOUND);
+    NECHECK(DEV_SM_ClockRatesGet(DEV_SM_NUM_CLOCK, 0U, rates, &numRates,
+        &remaining), SM_ERR_NOT_FOUND);
 #endif
 
     NECHECK(DEV_SM_ClockRateSet(DEV_SM_NUM_CLOCK, 0U, 0U),
@@ -94,6 +94,50 @@ void TEST_DevSmPerf(void)
         }
     }
 
+#ifndef SIMU
+    /* Test NoC/bus demand aggregation */
+    {
+        uint32_t vpuLevel = 0U;
+        uint8_t vpuState = DEV_SM_POWER_STATE_OFF;
+        uint64_t baseRate = 0ULL;
+        uint64_t dmdRate = 0ULL;
+        uint64_t offRate = 0ULL;
+
+        CHECK(DEV_SM_PerfLevelGet(DEV_SM_PERF_VPU, &vpuLevel));
+        CHECK(DEV_SM_PowerStateGet(DEV_SM_PD_VPU, &vpuState));
+
+        /* Baseline with VPU powered at the lowest level */
+        CHECK(DEV_SM_PowerStateSet(DEV_SM_PD_VPU, DEV_SM_POWER_STATE_ON));
+        CHECK(DEV_SM_PerfLevelSet(DEV_SM_PERF_VPU, DEV_SM_PERF_LVL_LOW));
+        CHECK(DEV_SM_ClockRateGet(DEV_SM_CLK_NOC, &baseRate));
+
+        /* VPU demand raises NOC */
+        printf("DEV_SM_PerfLevelSet(%u, %u)\n", DEV_SM_PERF_VPU,
+            DEV_SM_PERF_LVL_ODV);
+        CHECK(DEV_SM_PerfLevelSet(DEV_SM_PERF_VPU, DEV_SM_PERF_LVL_ODV));
+        CHECK(DEV_SM_ClockRateGet(DEV_SM_CLK_NOC, &dmdRate));
+        printf("  noc=%u -> %u\n", SM_UINT64_L(baseRate),
+            SM_UINT64_L(dmdRate));
+        BCHECK(dmdRate >= baseRate);
+
+        /* Power down drops VPU demand */
+        printf("DEV_SM_PowerStateSet(%u, off)\n", DEV_SM_PD_VPU);
+        CHECK(DEV_SM_PowerStateSet(DEV_SM_PD_VPU, DEV_SM_POWER_STATE_OFF));
+        CHECK(DEV_SM_ClockRateGet(DEV_SM_CLK_NOC, &offRate));
+        BCHECK(offRate == baseRate);
+
+        /* Power up restores VPU demand */
+        printf("DEV_SM_PowerStateSet(%u, on)\n", DEV_SM_PD_VPU);
+        CHECK(DEV_SM_PowerStateSet(DEV_SM_PD_VPU, DEV_SM_POWER_STATE_ON));
+        CHECK(DEV_SM_ClockRateGet(DEV_SM_CLK_NOC, &offRate));
+        BCHECK(offRate == dmdRate);
+
+        /* Restore */
+        CHECK(DEV_SM_PerfLevelSet(DEV_SM_PERF_VPU, vpuLevel));
+        CHECK(DEV_SM_PowerStateSet(DEV_SM_PD_VPU, vpuState));
+    }
+#endif
+
     /* Test API bounds */
     printf("\n**** Device SM Performance API Err Tests ***\n\n");
 
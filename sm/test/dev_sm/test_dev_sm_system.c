@@ -208,6 +208,26 @@ void TEST_DevSmSystem(void)
             SM_ERR_NOT_FOUND);
         SM_TestModeSet(SM_TEST_MODE_OFF);
     }
+#else
+    /* Sleep plan: A55 core update reloads A55P */
+    {
+        uint32_t wakeVal = 0U;
+
+        printf("DEV_SM_SystemSleepPlanCheck()\n");
+        DEV_SM_SystemSleepPlanUpdate(CPU_IDX_A55P);
+        BCHECK(DEV_SM_SystemSleepPlanCheck());
+
+        /* Change A55P wake mask as the first core start does */
+        BCHECK(CPU_IrqWakeGet(CPU_IDX_A55P, 0U, &wakeVal));
+        BCHECK(CPU_IrqWakeSet(CPU_IDX_A55P, 0U, ~wakeVal));
+        DEV_SM_SystemSleepPlanUpdate(CPU_IDX_A55C1);
+        BCHECK(DEV_SM_SystemSleepPlanCheck());
+
+        /* Restore */
+        BCHECK(CPU_IrqWakeSet(CPU_IDX_A55P, 0U, wakeVal));
+        DEV_SM_SystemSleepPlanUpdate(CPU_IDX_A55C1);
+        BCHECK(DEV_SM_SystemSleepPlanCheck());
+    }
 #endif
 
     printf("\n");
@@ -0,0 +1,227 @@
+/*
+** ###################################################################
+**
+** Copyright 2024 NXP
+**
+** Redistribution and use in source and binary forms, with or without modification,
+** are permitted provided that the following conditions are met:
+**
+** o Redistributions of source code must retain the above copyright notice, this list
+**   of conditions and the following disclaimer.
+**
+** o Redistributions in binary form must reproduce the above copyright notice, this
+**   list of conditions and the following disclaimer in the documentation and/or
+**   other materials provided with the distribution.
+**
+** o Neither the name of the copyright holder nor the names of its
+**   contributors may be used to endorse or promote products derived from this
+**   software without specific prior written permission.
+**
+** THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+** ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+** WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+** DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+** ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+** (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+** LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+** ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+** (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+** SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+**
+**
+** ###################################################################
+*/
+
+
+/*==========================================================================*/
+/* Unit test for the DDR frequency switching.                               */
+/*==========================================================================*/
+
+/* Include Config */
+
+/* Includes */
+
+#include <stdio.h>
+#include "dev_sm.h"
+#include "fsl_ddr.h"
+
+/* Local defines */
+
+#define MBYTE               (1024U * 1024U)
+
+#define MEM_SRC             0x80000000U
+#define TEST_BYTE_CNT       (16U * MBYTE)
+#define TEST_PATTERN        0x01234567U
+
+#define DVFS_LOOP_CNT       4U
+
+/* Local types */
+
+/* Local variables */
+
+/* Local functions */
+
+static uint32_t write_memory(uint32_t start_addr, uint32_t numbytes,
+    uint32_t pattern, uint64_t *usec);
+static uint32_t verify_memory(uint32_t start_addr, uint32_t numbytes,
+    uint32_t pattern, uint64_t *usec);
+
+/*--------------------------------------------------------------------------*/
+/* Test SM driver DDR frequency switching                                   */
+/*--------------------------------------------------------------------------*/
+void TEST_DrvDdrDvfs(void)
+{
+    int32_t status = SM_ERR_SUCCESS;
+    uint32_t numLevels = 0U;
+    uint32_t bootLevel = 0U;
+
+    printf("TEST_DrvDdrDvfs: Begin frequency switching tests\n");
+
+    if (DEV_SM_PerfNumLevelsGet(DEV_SM_PERF_DRAM, &numLevels)
+        != SM_ERR_SUCCESS)
+    {
+        status = SM_ERR_NOT_FOUND;
+    }
+    if (status == SM_ERR_SUCCESS)
+    {
+        status = DEV_SM_PerfLevelGet(DEV_SM_PERF_DRAM, &bootLevel);
+    }
+
+    /* Fill pattern at the boot level */
+    if (status == SM_ERR_SUCCESS)
+    {
+        uint64_t wrUsec;
+
+        (void) write_memory(MEM_SRC, TEST_BYTE_CNT, TEST_PATTERN
+            + bootLevel, &wrUsec);
+    }
+
+    for (uint32_t loop = 0U; (status == SM_ERR_SUCCESS)
+        && (loop < DVFS_LOOP_CNT); loop++)
+    {
+        /* Walk down then up to switch from both directions */
+        for (uint32_t idx = 0U; (status == SM_ERR_SUCCESS)
+            && (idx < numLevels); idx++)
+        {
+            uint32_t level = ((loop % 2U) == 0U) ? (numLevels - idx - 1U)
+                : idx;
+            dev_sm_perf_desc_t desc;
+            uint64_t startUsec, wrUsec, rdUsec;
+            uint32_t switchUsec, errors;
+            uint32_t prevLevel = 0U;
+
+            status = DEV_SM_PerfLevelGet(DEV_SM_PERF_DRAM, &prevLevel);
+
+            /* Switch level */
+            startUsec = DEV_SM_Usec64Get();
+            if (status == SM_ERR_SUCCESS)
+            {
+                status = DEV_SM_PerfLevelSet(DEV_SM_PERF_DRAM, level);
+            }
+            switchUsec = SM_UINT64_L(DEV_SM_Usec64Get() - startUsec);
+
+            if (status == SM_ERR_SUCCESS)
+            {
+                status = DEV_SM_PerfDescribe(DEV_SM_PERF_DRAM, level,
+                    &desc);
+            }
+
+            if (status == SM_ERR_SUCCESS)
+            {
+                /* Data written at the previous level survives switch */
+                errors = verify_memory(MEM_SRC, TEST_BYTE_CNT,
+                    TEST_PATTERN + prevLevel, &rdUsec);
+
+                /* Switch back and verify again */
+                status = DEV_SM_PerfLevelSet(DEV_SM_PERF_DRAM, prevLevel);
+                if (status == SM_ERR_SUCCESS)
+                {
+                    errors += verify_memory(MEM_SRC, TEST_BYTE_CNT,
+                        TEST_PATTERN + prevLevel, &wrUsec);
+                    status = DEV_SM_PerfLevelSet(DEV_SM_PERF_DRAM, level);
+                }
+
+                /* Measure bandwidth, pattern checked after next switch */
+                if (status == SM_ERR_SUCCESS)
+                {
+                    errors += write_memory(MEM_SRC, TEST_BYTE_CNT,
+                        TEST_PATTERN + level, &wrUsec);
+
+                    printf("Level %u (%u KHz, pstate %u): switch %u us"
+                        " (worst %u us), write %u MB/s, read %u MB/s\n",
+                        level, desc.value, DDR_PstateGet(), switchUsec,
+                        desc.latency,
+                        (uint32_t) ((uint64_t) TEST_BYTE_CNT / wrUsec),
+                        (uint32_t) ((uint64_t) TEST_BYTE_CNT / rdUsec));
+                }
+
+                if (errors != 0U)
+                {
+                    printf("Failure: %u data errors\n", errors);
+                    status = SM_ERR_HARDWARE_ERROR;
+                }
+            }
+        }
+    }
+
+    /* Restore boot level */
+    if (DEV_SM_PerfLevelSet(DEV_SM_PERF_DRAM, bootLevel)
+        != SM_ERR_SUCCESS)
+    {
+        status = SM_ERR_HARDWARE_ERROR;
+    }
+
+    printf("TEST_DrvDdrDvfs: %s (status %d)\n\n",
+        (status == SM_ERR_SUCCESS) ? "Passed" : "Failed", status);
+}
+
+/*--------------------------------------------------------------------------*/
+/* Fill pattern into memory                                                 */
+/*--------------------------------------------------------------------------*/
+static uint32_t write_memory(uint32_t start_addr, uint32_t numbytes,
+    uint32_t pattern, uint64_t *usec)
+{
+    uint64_t startUsec = DEV_SM_Usec64Get();
+
+    for (uint32_t i = 0U; i < numbytes; i += 4U)
+    {
+        Write32((start_addr + i), pattern + (i * pattern));
+    }
+
+    /* Bytes per usec is MB/s */
+    *usec = DEV_SM_Usec64Get() - startUsec;
+    if (*usec == 0U)
+    {
+        *usec = 1U;
+    }
+
+    return 0U;
+}
+
+/*--------------------------------------------------------------------------*/
+/* Verify memory                                                            */
+/*--------------------------------------------------------------------------*/
+static uint32_t verify_memory(uint32_t start_addr, uint32_t numbytes,
+    uint32_t pattern, uint64_t *usec)
+{
+    uint32_t errors = 0U;
+    uint64_t startUsec = DEV_SM_Usec64Get();
+
+    for (uint32_t i = 0U; i < numbytes; i += 4U)
+    {
+        if (Read32(start_addr + i) != (pattern + (i * pattern)))
+        {
+            errors++;
+        }
+    }
+
+    /* Bytes per usec is MB/s */
+    *usec = DEV_SM_Usec64Get() - startUsec;
+    if (*usec == 0U)
+    {
+        *usec = 1U;
+    }
+
+    return errors;
+}
+
@@ -42,6 +42,7 @@
 
 #include "test.h"
 #include "lmm.h"
+#include "rpc_scmi.h"
 
 /* Local defines */
 
@@ -168,6 +169,40 @@ void TEST_LmmClock(void)
 #endif
     }
 
+#ifdef SIMU
+    /* Reset restores a changed clock */
+    {
+        uint64_t bootRate = 0ULL;
+
+        printf("LMM_ClockReset(%u, %u) changed\n", lmId, DEV_SM_CLK_1);
+        CHECK(LMM_ClockRateGet(lmId, DEV_SM_CLK_1, &bootRate));
+        CHECK(LMM_ClockRateSet(lmId, DEV_SM_CLK_1, bootRate + 1000ULL,
+            DEV_SM_CLOCK_ROUND_DOWN));
+        CHECK(LMM_ClockRateGet(lmId, DEV_SM_CLK_1, &rate));
+        BCHECK(rate == (bootRate + 1000ULL));
+        CHECK(LMM_ClockReset(lmId, DEV_SM_CLK_1));
+        CHECK(LMM_ClockRateGet(lmId, DEV_SM_CLK_1, &rate));
+        BCHECK(rate == bootRate);
+    }
+
+    /* Reset leaves a clock never changed via the LMM untouched */
+    {
+        uint64_t devRate = 0ULL;
+
+        printf("LMM_ClockReset(%u, %u) unchanged\n", lmId, DEV_SM_CLK_3);
+        CHECK(LMM_ClockIsEnabled(lmId, DEV_SM_CLK_3, &enabled));
+        BCHECK(!enabled);
+        CHECK(DEV_SM_ClockRateGet(DEV_SM_CLK_3, &devRate));
+        CHECK(DEV_SM_ClockRateSet(DEV_SM_CLK_3, devRate + 1000ULL,
+            DEV_SM_CLOCK_ROUND_DOWN));
+        CHECK(LMM_ClockReset(lmId, DEV_SM_CLK_3));
+        CHECK(LMM_ClockRateGet(lmId, DEV_SM_CLK_3, &rate));
+        BCHECK(rate == (devRate + 1000ULL));
+        CHECK(DEV_SM_ClockRateSet(DEV_SM_CLK_3, devRate,
+            DEV_SM_CLOCK_ROUND_DOWN));
+    }
+#endif
+
     /* Test error bounds */
     printf("\n**** LMM Clock API Err Tests ***\n\n");
 
@@ -188,6 +223,109 @@ void TEST_LmmClock(void)
     NECHECK(LMM_ClockExtendedGet(lmId, SM_NUM_CLOCK, 0U, &extCfgValue),
         SM_ERR_NOT_FOUND);
 
+#ifdef SIMU
+    /* Shared state table */
+    printf("\n**** LMM State Table Tests ***\n\n");
+    for (uint32_t lm = 0U; lm < SM_NUM_LM; lm++)
+    {
+        const lmm_state_t *table = LMM_StateTableGet(lm);
+
+        printf("LMM_StateTableGet(%u)\n", lm);
+        if (g_lmmConfig[lm].stateAddr == 0U)
+        {
+            BCHECK(table == NULL);
+        }
+        else
+        {
+            uint32_t seq;
+
+            BCHECK(table != NULL);
+            BCHECK(table->magic == LMM_STATE_MAGIC);
+            BCHECK(table->numClock == SM_NUM_CLOCK);
+
+            /* Update clock and check sequence */
+            seq = table->seq;
+            BCHECK((seq & 1U) == 0U);
+            CHECK(LMM_ClockEnable(lmId, DEV_SM_CLK_0, true));
+            BCHECK(table->seq == (seq + 2U));
+
+            /* Device rate and perf changes reach the table */
+            if (RPC_SCMI_ResourceVisible(g_lmmConfig[lm].rpcInst,
+                SCMI_PROTOCOL_CLOCK, DEV_SM_CLK_0))
+            {
+                CHECK(LMM_ClockRateGet(lmId, DEV_SM_CLK_0, &rate));
+                CHECK(DEV_SM_ClockRateSet(DEV_SM_CLK_0, rate + 1000ULL,
+                    DEV_SM_CLOCK_ROUND_DOWN));
+                BCHECK(table->clockRate[DEV_SM_CLK_0] == (rate + 1000ULL));
+                CHECK(DEV_SM_ClockRateSet(DEV_SM_CLK_0, rate,
+                    DEV_SM_CLOCK_ROUND_DOWN));
+                BCHECK(table->clockRate[DEV_SM_CLK_0] == rate);
+            }
+            if (RPC_SCMI_ResourceVisible(g_lmmConfig[lm].rpcInst,
+                SCMI_PROTOCOL_PERF, DEV_SM_PERF_0))
+            {
+                uint32_t perfLevel = 0U;
+
+                CHECK(DEV_SM_PerfLevelGet(DEV_SM_PERF_0, &perfLevel));
+                CHECK(DEV_SM_PerfLevelSet(DEV_SM_PERF_0, perfLevel + 1U));
+                BCHECK(table->perfLevel[DEV_SM_PERF_0] == (perfLevel + 1U));
+                CHECK(DEV_SM_PerfLevelSet(DEV_SM_PERF_0, perfLevel));
+                BCHECK(table->perfLevel[DEV_SM_PERF_0] == perfLevel);
+            }
+            if (RPC_SCMI_ResourceVisible(g_lmmConfig[lm].rpcInst,
+                SCMI_PROTOCOL_BBM, DEV_SM_RTC_BBNSM))
+            {
+                uint64_t rtcTime = 0ULL;
+
+                /* RTC set reaches the table */
+                CHECK(LMM_BbmRtcTimeGet(lmId, DEV_SM_RTC_BBNSM, &rtcTime,
+                    false));
+                CHECK(LMM_BbmRtcTimeSet(lmId, DEV_SM_RTC_BBNSM,
+                    rtcTime + 100ULL, false));
+                BCHECK(table->rtcTime[DEV_SM_RTC_BBNSM]
+                    == (rtcTime + 100ULL));
+
+                /* Time advance reaches the table on the next tick */
+                CHECK(DEV_SM_BbmRtcTimeSet(DEV_SM_RTC_BBNSM,
+                    rtcTime + 200ULL, false));
+                LMM_Tick(1000U);
+                BCHECK(table->rtcTime[DEV_SM_RTC_BBNSM]
+                    == (rtcTime + 200ULL));
+
+                CHECK(LMM_BbmRtcTimeSet(lmId, DEV_SM_RTC_BBNSM, rtcTime,
+                    false));
+            }
+            else
+            {
+                BCHECK(table->rtcTime[DEV_SM_RTC_BBNSM] == 0ULL);
+            }
+
+            /* Check view of clocks */
+            for (uint32_t clockId = 0U; clockId < SM_NUM_CLOCK; clockId++)
+            {
+                if (RPC_SCMI_ResourceVisible(g_lmmConfig[lm].rpcInst,
+                    SCMI_PROTOCOL_CLOCK, clockId))
+                {
+                    CHECK(LMM_ClockIsEnabled(lmId, clockId, &enabled));
+                    CHECK(LMM_ClockRateGet(lmId, clockId, &rate));
+                    BCHECK(table->clockEnable[clockId]
+                        == (enabled ? 1U : 0U));
+                    BCHECK(table->clockRate[clockId] == rate);
+                }
+                else
+                {
+                    BCHECK(table->clockEnable[clockId] == LMM_STATE_NONE);
+                    BCHECK(table->clockRate[clockId] == 0ULL);
+                }
+            }
+
+            CHECK(LMM_ClockEnable(lmId, DEV_SM_CLK_0, false));
+            BCHECK((table->seq & 1U) == 0U);
+        }
+    }
+    BCHECK(LMM_StateTableGet(SM_NUM_LM) == NULL);
+#endif
+
     printf("\n");
 }
 
@@ -71,6 +71,20 @@ void TEST_LmmSys(void)
             SM_ERR_INVALID_PARAMETERS);
     }
 
+    /* LmNameGet */
+    {
+        string name;
+        int32_t len = 0;
+
+        printf("LMM_LmNameGet()\n");
+        for (uint32_t lm = 0U; lm < SM_NUM_LM; lm++)
+        {
+            CHECK(LMM_LmNameGet(0U, lm, &name, &len));
+            BCHECK(DEV_SM_StrLen(name) <= len);
+        }
+        BCHECK(len == (int32_t) SM_LM_MAX_NAME_LEN);
+    }
+
 #ifdef SIMU
     /* SystemRstComp */
     {
@@ -41,9 +41,16 @@
 /* Includes */
 
 #include "test_scmi.h"
+#include "rpc_scmi.h"
+#include "rpc_scmi_internal.h"
+#include "rpc_smt.h"
+#include "config_smt.h"
 
 /* Local defines */
 
+/* Messages sent to check SMT poll stats */
+#define TEST_SMT_POLL_MSGS  4U
+
 /* Local types */
 
 /* Local variables */
@@ -75,6 +82,20 @@ void TEST_ScmiBase(void)
 
         BCHECK(ver == SCMI_BASE_PROT_VER);
 
+        /* Repeat is served from the response image */
+        {
+            uint32_t agent =
+                g_scmiChannelConfig[SM_TEST_DEFAULT_CHN].agentId;
+            scmi_agent_stats_t before, after;
+
+            CHECK(RPC_SCMI_AgentStatsGet(agent, &before));
+            ver = 0U;
+            CHECK(SCMI_BaseProtocolVersion(SM_TEST_DEFAULT_CHN, &ver));
+            BCHECK(ver == SCMI_BASE_PROT_VER);
+            CHECK(RPC_SCMI_AgentStatsGet(agent, &after));
+            BCHECK(after.imageHit == (before.imageHit + 1U));
+        }
+
         printf("SCMI_BaseNegotiateProtocolVersion(%u)\n", SM_TEST_DEFAULT_CHN);
         CHECK(SCMI_BaseNegotiateProtocolVersion(SM_TEST_DEFAULT_CHN,
             SCMI_BASE_PROT_VER));
@@ -87,6 +108,21 @@ void TEST_ScmiBase(void)
         CHECK(SCMI_BaseProtocolMessageAttributes(SM_TEST_DEFAULT_CHN,
             SCMI_MSG_BASE_DISCOVER_VENDOR, NULL));
 
+        /* Repeat is served from a keyed response image */
+        {
+            uint32_t agent =
+                g_scmiChannelConfig[SM_TEST_DEFAULT_CHN].agentId;
+            scmi_agent_stats_t before, after;
+            uint32_t attributes = 0xFFFFFFFFU;
+
+            CHECK(RPC_SCMI_AgentStatsGet(agent, &before));
+            CHECK(SCMI_BaseProtocolMessageAttributes(SM_TEST_DEFAULT_CHN,
+                SCMI_MSG_BASE_DISCOVER_VENDOR, &attributes));
+            BCHECK(attributes == 0U);
+            CHECK(RPC_SCMI_AgentStatsGet(agent, &after));
+            BCHECK(after.imageHit == (before.imageHit + 1U));
+        }
+
         NCHECK(SCMI_BaseProtocolMessageAttributes(SM_TEST_DEFAULT_CHN,
             30U, NULL));
     }
@@ -94,12 +130,21 @@ void TEST_ScmiBase(void)
     /* Test vendor */
     {
         uint8_t name[SCMI_BASE_MAX_VENDORIDENTIFIER];
+        uint8_t name2[SCMI_BASE_MAX_VENDORIDENTIFIER] = { 0 };
 
         printf("SCMI_BaseDiscoverVendor(%u)\n", SM_TEST_DEFAULT_CHN);
         name[0] = 0U;
         CHECK(SCMI_BaseDiscoverVendor(SM_TEST_DEFAULT_CHN, name));
         printf("  name=%s\n",  name);
 
+        /* Repeat is served from the response image */
+        CHECK(SCMI_BaseDiscoverVendor(SM_TEST_DEFAULT_CHN, name2));
+        for (uint32_t idx = 0U; (idx < SCMI_BASE_MAX_VENDORIDENTIFIER)
+            && (name[idx] != 0U); idx++)
+        {
+            BCHECK(name[idx] == name2[idx]);
+        }
+
         /* Branch -- Invalid Channel */
         NECHECK(SCMI_BaseDiscoverVendor(SM_SCMI_NUM_CHN, name),
             SCMI_ERR_INVALID_PARAMETERS);
@@ -194,6 +239,132 @@ void TEST_ScmiBase(void)
             NULL, NULL));
     }
 
+    /* SMT adaptive poll stats */
+    if (g_scmiChannelConfig[SM_TEST_DEFAULT_CHN].xportType == SM_XPORT_SMT)
+    {
+        uint32_t smtChannel =
+            g_scmiChannelConfig[SM_TEST_DEFAULT_CHN].xportChannel;
+        rpc_smt_stats_t before, after;
+        uint32_t ver = 0U;
+
+        printf("RPC_SMT_StatsGet(%u)\n", smtChannel);
+        CHECK(RPC_SMT_StatsGet(smtChannel, &before));
+
+        /* Each serviced message enters poll mode if a window is set */
+        for (uint32_t msg = 0U; msg < TEST_SMT_POLL_MSGS; msg++)
+        {
+            CHECK(SCMI_BaseProtocolVersion(SM_TEST_DEFAULT_CHN, &ver));
+        }
+
+        CHECK(RPC_SMT_StatsGet(smtChannel, &after));
+        BCHECK((after.dispatch - before.dispatch) >= TEST_SMT_POLL_MSGS);
+#ifdef SIMU
+        /* Simu default channel has a poll window (poll=2) */
+        BCHECK(((after.pollHit + after.pollMiss)
+            - (before.pollHit + before.pollMiss)) >= TEST_SMT_POLL_MSGS);
+#endif
+        printf("  dispatch=%u, hit=%u, miss=%u\n", after.dispatch,
+            after.pollHit, after.pollMiss);
+
+        /* Branch -- Invalid Channel */
+        NECHECK(RPC_SMT_StatsGet(SM_NUM_SMT_CHN, &after),
+            SM_ERR_OUT_OF_RANGE);
+    }
+
+    /* Agent load stats */
+    {
+        uint32_t agent = g_scmiChannelConfig[SM_TEST_DEFAULT_CHN].agentId;
+        scmi_agent_stats_t before, after;
+        uint32_t ver = 0U;
+
+        printf("RPC_SCMI_AgentStatsGet(%u)\n", agent);
+        CHECK(RPC_SCMI_AgentStatsGet(agent, &before));
+        CHECK(SCMI_BaseProtocolVersion(SM_TEST_DEFAULT_CHN, &ver));
+        CHECK(RPC_SCMI_AgentStatsGet(agent, &after));
+        BCHECK(after.msgCount == (before.msgCount + 1U));
+        BCHECK(after.cpuTime >= before.cpuTime);
+        BCHECK(after.rateBusy == before.rateBusy);
+        BCHECK(after.cpuBusy == before.cpuBusy);
+        printf("  msgs=%u, cpuMax=%uus\n", after.msgCount,
+            after.cpuTimeMax);
+
+        /* Branch -- Invalid Agent */
+        NECHECK(RPC_SCMI_AgentStatsGet(SM_SCMI_NUM_AGNT, &after),
+            SM_ERR_OUT_OF_RANGE);
+    }
+
+    /* Agent message rate limit */
+    for (uint32_t chn = 0U; chn < SM_NUM_TEST_CHN; chn++)
+    {
+        uint32_t agent = g_scmiChannelConfig[chn].agentId;
+        uint32_t rate = g_scmiAgentConfig[agent].msgRate;
+        uint32_t burst = g_scmiAgentConfig[agent].msgBurst;
+        scmi_agent_stats_t before, after;
+        int32_t rateStatus = SM_ERR_SUCCESS;
+        uint32_t ver = 0U;
+        uint64_t start;
+
+        /* Skip channels without a rate limit */
+        if ((g_scmiChannelConfig[chn].type != SM_SCMI_CHN_A2P)
+            || (rate == 0U))
+        {
+            continue;
+        }
+        if (burst == 0U)
+        {
+            burst = rate;
+        }
+
+        printf("SCMI message rate(%u): rate=%u, burst=%u\n", chn,
+            rate, burst);
+        CHECK(RPC_SCMI_AgentStatsGet(agent, &before));
+
+        /* Send more messages than the burst allows */
+        for (uint32_t msg = 0U; msg <= burst; msg++)
+        {
+            rateStatus = SCMI_BaseProtocolVersion(chn, &ver);
+            if (rateStatus != SM_ERR_SUCCESS)
+            {
+                break;
+            }
+        }
+        BCHECK(rateStatus == SM_ERR_BUSY);
+        CHECK(RPC_SCMI_AgentStatsGet(agent, &after));
+        BCHECK(after.rateBusy == (before.rateBusy + 1U));
+
+        /* Wait for one refill interval */
+        start = DEV_SM_Usec64Get();
+        while ((DEV_SM_Usec64Get() - start) <= (1000000U / rate))
+        {
+            ; /* Intentional empty while */
+        }
+
+        /* Check recovery */
+        CHECK(SCMI_BaseProtocolVersion(chn, &ver));
+    }
+
+    /* Owned resource bit array walk */
+    {
+        BITARRAY_DEC(owned, 40U) = { 0 };
+        uint32_t idx;
+
+        printf("RPC_SCMI_BitArrayNext()\n");
+        BCHECK(RPC_SCMI_BitArrayNext(owned, 40U, 0U) == 40U);
+        BITARRAY_SET(owned, 3U);
+        BITARRAY_SET(owned, 17U);
+        BITARRAY_SET(owned, 39U);
+        idx = RPC_SCMI_BitArrayNext(owned, 40U, 0U);
+        BCHECK(idx == 3U);
+        idx = RPC_SCMI_BitArrayNext(owned, 40U, idx + 1U);
+        BCHECK(idx == 17U);
+        idx = RPC_SCMI_BitArrayNext(owned, 40U, idx + 1U);
+        BCHECK(idx == 39U);
+        BCHECK(RPC_SCMI_BitArrayNext(owned, 40U, idx + 1U) == 40U);
+        BITARRAY_CLR(owned, 17U);
+        BCHECK(RPC_SCMI_BitArrayNext(owned, 40U, 4U) == 39U);
+        BCHECK(RPC_SCMI_BitArrayNext(owned, 39U, 4U) == 39U);
+    }
+
     /* Loop over base test agents */
     status = TEST_ConfigFirstGet(TEST_BASE, &agentId,
         &channel, &resource, &lmId);
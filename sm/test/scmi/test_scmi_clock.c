@@ -42,6 +42,7 @@
 
 #include "test_scmi.h"
 #include "lmm.h"
+#include "smt.h"
 
 /* Local defines */
 
@@ -187,6 +188,19 @@ void TEST_ScmiClock(void)
             rates), SCMI_ERR_NOT_FOUND);
     }
 
+    /* Test notify for invalid clock and invalid channel */
+    {
+        uint32_t notifyEnable = SCMI_CLOCK_NOTIFY_ENABLE(1U);
+
+        NECHECK(SCMI_ClockRateNotify(SM_TEST_DEFAULT_CHN, numClocks,
+            notifyEnable), SCMI_ERR_NOT_FOUND);
+        NECHECK(SCMI_ClockRateChangeRequestedNotify(SM_TEST_DEFAULT_CHN,
+            numClocks, notifyEnable), SCMI_ERR_NOT_FOUND);
+
+        NECHECK(SCMI_ClockRateNotify(SM_SCMI_NUM_CHN, numClocks,
+            notifyEnable), SCMI_ERR_INVALID_PARAMETERS);
+    }
+
     /* Test coverage of exceeding max amount of clocks in
        ClockParentSet and invalid channel */
     {
@@ -224,6 +238,41 @@ void TEST_ScmiClock(void)
             0U, &numParent, &parents), SCMI_ERR_INVALID_PARAMETERS);
     }
 
+    /* Discrete rate lists only if short enough, else range */
+    for (uint32_t clk = 0U; clk < numClocks; clk++)
+    {
+        uint32_t numRatesFlags = 0U;
+        scmi_clock_rate_t rates[SCMI_CLOCK_MAX_RATES] = { 0 };
+        uint64_t lmRates[1];
+        uint32_t numRates = 1U;
+        uint32_t remaining = 0U;
+        bool discrete = false;
+        bool snap = false;
+
+        if (LMM_ClockRatesGet(0U, clk, 0U, lmRates, &numRates,
+            &remaining) == SM_ERR_SUCCESS)
+        {
+            discrete = (numRates + remaining) <= 16U;
+            snap = !discrete;
+        }
+
+        printf("SCMI_ClockDescribeRates(%u, %u)\n", SM_TEST_DEFAULT_CHN,
+            clk);
+        CHECK(SCMI_ClockDescribeRates(SM_TEST_DEFAULT_CHN, clk, 0U,
+            &numRatesFlags, rates));
+        printf("  format=%u\n",
+            SCMI_CLOCK_NUM_RATE_FLAGS_FORMAT(numRatesFlags));
+        BCHECK(SCMI_CLOCK_NUM_RATE_FLAGS_FORMAT(numRatesFlags)
+            == (discrete ? 0U : 1U));
+
+        /* Long lists return a range snapped to reachable rates */
+        if (snap)
+        {
+            BCHECK(rates[0].lower == SM_UINT64_L(lmRates[0]));
+            BCHECK(rates[0].upper == SM_UINT64_H(lmRates[0]));
+        }
+    }
+
     /* Branch coverage */
     {
         uint32_t permissions = 0U;
@@ -299,8 +348,44 @@ static void TEST_ScmiClockNone(uint32_t channel, uint32_t clockId)
     printf("  remainingRates=%u\n",
         SCMI_CLOCK_NUM_RATE_FLAGS_REMAING_RATES(numRatesFlags));
 
-    NECHECK(SCMI_ClockDescribeRates(channel, clockId, 2U,
-        &numRatesFlags, rates), SCMI_ERR_OUT_OF_RANGE);
+    /* Walk all pages of discrete rates */
+    if (SCMI_CLOCK_NUM_RATE_FLAGS_FORMAT(numRatesFlags) == 0U)
+    {
+        uint32_t rateIndex = 0U;
+        uint64_t prevRate = 0ULL;
+
+        do
+        {
+            CHECK(SCMI_ClockDescribeRates(channel, clockId, rateIndex,
+                &numRatesFlags, rates));
+            BCHECK(SCMI_CLOCK_NUM_RATE_FLAGS_NUM_RATES(numRatesFlags)
+                != 0U);
+
+            /* Check ascending order */
+            for (uint32_t idx = 0U; idx
+                < SCMI_CLOCK_NUM_RATE_FLAGS_NUM_RATES(numRatesFlags); idx++)
+            {
+                uint64_t rate = (((uint64_t) rates[idx].upper) << 32U)
+                    | rates[idx].lower;
+
+                BCHECK(rate > prevRate);
+                prevRate = rate;
+            }
+
+            rateIndex += SCMI_CLOCK_NUM_RATE_FLAGS_NUM_RATES(numRatesFlags);
+        }
+        while (SCMI_CLOCK_NUM_RATE_FLAGS_REMAING_RATES(numRatesFlags)
+            != 0U);
+        printf("  totalRates=%u\n", rateIndex);
+
+        NECHECK(SCMI_ClockDescribeRates(channel, clockId, rateIndex,
+            &numRatesFlags, rates), SCMI_ERR_OUT_OF_RANGE);
+    }
+    else
+    {
+        NECHECK(SCMI_ClockDescribeRates(channel, clockId, 1U,
+            &numRatesFlags, rates), SCMI_ERR_OUT_OF_RANGE);
+    }
 
     NECHECK(SCMI_ClockDescribeRates(SM_SCMI_NUM_CHN, clockId, 0U,
         &numRatesFlags, rates), SCMI_ERR_INVALID_PARAMETERS);
@@ -444,6 +529,63 @@ static void TEST_ScmiClockExclusive(bool pass, uint32_t channel,
     }
 
 #ifdef SIMU
+    /* Test rate set with notifications */
+    if (pass)
+    {
+        uint32_t notifyEnable = SCMI_CLOCK_NOTIFY_ENABLE(1U);
+        scmi_clock_rate_t newRate = {40000000U, 0U};
+        scmi_clock_rate_t rateRx = {0U, 0U};
+        uint32_t agentId = 0U;
+        uint32_t selfId = SCMI_BASE_ID_DISCOVER;
+        uint32_t clockIdRx = 0U;
+
+        /* Get own agent ID */
+        CHECK(SCMI_BaseDiscoverAgent(channel, &selfId, NULL));
+
+        /* Enable notifications */
+        printf("SCMI_ClockRateNotify(%u, %u, 1)\n", channel, clockId);
+        CHECK(SCMI_ClockRateNotify(channel, clockId, notifyEnable));
+        printf("SCMI_ClockRateChangeRequestedNotify(%u, %u, 1)\n",
+            channel, clockId);
+        CHECK(SCMI_ClockRateChangeRequestedNotify(channel, clockId,
+            notifyEnable));
+
+        /* Change rate */
+        flags = SCMI_CLOCK_RATE_FLAGS_ROUND(SCMI_CLOCK_ROUND_DOWN);
+        printf("SCMI_ClockRateSet(%u, %u, 0x%08X, %u)\n", channel,
+            clockId, flags, newRate.lower);
+        CHECK(SCMI_ClockRateSet(channel, clockId, flags, newRate));
+
+        /* Change requested notification */
+        printf("SCMI_ClockRateChangeRequested(%u)\n", channel + 1U);
+        CHECK(SCMI_ClockRateChangeRequested(channel + 1U, &agentId,
+            &clockIdRx, &rateRx));
+        BCHECK(agentId == selfId);
+        BCHECK(clockIdRx == clockId);
+        BCHECK(rateRx.lower == newRate.lower);
+
+        /* Changed notification */
+        printf("SCMI_ClockRateChanged(%u)\n", channel + 1U);
+        CHECK(SCMI_ClockRateChanged(channel + 1U, &agentId,
+            &clockIdRx, &rateRx));
+        BCHECK(agentId == selfId);
+        BCHECK(clockIdRx == clockId);
+        BCHECK(rateRx.lower == newRate.lower);
+
+        /* Platform change reports agent 0 */
+        printf("LMM_ClockRateSet(%u, %u)\n", lmId, clockId);
+        CHECK(LMM_ClockRateSet(lmId, clockId, 20000000ULL, 0U));
+        printf("SCMI_ClockRateChanged(%u)\n", channel + 1U);
+        CHECK(SCMI_ClockRateChanged(channel + 1U, &agentId,
+            &clockIdRx, &rateRx));
+        BCHECK(agentId == 0U);
+        BCHECK(clockIdRx == clockId);
+
+        /* Disable notifications */
+        CHECK(SCMI_ClockRateNotify(channel, clockId, 0U));
+        CHECK(SCMI_ClockRateChangeRequestedNotify(channel, clockId, 0U));
+    }
+
     /* Reset Config */
     if (pass)
     {
@@ -476,6 +618,15 @@ static void TEST_ScmiClockExclusive(bool pass, uint32_t channel,
             SCMI_CLOCK_ATTR_ENABLED(attributes));
 
         BCHECK(SCMI_CLOCK_ATTR_ENABLED(attributes) == 0U);
+
+        /* Reset restarts the notification sequence */
+        {
+            uint32_t sequences[SMT_MAX_CHN];
+
+            SCMI_SequenceSave(sequences);
+            sequences[channel + 1U] = 0U;
+            SCMI_SequenceRestore(sequences);
+        }
     }
 #endif
 
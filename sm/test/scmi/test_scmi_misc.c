@@ -43,6 +43,7 @@
 #include "test_scmi.h"
 #include "lmm.h"
 #include "rpc_scmi_misc.h"
+#include "trace.h"
 
 /* Local defines */
 
@@ -240,7 +241,7 @@ void TEST_ScmiMisc(void)
     {
         uint32_t flags = 0x0U, logIndex = 0U;
         uint32_t numLogFlags = 0U;
-        uint32_t sysLog[16];
+        uint32_t sysLog[SCMI_MISC_MAX_SYSLOG];
 
         printf("SCMI_MiscSyslog(%u)\n", SM_TEST_DEFAULT_CHN);
         CHECK(SCMI_MiscSyslog(SM_TEST_DEFAULT_CHN, flags, logIndex,
@@ -259,6 +260,164 @@ void TEST_ScmiMisc(void)
         /*sysLog = NULL */
         CHECK(SCMI_MiscSyslog(SM_TEST_DEFAULT_CHN, flags, logIndex,
             &numLogFlags, NULL));
+
+        /* Page through the whole log */
+        {
+            const dev_sm_syslog_t *syslog;
+            uint32_t len = 0U;
+            uint32_t total = 0U;
+
+            CHECK(SM_SYSLOGGET(flags, &syslog, &len));
+            do
+            {
+                CHECK(SCMI_MiscSyslog(SM_TEST_DEFAULT_CHN, flags, total,
+                    &numLogFlags, &sysLog[0]));
+                BCHECK(SCMI_MISC_NUM_LOG_FLAGS_NUM_LOGS(numLogFlags)
+                    <= SCMI_MISC_MAX_SYSLOG);
+                BCHECK(sysLog[0] == ((const uint32_t*) syslog)[total]);
+                total += SCMI_MISC_NUM_LOG_FLAGS_NUM_LOGS(numLogFlags);
+            }
+            while (SCMI_MISC_NUM_LOG_FLAGS_REMAING_LOGS(numLogFlags) != 0U);
+            BCHECK(total == (len / 4U));
+        }
+    }
+
+    /* MiscDiscoverResources */
+    {
+        uint32_t index = 0U;
+        uint32_t numRecordFlags = 0U;
+        uint32_t nextIndex = 0U;
+        uint32_t total = 0U;
+        scmi_misc_record_t records[SCMI_MISC_MAX_RECORD];
+
+        printf("SCMI_MiscDiscoverResources(%u)\n", SM_TEST_DEFAULT_CHN);
+
+        /* Scan all clocks */
+        do
+        {
+            CHECK(SCMI_MiscDiscoverResources(SM_TEST_DEFAULT_CHN,
+                SCMI_PROTOCOL_CLOCK, index, &numRecordFlags, &nextIndex,
+                records));
+            BCHECK(SCMI_MISC_NUM_REC_FLAGS_NUM_RECS(numRecordFlags)
+                <= SCMI_MISC_MAX_RECORD);
+            BCHECK(nextIndex > index);
+            for (uint32_t rec = 0U;
+                rec < SCMI_MISC_NUM_REC_FLAGS_NUM_RECS(numRecordFlags);
+                rec++)
+            {
+                BCHECK(SCMI_MISC_REC_ATTR_ID(records[rec].attributes)
+                    >= index);
+                BCHECK(SCMI_MISC_REC_ATTR_ID(records[rec].attributes)
+                    < nextIndex);
+                BCHECK(SCMI_MISC_REC_ATTR_PERM(records[rec].attributes)
+                    != SM_SCMI_PERM_NONE);
+                BCHECK(records[rec].attrHigh == 0U);
+            }
+            total += SCMI_MISC_NUM_REC_FLAGS_NUM_RECS(numRecordFlags);
+            index = nextIndex;
+        }
+        while (SCMI_MISC_NUM_REC_FLAGS_REMAINING_IDS(numRecordFlags) != 0U);
+        printf("  clocks=%u\n", total);
+        BCHECK(index == SM_NUM_CLOCK);
+        BCHECK(total <= SM_NUM_CLOCK);
+
+        /* Attributes match the clock attributes message */
+        if (SCMI_MISC_NUM_REC_FLAGS_NUM_RECS(numRecordFlags) != 0U)
+        {
+            uint32_t attributes = 0U;
+
+            CHECK(SCMI_ClockAttributes(SM_TEST_DEFAULT_CHN,
+                SCMI_MISC_REC_ATTR_ID(records[0].attributes), &attributes,
+                NULL));
+            BCHECK(records[0].attrLow == attributes);
+        }
+
+        /* Pins */
+        CHECK(SCMI_MiscDiscoverResources(SM_TEST_DEFAULT_CHN,
+            SCMI_PROTOCOL_PINCTRL, 0U, NULL, NULL, NULL));
+
+        /* Invalid channel */
+        NECHECK(SCMI_MiscDiscoverResources(SM_NUM_TEST_CHN,
+            SCMI_PROTOCOL_CLOCK, 0U, &numRecordFlags, &nextIndex,
+            records), SCMI_ERR_INVALID_PARAMETERS);
+
+        /* Invalid protocol */
+        NECHECK(SCMI_MiscDiscoverResources(SM_TEST_DEFAULT_CHN,
+            SCMI_PROTOCOL_MISC, 0U, &numRecordFlags, &nextIndex,
+            records), SCMI_ERR_NOT_SUPPORTED);
+
+        /* Invalid index */
+        NECHECK(SCMI_MiscDiscoverResources(SM_TEST_DEFAULT_CHN,
+            SCMI_PROTOCOL_POWER, SM_NUM_POWER, &numRecordFlags,
+            &nextIndex, records), SCMI_ERR_INVALID_PARAMETERS);
+    }
+
+    /* MiscTraceGet */
+    {
+        uint32_t index;
+        uint32_t numTraceFlags = 0U;
+        uint32_t nextIndex = 0U;
+        uint32_t total = 0U;
+        scmi_misc_trace_t records[SCMI_MISC_MAX_TRACE];
+        trace_rec_t rec;
+
+        printf("SCMI_MiscTraceGet(%u)\n", SM_TEST_DEFAULT_CHN);
+
+        /* Record a known event and read it back */
+        TRACE_Record(SM_TRACE_CAT_LMM, 0xFFU, 0x1234U, 0xCAFEF00DU);
+        index = TRACE_IndexGet() - 1U;
+        CHECK(TRACE_Get(index, &rec));
+        BCHECK(rec.arg == 0xCAFEF00DU);
+        NECHECK(TRACE_Get(index + 1U, &rec), SM_ERR_NOT_FOUND);
+        CHECK(SCMI_MiscTraceGet(SM_TEST_DEFAULT_CHN, index, &numTraceFlags,
+            &nextIndex, records));
+        BCHECK(SCMI_MISC_NUM_TRACE_FLAGS_NUM_RECS(numTraceFlags) >= 1U);
+        BCHECK(SCMI_MISC_NUM_TRACE_FLAGS_LOST(numTraceFlags) == 0U);
+        BCHECK(SM_TRACE_EVENT_CAT(records[0].event) == SM_TRACE_CAT_LMM);
+        BCHECK(SM_TRACE_EVENT_ID(records[0].event) == 0xFFU);
+        BCHECK(SM_TRACE_EVENT_ARG(records[0].event) == 0x1234U);
+        BCHECK(records[0].arg == 0xCAFEF00DU);
+
+        /* Wrap the ring */
+        for (uint32_t idx = 0U; idx <= SM_TRACE_NUM; idx++)
+        {
+            TRACE_Record(SM_TRACE_CAT_LMM, 0xFFU, idx, 0U);
+        }
+        NECHECK(TRACE_Get(index, &rec), SM_ERR_NOT_FOUND);
+
+        /* Read all from the start, oldest are lost */
+        index = 0U;
+        do
+        {
+            CHECK(SCMI_MiscTraceGet(SM_TEST_DEFAULT_CHN, index,
+                &numTraceFlags, &nextIndex, records));
+            BCHECK(SCMI_MISC_NUM_TRACE_FLAGS_NUM_RECS(numTraceFlags)
+                <= SCMI_MISC_MAX_TRACE);
+            if (index == 0U)
+            {
+                BCHECK(SCMI_MISC_NUM_TRACE_FLAGS_LOST(numTraceFlags)
+                    == 1U);
+            }
+            total += SCMI_MISC_NUM_TRACE_FLAGS_NUM_RECS(numTraceFlags);
+            index = nextIndex;
+        }
+        while (SCMI_MISC_NUM_TRACE_FLAGS_REMAINING(numTraceFlags) != 0U);
+        printf("  records=%u\n", total);
+        BCHECK(total >= SM_TRACE_NUM);
+
+        /* Invalid index */
+        NECHECK(SCMI_MiscTraceGet(SM_TEST_DEFAULT_CHN, TRACE_IndexGet()
+            + SM_TRACE_NUM, &numTraceFlags, &nextIndex, records),
+            SCMI_ERR_INVALID_PARAMETERS);
+
+        /* Invalid channel */
+        NECHECK(SCMI_MiscTraceGet(SM_NUM_TEST_CHN, 0U, NULL, NULL, NULL),
+            SCMI_ERR_INVALID_PARAMETERS);
+
+        /* Clear */
+        TRACE_Clear();
+        CHECK(SCMI_MiscTraceGet(SM_TEST_DEFAULT_CHN, 0U, &numTraceFlags,
+            NULL, NULL));
     }
 
     /* RPC_00370 Test ROM data */
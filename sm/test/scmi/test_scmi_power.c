@@ -42,6 +42,7 @@
 
 #include "test_scmi.h"
 #include "lmm.h"
+#include "smt.h"
 
 /* Local defines */
 
@@ -262,18 +263,70 @@ static void TEST_ScmiPowerSet(bool pass, uint32_t channel,
             BCHECK(powerState == SCMI_POWER_DOMAIN_STATE_OFF);
         }
 
+        /* Test async power set with notifications */
+        {
+            uint32_t flags = SCMI_POWER_FLAGS_ASYNC(1U);
+            uint32_t notifyEnable = SCMI_POWER_NOTIFY_ENABLE(1U);
+            uint32_t agentId = 0U;
+            uint32_t domainIdRx = 0U;
+            uint32_t powerState = 0U;
+
+            /* Enable notifications */
+            printf("SCMI_PowerStateNotify(%u, %u, 1)\n", channel,
+                domainId);
+            CHECK(SCMI_PowerStateNotify(channel, domainId, notifyEnable));
+            printf("SCMI_PowerStateChangeRequestedNotify(%u, %u, 1)\n",
+                channel, domainId);
+            CHECK(SCMI_PowerStateChangeRequestedNotify(channel, domainId,
+                notifyEnable));
+
+            /* Async power on */
+            printf("SCMI_PowerStateSet(%u, %u, 0x1, STATE_ON)\n",
+                channel, domainId);
+            CHECK(SCMI_PowerStateSet(channel, domainId, flags,
+                SCMI_POWER_DOMAIN_STATE_ON));
+
+            /* Change requested notification */
+            printf("SCMI_PowerStateChangeRequested(%u)\n", channel + 1U);
+            CHECK(SCMI_PowerStateChangeRequested(channel + 1U, &agentId,
+                &domainIdRx, &powerState));
+            BCHECK(domainIdRx == domainId);
+            BCHECK(powerState == SCMI_POWER_DOMAIN_STATE_ON);
+
+            /* Changed notification */
+            printf("SCMI_PowerStateChanged(%u)\n", channel + 1U);
+            CHECK(SCMI_PowerStateChanged(channel + 1U, &agentId,
+                &domainIdRx, &powerState));
+            BCHECK(domainIdRx == domainId);
+            BCHECK(powerState == SCMI_POWER_DOMAIN_STATE_ON);
+
+            /* Delayed response */
+            printf("SCMI_PowerStateSetComplete(%u)\n", channel + 1U);
+            CHECK(SCMI_PowerStateSetComplete(channel + 1U, &domainIdRx));
+            BCHECK(domainIdRx == domainId);
+
+            printf("SCMI_PowerStateGet(%u, %u)\n", channel, domainId);
+            CHECK(SCMI_PowerStateGet(channel, domainId, &powerState));
+            BCHECK(powerState == SCMI_POWER_DOMAIN_STATE_ON);
+
+            /* Disable notifications */
+            CHECK(SCMI_PowerStateNotify(channel, domainId, 0U));
+            CHECK(SCMI_PowerStateChangeRequestedNotify(channel, domainId,
+                0U));
+        }
+
         /* Test power Set ON */
         printf("SCMI_PowerStateSet(%u, %u, 0, STATE_ON)\n",
             channel, domainId);
         CHECK(SCMI_PowerStateSet(channel, domainId,
             0U, SCMI_POWER_DOMAIN_STATE_ON));
 
-        /* Test PowerStateSet for invalid async flag */
+        /* Test async PowerStateSet for invalid state */
         {
             uint32_t flags = SCMI_POWER_FLAGS_ASYNC(1U);
 
             NCHECK(SCMI_PowerStateSet(channel, domainId,
-                flags, SCMI_POWER_DOMAIN_STATE_ON));
+                flags, 6U));
         }
 
         /* Get Power State ON */
@@ -293,6 +346,15 @@ static void TEST_ScmiPowerSet(bool pass, uint32_t channel,
         printf("LMM_SystemLmBoot(%u, %u)\n", 0U, lmId);
         CHECK(LMM_SystemLmBoot(0U, 0U, lmId, &g_swReason));
 
+        /* Reset restarts the notification sequence */
+        {
+            uint32_t sequences[SMT_MAX_CHN];
+
+            SCMI_SequenceSave(sequences);
+            sequences[channel + 1U] = 0U;
+            SCMI_SequenceRestore(sequences);
+        }
+
         /* Run over Default Case */
         printf("SCMI_PowerStateSet(%u, %u, 0, 5U)\n",
             channel, domainId);
@@ -340,6 +402,11 @@ static void TEST_ScmiPowerSet(bool pass, uint32_t channel,
         /* Test power Set ON */
         NECHECK(SCMI_PowerStateSet(channel, domainId,
             0U, SCMI_POWER_DOMAIN_STATE_ON), SCMI_ERR_DENIED);
+
+        /* Test async power Set ON */
+        NECHECK(SCMI_PowerStateSet(channel, domainId,
+            SCMI_POWER_FLAGS_ASYNC(1U), SCMI_POWER_DOMAIN_STATE_ON),
+            SCMI_ERR_DENIED);
     }
 }
 
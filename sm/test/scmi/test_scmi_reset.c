@@ -188,6 +188,7 @@ static void TEST_ScmiResetNone(uint32_t channel, uint32_t domainId)
         printf("SCMI_ResetDomainAttributes(%u, %u)\n", channel, domainId);
         CHECK(SCMI_ResetDomainAttributes(channel, domainId,
             &attributes, &latency, name));
+        BCHECK(SCMI_RESET_ATTR_ASYNC(attributes) == 1U);
     }
 }
 
@@ -208,13 +209,32 @@ static void TEST_ScmiResetExclusive(bool pass, uint32_t channel,
 
     if (pass)
     {
-        /* Asynchronous Call -- Should Fail */
+        /* Asynchronous Call without autonomous reset -- Should Fail */
         flags = SCMI_RESET_FLAGS_ASYNC(1U)| SCMI_RESET_FLAGS_SIGNAL(0U)
-            | SCMI_RESET_FLAGS_AUTO(1U);
+            | SCMI_RESET_FLAGS_AUTO(0U);
 
         NECHECK(SCMI_Reset(channel, domainId,
             flags, SCMI_RESET_ARCH_COLD), SCMI_ERR_INVALID_PARAMETERS);
 
+        /* Asynchronous Call */
+        flags = SCMI_RESET_FLAGS_ASYNC(1U)| SCMI_RESET_FLAGS_SIGNAL(0U)
+            | SCMI_RESET_FLAGS_AUTO(1U);
+
+        printf("SCMI_Reset(%u, %u, async)\n", channel, domainId);
+        CHECK(SCMI_Reset(channel, domainId,
+            flags, SCMI_RESET_ARCH_COLD));
+
+#ifdef SIMU
+        {
+            uint32_t domainIdAsync = 0U;
+
+            /* Delayed response */
+            printf("SCMI_ResetComplete(%u)\n", channel + 1U);
+            CHECK(SCMI_ResetComplete(channel + 1U, &domainIdAsync));
+            BCHECK(domainIdAsync == domainId);
+        }
+#endif
+
         /* Reset functionality with different flag inputs */
         flags = SCMI_RESET_FLAGS_ASYNC(0U) | SCMI_RESET_FLAGS_SIGNAL(0U)
             | SCMI_RESET_FLAGS_AUTO(1U);
@@ -378,6 +378,18 @@ static void TEST_ScmiSensorNotify(bool pass, uint32_t channel,
         NECHECK(SCMI_SensorTripPointNotify(SM_SCMI_NUM_CHN, sensorId,
             sensorEventControl), SCMI_ERR_INVALID_PARAMETERS);
     }
+
+    /* Test sensor continuous update notify */
+    {
+        printf("SCMI_SensorContinuousUpdateNotify(%u, %u)\n", channel,
+            sensorId);
+        XCHECK(pass, SCMI_SensorContinuousUpdateNotify(channel, sensorId,
+            1U));
+        XCHECK(pass, SCMI_SensorContinuousUpdateNotify(channel, sensorId,
+            0U));
+        NECHECK(SCMI_SensorContinuousUpdateNotify(channel, SM_NUM_SENSOR,
+            0U), SCMI_ERR_NOT_FOUND);
+    }
 }
 
 /*--------------------------------------------------------------------------*/
@@ -435,16 +447,91 @@ static void TEST_ScmiSensorSet(bool pass, uint32_t channel,
             sensorConfig));
     }
 
-    /* Test for error for an async call in SensorReadingGet */
+    /* Test async call in SensorReadingGet */
+    if (pass)
     {
-        scmi_sensor_reading_t readings[SCMI_SENSOR_MAX_READINGS]
-            = { 0 };
         uint32_t flags = SCMI_SENSOR_READ_FLAGS_ASYNC(1U);
 
-        printf("SCMI_SensorReadingGet(%u, %u)\n",
+        printf("SCMI_SensorReadingGet(%u, %u, async)\n",
             SM_TEST_DEFAULT_CHN, sensorId);
-        NCHECK(SCMI_SensorReadingGet(channel, sensorId,
-            flags,readings));
+        if (SCMI_SENSOR_ATTR_LOW_ASYNC(
+            s_desc[descIndex].sensorAttributesLow) == 1U)
+        {
+            CHECK(SCMI_SensorReadingGet(channel, sensorId,
+                flags, NULL));
+
+#ifdef SIMU
+            uint32_t sensorIdAsync = 0U;
+            scmi_sensor_reading_t readings[SCMI_SENSOR_MAX_READINGS]
+                = { 0 };
+
+            /* Delayed response */
+            printf("SCMI_SensorReadingComplete(%u)\n", channel + 1U);
+            CHECK(SCMI_SensorReadingComplete(channel + 1U, &sensorIdAsync,
+                readings));
+            BCHECK(sensorIdAsync == sensorId);
+            printf("  Sensor_value_low = %d\n",
+                readings[0].sensorValueLow);
+#endif
+        }
+        else
+        {
+            NECHECK(SCMI_SensorReadingGet(channel, sensorId,
+                flags, NULL), SCMI_ERR_INVALID_PARAMETERS);
+        }
+    }
+
+    /* Test continuous update at a configured interval */
+    if (pass)
+    {
+        uint32_t sensorConfig = SCMI_SENSOR_CONFIG_SET_ENABLE(1U)
+            | SCMI_SENSOR_CONFIG_SET_UPDATE_INTV_SEC(3600U);
+        uint32_t sensorConfigGet = 0U;
+
+        printf("SCMI_SensorConfigSet(%u, %u, 0x%08X)\n",
+            channel, sensorId, sensorConfig);
+        CHECK(SCMI_SensorConfigSet(channel, sensorId, sensorConfig));
+        CHECK(SCMI_SensorConfigGet(channel, sensorId, &sensorConfigGet));
+        BCHECK(SCMI_SENSOR_CONFIG_GET_UPDATE_INTV_SEC(sensorConfigGet)
+            == 3600U);
+
+        /* Interval is per agent */
+        if ((channel != SM_TEST_DEFAULT_CHN)
+            && (SCMI_SensorConfigGet(SM_TEST_DEFAULT_CHN, sensorId,
+            &sensorConfigGet) == SCMI_ERR_SUCCESS))
+        {
+            BCHECK(SCMI_SENSOR_CONFIG_GET_UPDATE_INTV_SEC(sensorConfigGet)
+                != 3600U);
+        }
+
+        /* Enable updates */
+        printf("SCMI_SensorContinuousUpdateNotify(%u, %u)\n", channel,
+            sensorId);
+        CHECK(SCMI_SensorContinuousUpdateNotify(channel, sensorId, 1U));
+
+#ifdef SIMU
+        uint32_t sensorIdUpdate = 0U;
+        scmi_sensor_reading_t readings[SCMI_SENSOR_MAX_READINGS]
+            = { 0 };
+
+        /* Expire interval */
+        LMM_Tick(3600U * 1000U);
+
+        /* Update notification */
+        printf("SCMI_SensorUpdate(%u)\n", channel + 1U);
+        CHECK(SCMI_SensorUpdate(channel + 1U, NULL, &sensorIdUpdate,
+            readings));
+        BCHECK(sensorIdUpdate == sensorId);
+#endif
+
+        /* Disable updates, restore interval of 1 sec */
+        CHECK(SCMI_SensorContinuousUpdateNotify(channel, sensorId, 0U));
+        sensorConfig = SCMI_SENSOR_CONFIG_SET_ENABLE(1U)
+            | SCMI_SENSOR_CONFIG_SET_UPDATE_INTV_SEC(1U);
+        CHECK(SCMI_SensorConfigSet(channel, sensorId, sensorConfig));
+        CHECK(SCMI_SensorConfigGet(channel, sensorId, &sensorConfigGet));
+        BCHECK(SCMI_SENSOR_CONFIG_GET_UPDATE_INTV_SEC(sensorConfigGet)
+            == 1000U);
     }
 
     /* Should fail with an error after trying to use protocol
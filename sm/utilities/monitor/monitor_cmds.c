@@ -50,6 +50,7 @@
 #endif
 #include "lmm.h"
 #include "dev_sm_api.h"
+#include "trace.h"
 #ifdef DEVICE_HAS_ELE
 #include "fsl_ele.h"
 #endif
@@ -135,6 +136,7 @@ static int32_t MONITOR_CmdAssert(int32_t argc, const char * const argv[]);
 static int32_t MONITOR_CmdSyslog(int32_t argc, const char * const argv[]);
 static int32_t MONITOR_CmdGroup(int32_t argc, const char * const argv[]);
 static int32_t MONITOR_CmdSsm(int32_t argc, const char * const argv[]);
+static int32_t MONITOR_CmdTrace(int32_t argc, const char * const argv[]);
 static int32_t MONITOR_CmdCustom(int32_t argc, const char * const argv[]);
 static int32_t MONITOR_CmdTest(int32_t argc, const char * const argv[]);
 
@@ -208,6 +210,7 @@ int32_t MONITOR_Dispatch(char *line)
         "syslog",
         "grp",
         "ssm",
+        "trace",
         "custom",
         "test"
     };
@@ -392,10 +395,13 @@ int32_t MONITOR_Dispatch(char *line)
             case 53:  /* ssm */
                 status = MONITOR_CmdSsm(argc - 1, &argv[1]);
                 break;
-            case 54:  /* custom */
+            case 54:  /* trace */
+                status = MONITOR_CmdTrace(argc - 1, &argv[1]);
+                break;
+            case 55:  /* custom */
                 status = MONITOR_CmdCustom(argc - 1, &argv[1]);
                 break;
-            case 55:  /* test */
+            case 56:  /* test */
                 status = MONITOR_CmdTest(argc - 1, &argv[1]);
                 break;
             default:
@@ -755,6 +761,9 @@ static int32_t MONITOR_CmdBtime(int32_t argc, const char * const argv[])
     /* Display SM start time */
     printf("SM start time: %uuS\n", startTime);
 
+    /* Display LMM init time */
+    printf("LMM init time: %uuS\n", (uint32_t) g_bootTime[SM_BT_LMM]);
+
     /* Loop over LM */
     for (uint32_t lmId = 0U; lmId < SM_NUM_LM; lmId++)
     {
@@ -3200,6 +3209,74 @@ static int32_t MONITOR_CmdSsm(int32_t argc, const char * const argv[])
     return status;
 }
 
+/*--------------------------------------------------------------------------*/
+/* Trace command                                                            */
+/*--------------------------------------------------------------------------*/
+static int32_t MONITOR_CmdTrace(int32_t argc, const char * const argv[])
+{
+    int32_t status = SM_ERR_SUCCESS;
+
+    static string const s_catNames[] =
+    {
+        "scmi",
+        "lmm",
+        "perf",
+        "volt",
+        "pmic",
+        "irq",
+        "sleep"
+    };
+
+    if (argc != 0)
+    {
+        /* Clear trace */
+        if (strcasecmp(argv[0], "clear") == 0)
+        {
+            TRACE_Clear();
+        }
+        else
+        {
+            status = SM_ERR_INVALID_PARAMETERS;
+        }
+    }
+    else
+    {
+        uint32_t last = TRACE_IndexGet();
+        uint32_t index = (last > SM_TRACE_NUM) ? (last - SM_TRACE_NUM)
+            : 0U;
+
+        printf("Trace mask 0x%08X, %u records written\n",
+            (uint32_t) SM_TRACE_MASK, last);
+
+        /* Dump oldest to newest */
+        while (index != last)
+        {
+            trace_rec_t rec;
+
+            if (TRACE_Get(index, &rec) == SM_ERR_SUCCESS)
+            {
+                uint32_t cat = SM_TRACE_EVENT_CAT(rec.event);
+
+                printf("%10uuS: ", rec.timeLow);
+                if (cat < ARRAY_SIZE(s_catNames))
+                {
+                    printf("%-5s", s_catNames[cat]);
+                }
+                else
+                {
+                    printf("%-5u", cat);
+                }
+                printf(" %u 0x%04X 0x%08X\n", SM_TRACE_EVENT_ID(rec.event),
+                    SM_TRACE_EVENT_ARG(rec.event), rec.arg);
+            }
+            index++;
+        }
+    }
+
+    /* Return status */
+    return status;
+}
+
 /*--------------------------------------------------------------------------*/
 /* Custom command                                                           */
 /*--------------------------------------------------------------------------*/
@@ -0,0 +1,153 @@
+/*
+** ###################################################################
+**
+** Copyright 2024 NXP
+**
+** Redistribution and use in source and binary forms, with or without modification,
+** are permitted provided that the following conditions are met:
+**
+** o Redistributions of source code must retain the above copyright notice, this list
+**   of conditions and the following disclaimer.
+**
+** o Redistributions in binary form must reproduce the above copyright notice, this
+**   list of conditions and the following disclaimer in the documentation and/or
+**   other materials provided with the distribution.
+**
+** o Neither the name of the copyright holder nor the names of its
+**   contributors may be used to endorse or promote products derived from this
+**   software without specific prior written permission.
+**
+** THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+** ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+** WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+** DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+** ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+** (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+** LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+** ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+** (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+** SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+**
+**
+** ###################################################################
+*/
+
+/*==========================================================================*/
+/* File containing the implementation of the event trace                    */
+/*==========================================================================*/
+
+/* Includes */
+
+#include "sm.h"
+#include "trace.h"
+#include "dev_sm.h"
+
+/* Local defines */
+
+/* Marker for a valid retained trace buffer */
+#define TRACE_MAGIC  0x54524345U
+
+/* Local types */
+
+/* Retained trace buffer */
+typedef struct
+{
+    uint32_t magic;
+    uint32_t index;
+    trace_rec_t rec[SM_TRACE_NUM];
+} trace_buf_t;
+
+/* Local variables */
+
+/* Trace buffer, not cleared by startup so it survives an SM reset */
+#ifndef SIMU
+static trace_buf_t s_trace __attribute__((section(".noinit")));
+#else
+static trace_buf_t s_trace;
+#endif
+
+/*--------------------------------------------------------------------------*/
+/* Init the trace                                                           */
+/*--------------------------------------------------------------------------*/
+void TRACE_Init(void)
+{
+    /* Clear if not retained */
+    if (s_trace.magic != TRACE_MAGIC)
+    {
+        TRACE_Clear();
+        s_trace.magic = TRACE_MAGIC;
+    }
+}
+
+/*--------------------------------------------------------------------------*/
+/* Record a trace event                                                     */
+/*--------------------------------------------------------------------------*/
+void TRACE_Record(uint32_t cat, uint32_t id, uint32_t arg0, uint32_t arg1)
+{
+    uint64_t usec = DEV_SM_Usec64Get();
+    uint32_t index;
+    trace_rec_t *rec;
+
+    /* Reserve slot, safe against preemption by other recorders */
+    index = __atomic_fetch_add(&s_trace.index, 1U, __ATOMIC_RELAXED);
+    rec = &s_trace.rec[index & (SM_TRACE_NUM - 1U)];
+
+    /* Fill record */
+    rec->timeLow = SM_UINT64_L(usec);
+    rec->timeHigh = SM_UINT64_H(usec);
+    rec->event = SM_TRACE_EVENT(cat, id, arg0);
+    rec->arg = arg1;
+}
+
+/*--------------------------------------------------------------------------*/
+/* Get the trace write index                                                */
+/*--------------------------------------------------------------------------*/
+uint32_t TRACE_IndexGet(void)
+{
+    return __atomic_load_n(&s_trace.index, __ATOMIC_RELAXED);
+}
+
+/*--------------------------------------------------------------------------*/
+/* Get a trace record                                                       */
+/*--------------------------------------------------------------------------*/
+int32_t TRACE_Get(uint32_t index, trace_rec_t *rec)
+{
+    int32_t status = SM_ERR_SUCCESS;
+    uint32_t age = TRACE_IndexGet() - index;
+
+    /* Check index is written and not overwritten */
+    if ((age == 0U) || (age > SM_TRACE_NUM))
+    {
+        status = SM_ERR_NOT_FOUND;
+    }
+    else
+    {
+        *rec = s_trace.rec[index & (SM_TRACE_NUM - 1U)];
+
+        /* Fail if a recorder reused the slot while copying */
+        __atomic_thread_fence(__ATOMIC_ACQUIRE);
+        if ((TRACE_IndexGet() - index) > SM_TRACE_NUM)
+        {
+            status = SM_ERR_NOT_FOUND;
+        }
+    }
+
+    /* Return status */
+    return status;
+}
+
+/*--------------------------------------------------------------------------*/
+/* Clear the trace                                                          */
+/*--------------------------------------------------------------------------*/
+void TRACE_Clear(void)
+{
+    for (uint32_t idx = 0U; idx < SM_TRACE_NUM; idx++)
+    {
+        s_trace.rec[idx].timeLow = 0U;
+        s_trace.rec[idx].timeHigh = 0U;
+        s_trace.rec[idx].event = 0U;
+        s_trace.rec[idx].arg = 0U;
+    }
+    __atomic_store_n(&s_trace.index, 0U, __ATOMIC_RELAXED);
+}
+
@@ -0,0 +1,216 @@
+/*
+** ###################################################################
+**
+** Copyright 2024 NXP
+**
+** Redistribution and use in source and binary forms, with or without modification,
+** are permitted provided that the following conditions are met:
+**
+** o Redistributions of source code must retain the above copyright notice, this list
+**   of conditions and the following disclaimer.
+**
+** o Redistributions in binary form must reproduce the above copyright notice, this
+**   list of conditions and the following disclaimer in the documentation and/or
+**   other materials provided with the distribution.
+**
+** o Neither the name of the copyright holder nor the names of its
+**   contributors may be used to endorse or promote products derived from this
+**   software without specific prior written permission.
+**
+** THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+** ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+** WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+** DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+** ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+** (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+** LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+** ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+** (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+** SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+**
+**
+** ###################################################################
+*/
+
+/*!
+ * @addtogroup UTIL
+ * @{
+ *
+ * @file
+ * @brief
+ *
+ * Header file containing the event trace functions.
+ *
+ * The trace is a ring of fixed size binary records in retained memory. Each
+ * record holds a 64-bit uS timestamp (SYSCTR), a category, an event ID and
+ * two arguments. Events are grouped into categories which are enabled at
+ * compile time using ::SM_TRACE_MASK. A disabled category compiles to
+ * nothing. Slots are reserved with an atomic increment of the write index
+ * so events can be recorded from any context without locks. The oldest
+ * records are overwritten when the ring wraps.
+ */
+/*==========================================================================*/
+
+#ifndef TRACE_H
+#define TRACE_H
+
+/* Includes */
+
+#include "sm.h"
+
+/* Defines */
+
+/*!
+ * @name Trace categories
+ */
+/** @{ */
+#define SM_TRACE_CAT_SCMI   0U  /*!< SCMI requests and responses */
+#define SM_TRACE_CAT_LMM    1U  /*!< LM state changes */
+#define SM_TRACE_CAT_PERF   2U  /*!< Performance level transitions */
+#define SM_TRACE_CAT_VOLT   3U  /*!< Voltage transitions */
+#define SM_TRACE_CAT_PMIC   4U  /*!< PMIC I2C transactions */
+#define SM_TRACE_CAT_IRQ    5U  /*!< Interrupts */
+#define SM_TRACE_CAT_SLEEP  6U  /*!< Sleep entry and exit */
+/** @} */
+
+/*!
+ * @name Trace event IDs (per category)
+ */
+/** @{ */
+#define SM_TRACE_SCMI_REQ      0U  /*!< arg0 = agent, arg1 = header */
+#define SM_TRACE_SCMI_RSP      1U  /*!< arg0 = agent, arg1 = status */
+#define SM_TRACE_LMM_POWER     0U  /*!< arg0 = LM, arg1 = status */
+#define SM_TRACE_LMM_BOOT      1U  /*!< arg0 = LM, arg1 = status */
+#define SM_TRACE_LMM_SHUTDOWN  2U  /*!< arg0 = LM, arg1 = status */
+#define SM_TRACE_LMM_SUSPEND   3U  /*!< arg0 = LM, arg1 = agent */
+#define SM_TRACE_LMM_WAKE      4U  /*!< arg0 = LM, arg1 = agent */
+#define SM_TRACE_PERF_START    0U  /*!< arg0 = domain, arg1 = level */
+#define SM_TRACE_PERF_DONE     1U  /*!< arg0 = domain, arg1 = status */
+#define SM_TRACE_VOLT_MODE     0U  /*!< arg0 = domain, arg1 = mode */
+#define SM_TRACE_VOLT_LEVEL    1U  /*!< arg0 = domain, arg1 = level */
+#define SM_TRACE_VOLT_DONE     2U  /*!< arg0 = domain, arg1 = status */
+#define SM_TRACE_PMIC_START    0U  /*!< arg0 = domain, arg1 = uV/mode */
+#define SM_TRACE_PMIC_DONE     1U  /*!< arg0 = domain, arg1 = status */
+#define SM_TRACE_IRQ_DONE      0U  /*!< arg0 = IRQ, arg1 = count */
+#define SM_TRACE_IRQ_MU        1U  /*!< arg0 = MU, arg1 = status flags */
+#define SM_TRACE_SLEEP_ENTRY   0U  /*!< arg0 = mode, arg1 = flags */
+#define SM_TRACE_SLEEP_EXIT    1U  /*!< arg0 = wake IRQ, arg1 = count */
+#define SM_TRACE_SLEEP_IDLE    2U  /*!< arg0 = idle state, arg1 = expect uS */
+/** @} */
+
+/*! Categories enabled for trace (high rate SCMI and IRQ off by default) */
+#ifndef SM_TRACE_MASK
+#define SM_TRACE_MASK  (BIT32(SM_TRACE_CAT_LMM) | BIT32(SM_TRACE_CAT_PERF) \
+    | BIT32(SM_TRACE_CAT_VOLT) | BIT32(SM_TRACE_CAT_PMIC) \
+    | BIT32(SM_TRACE_CAT_SLEEP))
+#endif
+
+/*! Number of trace records (power of two) */
+#ifndef SM_TRACE_NUM
+#define SM_TRACE_NUM  128U
+#endif
+
+/*!
+ * @name Trace record event field
+ */
+/** @{ */
+/*! Build event field */
+#define SM_TRACE_EVENT(cat, id, arg0)  ((((cat) & 0xFFU) << 24U) \
+    | (((id) & 0xFFU) << 16U) | ((arg0) & 0xFFFFU))
+#define SM_TRACE_EVENT_CAT(e)   (((e) >> 24U) & 0xFFU)  /*!< Category */
+#define SM_TRACE_EVENT_ID(e)    (((e) >> 16U) & 0xFFU)  /*!< Event ID */
+#define SM_TRACE_EVENT_ARG(e)   ((e) & 0xFFFFU)         /*!< Argument 0 */
+/** @} */
+
+/*!
+ * Record a trace event.
+ *
+ * Compiles to nothing if \a cat is not enabled in ::SM_TRACE_MASK.
+ */
+#define SM_TRACE(cat, id, arg0, arg1) \
+    do \
+    { \
+        if ((SM_TRACE_MASK & BIT32(cat)) != 0U) \
+        { \
+            TRACE_Record((cat), (id), (uint32_t) (arg0), \
+                (uint32_t) (arg1)); \
+        } \
+    } \
+    while (false)
+
+/* Types */
+
+/*!
+ * Trace record
+ */
+typedef struct
+{
+    uint32_t timeLow;   /*!< Timestamp in uS (low) */
+    uint32_t timeHigh;  /*!< Timestamp in uS (high) */
+    uint32_t event;     /*!< Category, event ID, and argument 0 */
+    uint32_t arg;       /*!< Argument 1 */
+} trace_rec_t;
+
+/* Functions */
+
+/*!
+ * @name Trace functions
+ * @{
+ */
+
+/*!
+ * Init the trace.
+ *
+ * Keeps the contents of the retained trace buffer if valid, otherwise
+ * clears it.
+ */
+void TRACE_Init(void);
+
+/*!
+ * Record a trace event. Normally called via SM_TRACE().
+ *
+ * @param[in]     cat       Category
+ * @param[in]     id        Event ID
+ * @param[in]     arg0      Argument 0 (16 bits)
+ * @param[in]     arg1      Argument 1
+ */
+void TRACE_Record(uint32_t cat, uint32_t id, uint32_t arg0, uint32_t arg1);
+
+/*!
+ * Get the trace write index.
+ *
+ * @return Returns the total number of records written. The oldest record
+ *         still available is this minus ::SM_TRACE_NUM.
+ */
+uint32_t TRACE_IndexGet(void);
+
+/*!
+ * Get a trace record.
+ *
+ * @param[in]     index     Record index (see TRACE_IndexGet())
+ * @param[out]    rec       Pointer to return record
+ *
+ * The write index is checked again after the copy, so a record
+ * overwritten during the copy is reported as not found rather than
+ * returned torn.
+ *
+ * @return Returns the status (::SM_ERR_SUCCESS = success).
+ *
+ * Return errors (see @ref STATUS "SM error codes"):
+ * - ::SM_ERR_SUCCESS: if the record is returned.
+ * - ::SM_ERR_NOT_FOUND: if \a index not yet written, or overwritten
+ *   before or during the copy.
+ */
+int32_t TRACE_Get(uint32_t index, trace_rec_t *rec);
+
+/*!
+ * Clear the trace.
+ */
+void TRACE_Clear(void);
+
+/** @} */
+
+#endif /* TRACE_H */
+
+/** @} */
+